@@ -0,0 +1,16 @@
+#version 330 core
+
+layout (location = 0) in vec2 vertex; // Unit quad
+layout (location = 3) in vec4 glyphRect; // Instanced: x, y, w, h
+layout (location = 4) in vec4 glyphUV; // Instanced: left, bottom, right, top
+
+out vec2 TexCoords;
+
+uniform mat4 projection;
+
+void main()
+{
+    // The quad's y axis points down while the font texture is flipped
+    TexCoords = vec2(mix(glyphUV.x, glyphUV.z, vertex.x), mix(glyphUV.w, glyphUV.y, vertex.y));
+    gl_Position = projection * vec4(glyphRect.xy + vertex * glyphRect.zw, 0.0, 1.0);
+}
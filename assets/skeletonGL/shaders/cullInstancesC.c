@@ -0,0 +1,91 @@
+#version 430 core
+
+// Tests every resident sprite instance against the camera and compacts the visible ones in
+// slot order, so overlapping sprites keep the order the layer was filled in. Dispatched twice:
+// pass 0 counts the survivors of each workgroup, pass 1 stores every survivor after those of
+// the earlier workgroups and writes the surviving instance count to the draw indirect command
+layout (local_size_x = 64) in;
+
+layout (std430, binding = 0) readonly buffer Instances { mat4 instances[]; };
+layout (std430, binding = 1) writeonly buffer Visible { mat4 visible[]; };
+layout (std430, binding = 2) buffer Command
+{
+    uint count;
+    uint instanceCount;
+    uint first;
+    uint baseInstance;
+};
+layout (std430, binding = 3) buffer GroupCounts { uint groupCounts[]; };
+
+uniform mat4 projection;    // Same camera matrix the sprite shaders use
+uniform int totalInstances;
+uniform int cullPass;       // 0 counts, 1 compacts
+
+shared uint scan[64];
+
+bool isVisible(mat4 model)
+{
+    // Freed layer slots hold a zero matrix
+    if (model[3][3] == 0.0)
+        return false;
+
+    // Bounds of the unit sprite quad in clip space, orthographic so w stays 1
+    mat4 mvp = projection * model;
+    vec2 c0 = (mvp * vec4(0.0, 0.0, 0.0, 1.0)).xy;
+    vec2 c1 = (mvp * vec4(1.0, 0.0, 0.0, 1.0)).xy;
+    vec2 c2 = (mvp * vec4(0.0, 1.0, 0.0, 1.0)).xy;
+    vec2 c3 = (mvp * vec4(1.0, 1.0, 0.0, 1.0)).xy;
+    vec2 lo = min(min(c0, c1), min(c2, c3));
+    vec2 hi = max(max(c0, c1), max(c2, c3));
+
+    return !(hi.x < -1.0 || lo.x > 1.0 || hi.y < -1.0 || lo.y > 1.0);
+}
+
+void main()
+{
+    uint id = gl_GlobalInvocationID.x;
+    uint local = gl_LocalInvocationID.x;
+    // Out of range invocations still take part in the barriers below
+    mat4 model = (id < uint(totalInstances)) ? instances[id] : mat4(0.0);
+    bool keep = isVisible(model);
+
+    // Inclusive prefix sum of the survivors inside the workgroup
+    scan[local] = keep ? 1u : 0u;
+    barrier();
+    for (uint offset = 1u; offset < 64u; offset <<= 1)
+    {
+        uint value = (local >= offset) ? scan[local - offset] : 0u;
+        barrier();
+        scan[local] += value;
+        barrier();
+    }
+    uint position = scan[local];
+    uint groupTotal = scan[63];
+
+    if (cullPass == 0)
+    {
+        if (local == 0u)
+            groupCounts[gl_WorkGroupID.x] = groupTotal;
+        return;
+    }
+
+    // Survivors of every earlier workgroup, summed by the whole group
+    uint partial = 0u;
+    for (uint group = local; group < gl_WorkGroupID.x; group += 64u)
+        partial += groupCounts[group];
+    barrier();
+    scan[local] = partial;
+    barrier();
+    for (uint stride = 32u; stride > 0u; stride >>= 1)
+    {
+        if (local < stride)
+            scan[local] += scan[local + stride];
+        barrier();
+    }
+    uint base = scan[0];
+
+    if (keep)
+        visible[base + position - 1u] = model;
+    if (local == 0u && gl_WorkGroupID.x == gl_NumWorkGroups.x - 1u)
+        instanceCount = base + groupTotal;
+}
@@ -6,11 +6,57 @@ uniform sampler2D scene;
 uniform vec2 textureDimensions;
 uniform vec2 mousePosition;
 uniform float deltaTime;
+
+// Samples the 3x3 neighbourhood of TexCoords weighted by kernel
+vec3 convolute(float kernel[9])
+{
+  vec2 texel = 1.0 / textureDimensions;
+  vec3 sum = vec3(0.0);
+  int i = 0;
+  for (int y = 1; y >= -1; --y)
+    for (int x = -1; x <= 1; ++x)
+      sum += texture(scene, TexCoords + vec2(x, y) * texel).rgb * kernel[i++];
+  return sum;
+}
+
+#if defined(SGL_PP_OVERDRAW)
+// One color per layer, 7 or more fragments per pixel show as white
+vec3 overdrawRamp(float layers)
+{
+  vec3 ramp[8] = vec3[](vec3(0.0, 0.0, 0.0), vec3(0.0, 0.0, 1.0), vec3(0.0, 1.0, 1.0), vec3(0.0, 1.0, 0.0),
+                        vec3(1.0, 1.0, 0.0), vec3(1.0, 0.5, 0.0), vec3(1.0, 0.0, 0.0), vec3(1.0, 1.0, 1.0));
+  float t = clamp(layers, 0.0, 7.0);
+  int i = int(floor(t));
+  return mix(ramp[i], ramp[min(i + 1, 7)], fract(t));
+}
+#endif
+
 void main()
 {
   //NOTE: on a 960GTX, the color is by default initialized to
   //proper values, in some intel HD integrated cards they do not
   //you have to explicitly initialize the color to the value you want
   color = vec4(0.0, 0.0, 0.0, 0.0);
+
+#if defined(SGL_PP_OVERDRAW)
+  // The target started at 1.0 and was halved by every fragment that touched it
+  float layers = -log2(max(texture(scene, TexCoords).r, 1.2e-38));
+  color = vec4(overdrawRamp(layers), 1.0);
+#elif defined(SGL_PP_CHAOS)
+  float edgeKernel[9] = float[](-1.0, -1.0, -1.0,
+                                -1.0,  8.0, -1.0,
+                                -1.0, -1.0, -1.0);
+  color = vec4(convolute(edgeKernel), 1.0);
+#elif defined(SGL_PP_SHAKE)
+  float blurKernel[9] = float[](1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                                2.0 / 16.0, 4.0 / 16.0, 2.0 / 16.0,
+                                1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0);
+  color = vec4(convolute(blurKernel), 1.0);
+#else
   color = texture(scene, TexCoords);
+#endif
+
+#ifdef SGL_PP_CONFUSE
+  color = vec4(1.0 - color.rgb, color.a);
+#endif
 }
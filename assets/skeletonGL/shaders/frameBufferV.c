@@ -7,10 +7,24 @@ out vec2 TexCoords;
 
 uniform float time;
 
+// Effects are compiled in by the post processor variants (SGL_PP_VARIANT)
 
 void main()
 {
   //gl_Position = vec4(vertex.xy, 0.0f, 1.0f);
   gl_Position = vec4(vertex.x, vertex.y, 0.0f, 1.0f);
   TexCoords = vec2(UVCoords.x, UVCoords.y);
+
+#ifdef SGL_PP_CHAOS
+  float chaosStrength = 0.3;
+  TexCoords = vec2(TexCoords.x + sin(time) * chaosStrength, TexCoords.y + cos(time) * chaosStrength);
+#endif
+#ifdef SGL_PP_CONFUSE
+  TexCoords = vec2(1.0 - TexCoords.x, 1.0 - TexCoords.y);
+#endif
+#ifdef SGL_PP_SHAKE
+  float shakeStrength = 0.01;
+  gl_Position.x += cos(time * 10.0) * shakeStrength;
+  gl_Position.y += cos(time * 15.0) * shakeStrength;
+#endif
 }
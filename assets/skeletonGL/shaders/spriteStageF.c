@@ -0,0 +1,16 @@
+#version 410 core
+
+// Separable fragment stage, custom sprite effects only need to replace this stage
+
+layout (location = 0) in vec2 TexCoords;
+out vec4 color;
+
+uniform sampler2D image;
+uniform vec4 spriteColor;
+uniform float deltaTime;
+uniform vec2 spriteDimensions;
+
+void main()
+{
+    color = spriteColor * texture(image, TexCoords);
+}
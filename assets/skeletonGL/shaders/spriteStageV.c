@@ -0,0 +1,21 @@
+#version 410 core
+
+// Separable vertex stage shared by every sprite pipeline
+
+layout (location = 0) in vec2 vertex; //vec2 pos
+layout (location = 1) in vec2 UVCoords;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+layout (location = 0) out vec2 TexCoords;
+
+uniform mat4 model;
+uniform mat4 projection;
+
+void main()
+{
+    TexCoords = vec2(UVCoords.x, UVCoords.y);
+    gl_Position = projection * model * vec4(vertex.xy, 0.0, 1.0);
+}
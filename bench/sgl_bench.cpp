@@ -0,0 +1,666 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    bench/sgl_bench.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Headless renderer benchmark, built with make bench
+ *
+ * @section DESCRIPTION
+ *
+ * Drives a fixed set of scenes through SGL_Renderer and reports, per scene, the CPU time
+ * spent per drawn item, draw calls, state changes and uploads per frame and the frame time
+ * percentiles as JSON. By default every GL call goes to SGL_RecordingGLBackend so the
+ * numbers only measure the engine's CPU side and run on any machine. --native renders to a
+ * hidden window instead, combine it with LIBGL_ALWAYS_SOFTWARE=1 to run on Mesa llvmpipe.
+ *
+ * --baseline compares against a previous run, scenes whose CPU time per item grew more than
+ * --tolerance percent are reported and the exit code is 1. The idle frame hash is checked
+ * before the scenes run, a camera pan without input must not count as an idle frame, a
+ * failure also exits with 1.
+ *
+ * Usage: sgl_bench [--count N] [--frames N] [--warmup N] [--scene NAME]... [--native]
+ *                  [--out FILE] [--baseline FILE] [--tolerance PERCENT]
+ */
+
+// C++
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <functional>
+#include <algorithm>
+// Dependencies
+#include <GL/glew.h>
+#include <SDL2/SDL.h>
+#include "../src/skeletonGL/deps/glm/glm.hpp"
+// SkeletonGL
+#include "../src/skeletonGL/utility/SGL_AssetManager.hpp"
+#include "../src/skeletonGL/utility/SGL_DataStructures.hpp"
+#include "../src/skeletonGL/utility/SGL_Utility.hpp"
+#include "../src/skeletonGL/utility/SGL_FrameStats.hpp"
+#include "../src/skeletonGL/renderer/SGL_OpenGLManager.hpp"
+#include "../src/skeletonGL/renderer/SGL_RecordingGLBackend.hpp"
+#include "../src/skeletonGL/renderer/SGL_Camera.hpp"
+#include "../src/skeletonGL/renderer/SGL_Renderer.hpp"
+
+/**
+ * @brief Command line options
+ */
+struct BenchOptions
+{
+    std::size_t count;                           ///< Scene size, sprites per frame
+    std::size_t frames;                          ///< Measured frames per scene
+    std::size_t warmup;                          ///< Frames run before measuring
+    std::vector<std::string> scenes;             ///< Only run these, every scene when empty
+    bool native;                                 ///< Render to a hidden window instead of the recording backend
+    std::string out;                             ///< JSON output, - for stdout
+    std::string baseline;                        ///< Previous run to compare against
+    double tolerance;                            ///< Allowed CPU time per item growth, in percent
+    BenchOptions() : count(10000), frames(300), warmup(30), native(false), out("-"), tolerance(10.0) {}
+};
+
+/**
+ * @brief Everything a scene draws with
+ */
+struct BenchContext
+{
+    std::shared_ptr<SGL_OpenGLManager> oglm;
+    SGL_RecordingGLBackend *recording;           ///< Owned by oglm, nullptr when rendering natively
+    std::unique_ptr<SGL_AssetManager> assets;
+    std::unique_ptr<SGL_Camera> camera;
+    std::unique_ptr<SGL_Renderer> renderer;
+    SDL_Window *window;
+    SDL_GLContext context;
+    int width, height;
+    BenchContext() : recording(nullptr), window(nullptr), context(nullptr), width(1280), height(720) {}
+};
+
+/**
+ * @brief A benchmark scene, draw() is called once per frame
+ */
+struct BenchScene
+{
+    std::string name;
+    std::size_t items;                           ///< Sprites, glyphs, lines or pixels drawn per frame
+    std::function<void(BenchContext &)> draw;
+};
+
+/**
+ * @brief Results of one scene
+ */
+struct BenchResult
+{
+    std::string name;
+    std::size_t items;
+    double cpuNsPerItem;                         ///< Mean submission time divided by the items
+    double drawsPerFrame;
+    double stateChangesPerFrame;                 ///< Program, texture, buffer, VAO, FBO, blend and capability changes
+    double uniformsPerFrame;
+    double bytesPerFrame;
+    double glCallsPerFrame;                      ///< Recording backend only
+    SGL_FrameStatsReport report;                 ///< render = submission, swap = swap and fence, frame = both
+    double baselineNsPerItem;                    ///< 0 without a baseline
+};
+
+/**
+ * @brief Prints the usage
+ */
+static void printUsage()
+{
+    std::cerr << "Usage: sgl_bench [options]\n"
+              << "  --count N          Sprites per frame, the other scenes scale with it (10000)\n"
+              << "  --frames N         Measured frames per scene (300)\n"
+              << "  --warmup N         Frames run before measuring (30)\n"
+              << "  --scene NAME       Only run this scene, can be repeated\n"
+              << "  --native           Render to a hidden window instead of the recording backend\n"
+              << "  --out FILE         JSON output, - for stdout (-)\n"
+              << "  --baseline FILE    Compare against a previous run\n"
+              << "  --tolerance PCT    Allowed CPU time per item growth over the baseline (10)\n";
+}
+
+/**
+ * @brief Parses the command line
+ *
+ * @param argc Argument count
+ * @param argv Arguments
+ * @param options Parsed options
+ * @return bool False on invalid arguments
+ */
+static bool parseOptions(int argc, char **argv, BenchOptions &options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+        if (arg == "--native")
+            options.native = true;
+        else if (arg == "--count" && hasValue)
+            options.count = std::max<std::size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--frames" && hasValue)
+            options.frames = std::max<std::size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--warmup" && hasValue)
+            options.warmup = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--scene" && hasValue)
+            options.scenes.push_back(argv[++i]);
+        else if (arg == "--out" && hasValue)
+            options.out = argv[++i];
+        else if (arg == "--baseline" && hasValue)
+            options.baseline = argv[++i];
+        else if (arg == "--tolerance" && hasValue)
+            options.tolerance = std::strtod(argv[++i], nullptr);
+        else
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Creates the OpenGL manager, on the recording backend or a hidden window
+ *
+ * @param options Command line options
+ * @param ctx Context to fill
+ * @return nothing
+ */
+static void createContext(const BenchOptions &options, BenchContext &ctx)
+{
+    if (!options.native)
+    {
+        ctx.recording = new SGL_RecordingGLBackend();
+        ctx.oglm = std::make_shared<SGL_OpenGLManager>(std::unique_ptr<SGL_GLBackend>(ctx.recording));
+        return;
+    }
+
+    // Same context SGL_Window asks for, the window is never shown
+    if (SDL_Init(SDL_INIT_VIDEO) != 0)
+        throw SGL_Exception(("sgl_bench | SDL_Init failed: " + std::string(SDL_GetError())).c_str());
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 4);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+    SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+    ctx.window = SDL_CreateWindow("sgl_bench", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+                                  ctx.width, ctx.height, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+    if (ctx.window == nullptr)
+        throw SGL_Exception(("sgl_bench | SDL_CreateWindow failed: " + std::string(SDL_GetError())).c_str());
+    ctx.context = SDL_GL_CreateContext(ctx.window);
+    if (ctx.context == nullptr)
+        throw SGL_Exception(("sgl_bench | SDL_GL_CreateContext failed: " + std::string(SDL_GetError())).c_str());
+    // Never wait on vsync, only the rendering is measured
+    SDL_GL_SetSwapInterval(0);
+    glewExperimental = GL_TRUE;
+    if (glewInit() != GLEW_OK)
+        throw SGL_Exception("sgl_bench | glewInit failed");
+    ctx.oglm = std::make_shared<SGL_OpenGLManager>();
+}
+
+/**
+ * @brief Sends the camera projection to every shader, same as SGL_Window::setCameraMode()
+ *
+ * @param ctx Context with a configured camera
+ * @return nothing
+ */
+static void applyCamera(BenchContext &ctx)
+{
+    for (auto iter = ctx.assets->shaderTypes.begin(); iter != ctx.assets->shaderTypes.end(); ++iter)
+    {
+        SGL_Shader shader = ctx.assets->getShader((*iter).first);
+        if (shader.shaderType != SHADER_TYPE::POST_PROCESSOR && shader.pipeline == 0)
+            ctx.camera->cameraMode(shader, CAMERA_MODE::DEFAULT);
+    }
+}
+
+/**
+ * @brief Checks the frame hash SGL_Window uses to skip idle frames
+ * @section DESCRIPTION
+ *
+ * Draws the same sprite every frame and pans the camera between two of them, the way an
+ * application moves it during its update phase without any input. The frame after the pan
+ * must not count as idle, the ones around it must.
+ *
+ * @param ctx Context with a configured renderer
+ * @return bool False if the hash skipped the pan or missed a repeated frame
+ */
+static bool checkIdleFrameHash(BenchContext &ctx)
+{
+    SGL_Sprite sprite;
+    sprite.texture = ctx.assets->getTexture(SGL::DEFAULT_TEXTURE_NAME);
+    sprite.shader = ctx.assets->getShader("spriteUV");
+    sprite.size = glm::vec2(16.0f, 16.0f);
+    sprite.position = glm::vec2(64.0f, 64.0f);
+    sprite.resetUVCoords();
+    auto frame = [&ctx, &sprite]() {
+        ctx.renderer->renderSprite(sprite);
+        ctx.renderer->flushIndirectBatches();
+        return ctx.oglm->closeFrameHash();
+    };
+
+    ctx.oglm->enableFrameHashing(true);
+    frame();
+    const bool repeated = frame();
+    // Scripted pan between frames, nothing else changes
+    ctx.camera->setPosition(glm::vec2(32.0f, 0.0f));
+    ctx.camera->updateCamera();
+    applyCamera(ctx);
+    const bool panned = !frame();
+    const bool settled = frame();
+    ctx.oglm->enableFrameHashing(false);
+
+    // Leave the camera where the scenes expect it
+    ctx.camera->setPosition(glm::vec2(0.0f, 0.0f));
+    ctx.camera->updateCamera();
+    applyCamera(ctx);
+    ctx.oglm->finishFrames();
+
+    if (!repeated)
+        std::cerr << "sgl_bench | Idle check: identical frames hashed differently\n";
+    if (!panned)
+        std::cerr << "sgl_bench | Idle check: a camera pan without input was treated as an idle frame\n";
+    if (!settled)
+        std::cerr << "sgl_bench | Idle check: the frame after the pan was not treated as idle\n";
+    return repeated && panned && settled;
+}
+
+/**
+ * @brief Loads the default assets and configures the renderer the same way SGL_Window does
+ *
+ * @param ctx Context with a valid OpenGL manager
+ * @return nothing
+ */
+static void createRenderer(BenchContext &ctx)
+{
+    ctx.assets = std::make_unique<SGL_AssetManager>(ctx.oglm);
+    const std::string &shaders = FOLDER_STRUCTURE::shadersDir;
+    ctx.assets->loadTexture(FOLDER_STRUCTURE::defaultTexture.c_str(), GL_FALSE, SGL::DEFAULT_TEXTURE_NAME);
+    ctx.assets->loadTexture((FOLDER_STRUCTURE::imagesDir + "blank_square.png").c_str(), GL_TRUE, "box");
+    ctx.assets->loadTexture((FOLDER_STRUCTURE::imagesDir + "default_bitmap_font.png").c_str(), GL_TRUE, "defaultBitmapFont");
+
+    if (ctx.oglm->separableProgramsSupported())
+    {
+        ctx.assets->loadShaderStage((shaders + "spriteStageV.c").c_str(), GL_VERTEX_SHADER, "spriteStageV");
+        ctx.assets->loadShaderStage((shaders + "spriteBatchStageV.c").c_str(), GL_VERTEX_SHADER, "spriteBatchStageV");
+        ctx.assets->loadShaderStage((shaders + "spriteStageF.c").c_str(), GL_FRAGMENT_SHADER, "spriteStageF");
+        ctx.assets->loadShaderPipeline("spriteStageV", "spriteStageF", "spriteUV", SHADER_TYPE::SPRITE);
+        ctx.assets->loadShaderPipeline("spriteBatchStageV", "spriteStageF", "spriteBatchUV", SHADER_TYPE::SPRITE);
+    }
+    else
+    {
+        ctx.assets->queueShaders((shaders + "spriteUVV.c").c_str(), (shaders + "spriteUVF.c").c_str(), nullptr, "spriteUV", SHADER_TYPE::SPRITE);
+        ctx.assets->queueShaders((shaders + "spriteBatchUVV.c").c_str(), (shaders + "spriteBatchUVF.c").c_str(), nullptr, "spriteBatchUV", SHADER_TYPE::SPRITE);
+    }
+    ctx.assets->queueShaders((shaders + "textV.c").c_str(), (shaders + "textF.c").c_str(), nullptr, "text", SHADER_TYPE::TEXT);
+    ctx.assets->queueShaders((shaders + "lineV.c").c_str(), (shaders + "lineF.c").c_str(), nullptr, "line", SHADER_TYPE::LINE);
+    ctx.assets->queueShaders((shaders + "pointV.c").c_str(), (shaders + "pointF.c").c_str(), nullptr, "point", SHADER_TYPE::PIXEL);
+    ctx.assets->queueShaders((shaders + "pixelBatchV.c").c_str(), (shaders + "pixelBatchF.c").c_str(), nullptr, "pixelBatch", SHADER_TYPE::PIXEL);
+    ctx.assets->queueShaders((shaders + "lineBatchV.c").c_str(), (shaders + "lineBatchF.c").c_str(), nullptr, "lineBatch", SHADER_TYPE::LINE);
+    ctx.assets->queueShaders((shaders + "bitmapTextBatchV.c").c_str(), (shaders + "bitmapTextBatchF.c").c_str(), nullptr, "bitmapTextBatch", SHADER_TYPE::SPRITE);
+    ctx.assets->compileQueuedShaders();
+    // Compile times are not part of any scene
+    ctx.assets->finishPendingShaders();
+
+    ctx.camera = std::make_unique<SGL_Camera>(ctx.oglm);
+    ctx.camera->initialize(ctx.width, ctx.height);
+    applyCamera(ctx);
+
+    ctx.renderer = std::make_unique<SGL_Renderer>(ctx.oglm, ctx.assets->getTexture(SGL::DEFAULT_TEXTURE_NAME), ctx.assets->getShader("line"),
+                                                  ctx.assets->getShader("point"), ctx.assets->getShader("text"), ctx.assets->getShader("spriteUV"),
+                                                  ctx.assets->getShader("spriteBatchUV"), ctx.assets->getShader("pixelBatch"), ctx.assets->getShader("lineBatch"));
+    ctx.renderer->setBitmapTextBatchShader(ctx.assets->getShader("bitmapTextBatch"));
+    ctx.renderer->setAssetManager(ctx.assets.get());
+}
+
+/**
+ * @brief Builds the scenes, the data is generated once so only the submission is measured
+ *
+ * @param ctx Context the scenes draw with
+ * @param count Sprites per frame
+ * @return std::vector<BenchScene>
+ */
+static std::vector<BenchScene> createScenes(BenchContext &ctx, std::size_t count)
+{
+    std::vector<BenchScene> scenes;
+    const float w = static_cast<float>(ctx.width), h = static_cast<float>(ctx.height);
+    // Deterministic positions, every run draws exactly the same frames
+    auto scatter = [w, h](std::size_t i, std::size_t n) {
+        const float t = static_cast<float>(i) / static_cast<float>(std::max<std::size_t>(n, 1));
+        return glm::vec2(std::fmod(t * 7919.0f * w, w), std::fmod(t * 104729.0f * h, h));
+    };
+
+    SGL_Sprite sprite;
+    sprite.texture = ctx.assets->getTexture(SGL::DEFAULT_TEXTURE_NAME);
+    sprite.shader = ctx.assets->getShader("spriteUV");
+    sprite.size = glm::vec2(16.0f, 16.0f);
+    sprite.blending = BLENDING_TYPE::SPRITE_RENDERING;
+    sprite.resetUVCoords();
+
+    // N immediate sprites, one draw each
+    auto positions = std::make_shared<std::vector<glm::vec2>>(count);
+    for (std::size_t i = 0; i < count; ++i)
+        (*positions)[i] = scatter(i, count);
+    scenes.push_back({"sprites_immediate", count, [sprite, positions](BenchContext &c) mutable {
+                for (const glm::vec2 &position : *positions)
+                {
+                    sprite.position = position;
+                    c.renderer->renderSprite(sprite);
+                }
+            }});
+
+    // N batched sprites, model matrices are built by the batch renderer
+    SGL_Sprite batchSprite = sprite;
+    batchSprite.shader = ctx.assets->getShader("spriteBatchUV");
+    auto sizes = std::make_shared<std::vector<glm::vec2>>(count, glm::vec2(16.0f, 16.0f));
+    auto rotations = std::make_shared<std::vector<float>>(count);
+    for (std::size_t i = 0; i < count; ++i)
+        (*rotations)[i] = static_cast<float>(i % 628) / 100.0f;
+    scenes.push_back({"sprites_batched", count, [batchSprite, positions, sizes, rotations](BenchContext &c) {
+                // Batches are clamped to MAX_SPRITE_BATCH_INSTANCES, submit in chunks like an application would
+                for (std::size_t first = 0; first < positions->size(); first += SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES)
+                {
+                    const std::size_t chunk = std::min<std::size_t>(positions->size() - first, SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES);
+                    c.renderer->renderSpriteBatch(batchSprite, positions->data() + first, sizes->data() + first, rotations->data() + first, chunk);
+                }
+            }});
+
+    // N immediate sprites cycling textures every sprite and blend modes every few sprites
+    std::vector<SGL_Texture> textures = {ctx.assets->getTexture(SGL::DEFAULT_TEXTURE_NAME), ctx.assets->getTexture("box"),
+                                         ctx.assets->getTexture("defaultBitmapFont")};
+    const std::vector<BLENDING_TYPE> blends = {BLENDING_TYPE::SPRITE_RENDERING, BLENDING_TYPE::DEFAULT_RENDERING,
+                                               BLENDING_TYPE::PARTICLE_RENDERING, BLENDING_TYPE::NONE};
+    scenes.push_back({"sprites_mixed", count, [sprite, positions, textures, blends](BenchContext &c) mutable {
+                for (std::size_t i = 0; i < positions->size(); ++i)
+                {
+                    sprite.position = (*positions)[i];
+                    sprite.texture = textures[i % textures.size()];
+                    sprite.blending = blends[(i / 8) % blends.size()];
+                    c.renderer->renderSprite(sprite);
+                }
+            }});
+
+    // Text heavy HUD, a screen of bitmap text drawn as instanced glyphs
+    SGL_Bitmap_Text hud;
+    hud.texture = ctx.assets->getTexture("defaultBitmapFont");
+    hud.shader = ctx.assets->getShader("spriteUV");
+    hud.scale = 8;
+    hud.position = glm::vec2(4.0f, 4.0f);
+    const std::string line = "HP 100/100 MP 42/50 XP 123456 GOLD 9999 POS 1024,768 FPS 60.0\n";
+    std::size_t glyphs = 0;
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        hud.text += line;
+        glyphs += line.size() - 1;
+    }
+    scenes.push_back({"text_hud", glyphs, [hud](BenchContext &c) {
+                c.renderer->renderBitmapTextBatch(hud);
+            }});
+
+    // Thousands of immediate lines
+    const std::size_t lineCount = std::max<std::size_t>(count / 4, 1);
+    auto lines = std::make_shared<std::vector<SGL_Line>>(lineCount);
+    for (std::size_t i = 0; i < lineCount; ++i)
+    {
+        SGL_Line &l = (*lines)[i];
+        l.positionA = scatter(i, lineCount);
+        l.positionB = scatter(lineCount - i - 1, lineCount);
+        l.color = SGL_Color(1.0f, 0.5f, 0.0f, 1.0f);
+        l.shader = ctx.assets->getShader("line");
+        l.blending = BLENDING_TYPE::DEFAULT_RENDERING;
+    }
+    scenes.push_back({"lines", lineCount, [lines](BenchContext &c) {
+                for (const SGL_Line &l : *lines)
+                    c.renderer->renderLine(l);
+            }});
+
+    // Pixel cloud, batched
+    const std::size_t pixelCount = count * 4;
+    auto pixelsX = std::make_shared<std::vector<float>>(pixelCount);
+    auto pixelsY = std::make_shared<std::vector<float>>(pixelCount);
+    for (std::size_t i = 0; i < pixelCount; ++i)
+    {
+        const glm::vec2 position = scatter(i, pixelCount);
+        (*pixelsX)[i] = position.x;
+        (*pixelsY)[i] = position.y;
+    }
+    SGL_Pixel pixel;
+    pixel.color = SGL_Color(0.0f, 1.0f, 0.5f, 1.0f);
+    pixel.shader = ctx.assets->getShader("pixelBatch");
+    pixel.blending = BLENDING_TYPE::DEFAULT_RENDERING;
+    scenes.push_back({"pixel_cloud", pixelCount, [pixel, pixelsX, pixelsY](BenchContext &c) {
+                for (std::size_t first = 0; first < pixelsX->size(); first += SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES)
+                {
+                    const std::size_t chunk = std::min<std::size_t>(pixelsX->size() - first, SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES);
+                    c.renderer->renderPixelBatch(pixel, pixelsX->data() + first, pixelsY->data() + first, chunk);
+                }
+            }});
+
+    return scenes;
+}
+
+/**
+ * @brief Runs a scene and gathers its results
+ *
+ * @param ctx Context
+ * @param scene Scene to run
+ * @param options Command line options
+ * @return BenchResult
+ */
+static BenchResult runScene(BenchContext &ctx, const BenchScene &scene, const BenchOptions &options)
+{
+    typedef std::chrono::duration<double, std::milli> milliseconds;
+    SGL_FrameStats stats(options.frames);
+    std::uint64_t draws = 0, stateChanges = 0, uniforms = 0, bytes = 0;
+
+    for (std::size_t frame = 0; frame < options.warmup + options.frames; ++frame)
+    {
+        const bool measured = (frame >= options.warmup);
+        if (frame == options.warmup && ctx.recording != nullptr)
+            ctx.recording->reset();
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        scene.draw(ctx);
+        ctx.renderer->flushIndirectBatches();
+        std::chrono::steady_clock::time_point submitted = std::chrono::steady_clock::now();
+        if (ctx.window != nullptr)
+            SDL_GL_SwapWindow(ctx.window);
+        ctx.oglm->fenceFrame();
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        ctx.oglm->endFrameCounters();
+
+        if (!measured)
+            continue;
+        SGL_FrameSample sample;
+        sample.frameMs = milliseconds(end - start).count();
+        sample.updateMs = 0.0;
+        sample.renderMs = milliseconds(submitted - start).count();
+        sample.swapMs = milliseconds(end - submitted).count();
+        stats.push(sample);
+
+        const SGL_FrameCounters &counters = ctx.oglm->getFrameCounters();
+        draws += counters.drawCalls;
+        stateChanges += counters.programSwitches + counters.textureBinds + counters.bufferBinds + counters.vaoBinds +
+            counters.fboBinds + counters.blendChanges + counters.capabilityChanges;
+        uniforms += counters.uniformUpdates;
+        bytes += counters.bytesUploaded;
+    }
+    // Leave nothing in flight for the next scene
+    ctx.oglm->finishFrames();
+
+    const double frames = static_cast<double>(options.frames);
+    BenchResult result;
+    result.name = scene.name;
+    result.items = scene.items;
+    result.report = stats.report();
+    result.cpuNsPerItem = result.report.render.meanMs * 1e6 / static_cast<double>(std::max<std::size_t>(scene.items, 1));
+    result.drawsPerFrame = draws / frames;
+    result.stateChangesPerFrame = stateChanges / frames;
+    result.uniformsPerFrame = uniforms / frames;
+    result.bytesPerFrame = bytes / frames;
+    result.glCallsPerFrame = (ctx.recording != nullptr) ? ctx.recording->stats().totalCalls / frames : 0.0;
+    result.baselineNsPerItem = 0.0;
+    return result;
+}
+
+/**
+ * @brief Reads cpuNsPerItem of every scene of a previous run
+ * @section DESCRIPTION
+ *
+ * Only reads files written by this program, every scene is a single line.
+ *
+ * @param path Baseline file
+ * @param results Results to annotate
+ * @return bool False if the file couldn't be read
+ */
+static bool readBaseline(const std::string &path, std::vector<BenchResult> &results)
+{
+    std::ifstream file(path);
+    if (!file)
+        return false;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        for (BenchResult &result : results)
+        {
+            if (line.find("\"name\":\"" + result.name + "\"") == std::string::npos)
+                continue;
+            const std::string key = "\"cpuNsPerItem\":";
+            std::size_t pos = line.find(key);
+            if (pos != std::string::npos)
+                result.baselineNsPerItem = std::strtod(line.c_str() + pos + key.size(), nullptr);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the results as JSON, one scene per line
+ *
+ * @param out Stream
+ * @param options Command line options
+ * @param results Scene results
+ * @return nothing
+ */
+static void writeJSON(std::ostream &out, const BenchOptions &options, const std::vector<BenchResult> &results)
+{
+    out << "{\n\"backend\":\"" << (options.native ? "native" : "recording") << "\",\n"
+        << "\"count\":" << options.count << ",\n\"frames\":" << options.frames << ",\n\"scenes\":[\n";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchResult &r = results[i];
+        out << "{\"name\":\"" << r.name << "\",\"items\":" << r.items << ",\"cpuNsPerItem\":" << r.cpuNsPerItem
+            << ",\"drawsPerFrame\":" << r.drawsPerFrame << ",\"stateChangesPerFrame\":" << r.stateChangesPerFrame
+            << ",\"uniformsPerFrame\":" << r.uniformsPerFrame << ",\"bytesPerFrame\":" << r.bytesPerFrame
+            << ",\"glCallsPerFrame\":" << r.glCallsPerFrame;
+        const SGL_FrameTimeSummary *phases[] = {&r.report.render, &r.report.frame};
+        const char *names[] = {"cpuMs", "frameMs"};
+        for (int p = 0; p < 2; ++p)
+            out << ",\"" << names[p] << "\":{\"mean\":" << phases[p]->meanMs << ",\"p50\":" << phases[p]->p50Ms
+                << ",\"p95\":" << phases[p]->p95Ms << ",\"p99\":" << phases[p]->p99Ms << ",\"max\":" << phases[p]->maxMs << "}";
+        if (r.baselineNsPerItem > 0.0)
+            out << ",\"baselineNsPerItem\":" << r.baselineNsPerItem
+                << ",\"changePercent\":" << (r.cpuNsPerItem / r.baselineNsPerItem - 1.0) * 100.0;
+        out << "}" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "]\n}\n";
+}
+
+int main(int argc, char **argv)
+{
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return 2;
+    }
+    // Keep stdout clean for the JSON
+    SGL_STDOUT_FILTER = LOG_LEVEL::ERROR;
+
+    BenchContext ctx;
+    std::vector<BenchResult> results;
+    bool idleCheck = false;
+    try
+    {
+        createContext(options, ctx);
+        createRenderer(ctx);
+        idleCheck = checkIdleFrameHash(ctx);
+        for (const BenchScene &scene : createScenes(ctx, options.count))
+        {
+            if (!options.scenes.empty() && std::find(options.scenes.begin(), options.scenes.end(), scene.name) == options.scenes.end())
+                continue;
+            results.push_back(runScene(ctx, scene, options));
+        }
+    }
+    catch (const SGL_Exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+
+    if (!options.baseline.empty() && !readBaseline(options.baseline, results))
+    {
+        std::cerr << "sgl_bench | Unable to read the baseline " << options.baseline << std::endl;
+        return 2;
+    }
+
+    if (options.out == "-")
+        writeJSON(std::cout, options, results);
+    else
+    {
+        std::ofstream file(options.out);
+        writeJSON(file, options, results);
+        if (!file)
+        {
+            std::cerr << "sgl_bench | Unable to write " << options.out << std::endl;
+            return 2;
+        }
+    }
+
+    // Human readable summary, regressions and a failed idle check decide the exit code
+    int status = idleCheck ? 0 : 1;
+    for (const BenchResult &r : results)
+    {
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-18s %8zu items %9.2f ns/item %8.1f draws %8.1f states  frame p50 %.3f p99 %.3f ms",
+                      r.name.c_str(), r.items, r.cpuNsPerItem, r.drawsPerFrame, r.stateChangesPerFrame,
+                      r.report.frame.p50Ms, r.report.frame.p99Ms);
+        std::cerr << line;
+        if (r.baselineNsPerItem > 0.0)
+        {
+            const double change = (r.cpuNsPerItem / r.baselineNsPerItem - 1.0) * 100.0;
+            std::snprintf(line, sizeof(line), "  %+.1f%%", change);
+            std::cerr << line;
+            if (change > options.tolerance)
+            {
+                std::cerr << " REGRESSION";
+                status = 1;
+            }
+        }
+        std::cerr << "\n";
+    }
+
+    ctx.renderer.reset();
+    ctx.camera.reset();
+    ctx.assets.reset();
+    ctx.oglm.reset();
+    if (ctx.context != nullptr)
+        SDL_GL_DeleteContext(ctx.context);
+    if (ctx.window != nullptr)
+    {
+        SDL_DestroyWindow(ctx.window);
+        SDL_Quit();
+    }
+    return status;
+}
@@ -0,0 +1,50 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/renderer/SGL_GLBackend.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Interface between SGL_OpenGLManager and the OpenGL entry points
+ *
+ * @section DESCRIPTION
+ *
+ * See SGL_GLBackend.hpp
+ */
+
+#include "SGL_GLBackend.hpp"
+
+/**
+ * @brief Features of the current context, GLEW must be initialized
+ * @return SGL_GLFeatures
+ */
+SGL_GLFeatures SGL_NativeGLBackend::features() const noexcept
+{
+    SGL_GLFeatures features;
+    // Core since the listed version, the extensions cover older drivers
+    features.multiDrawIndirect = GLEW_VERSION_4_3 || GLEW_ARB_multi_draw_indirect;
+    features.computeShaders = GLEW_VERSION_4_3 || (GLEW_ARB_compute_shader && GLEW_ARB_shader_storage_buffer_object);
+    features.separablePrograms = GLEW_VERSION_4_1 || GLEW_ARB_separate_shader_objects;
+    features.programBinaries = GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary;
+    features.directStateAccess = GLEW_VERSION_4_5 || GLEW_ARB_direct_state_access;
+    features.parallelShaderCompile = GLEW_KHR_parallel_shader_compile;
+    features.fenceSync = GLEW_VERSION_3_2 || GLEW_ARB_sync;
+    features.debugOutput = GLEW_VERSION_4_3 || GLEW_KHR_debug;
+    features.timerQuery = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+    return features;
+}
+
+// Every entry point forwards its arguments to the GL function of the same name
+#define SGL_GL_ENTRY_NATIVE(recording, category, ret, method, glName, params, args) \
+    ret SGL_NativeGLBackend::method params { return glName args; }
+SGL_GL_ENTRY_POINTS(SGL_GL_ENTRY_NATIVE)
+#undef SGL_GL_ENTRY_NATIVE
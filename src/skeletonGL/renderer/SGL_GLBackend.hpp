@@ -0,0 +1,256 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/renderer/SGL_GLBackend.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Interface between SGL_OpenGLManager and the OpenGL entry points
+ *
+ * @section DESCRIPTION
+ *
+ * Every GL function the manager uses is listed once in SGL_GL_ENTRY_POINTS, the backend
+ * interface, the native backend and the recording backend are all generated from that list.
+ * A new GL call only needs a new line there (and a recording implementation if it returns
+ * data or creates objects).
+ */
+
+#ifndef SRC_SKELETONGL_RENDERER_GLBACKEND_HPP
+#define SRC_SKELETONGL_RENDERER_GLBACKEND_HPP
+
+// C++
+#include <cstdint>
+// Dependencies
+#include <GL/glew.h>
+
+/**
+ * @brief Every OpenGL entry point used by SGL_OpenGLManager
+ * @section DESCRIPTION
+ *
+ * X(recording, category, return type, method, GL function, (parameters), (arguments))
+ * AUTO entries are recorded generically, CUSTOM entries have a hand written recording
+ * implementation because they create objects, upload data or return something.
+ */
+#define SGL_GL_ENTRY_POINTS(X) \
+    /* CREATE */ \
+    X(CUSTOM, CALL_CREATE, void, createBuffers, glCreateBuffers, (GLsizei n, GLuint *buffers), (n, buffers)) \
+    X(CUSTOM, CALL_CREATE, void, createFramebuffers, glCreateFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers)) \
+    X(CUSTOM, CALL_CREATE, GLuint, createProgram, glCreateProgram, (), ()) \
+    X(CUSTOM, CALL_CREATE, GLuint, createShader, glCreateShader, (GLenum type), (type)) \
+    X(CUSTOM, CALL_CREATE, GLuint, createShaderProgramv, glCreateShaderProgramv, (GLenum type, GLsizei count, const GLchar *const *strings), (type, count, strings)) \
+    X(CUSTOM, CALL_CREATE, void, createVertexArrays, glCreateVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays)) \
+    X(CUSTOM, CALL_CREATE, void, genBuffers, glGenBuffers, (GLsizei n, GLuint *buffers), (n, buffers)) \
+    X(CUSTOM, CALL_CREATE, void, genFramebuffers, glGenFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers)) \
+    X(CUSTOM, CALL_CREATE, void, genProgramPipelines, glGenProgramPipelines, (GLsizei n, GLuint *pipelines), (n, pipelines)) \
+    X(CUSTOM, CALL_CREATE, void, genQueries, glGenQueries, (GLsizei n, GLuint *ids), (n, ids)) \
+    X(CUSTOM, CALL_CREATE, void, genRenderbuffers, glGenRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers)) \
+    X(CUSTOM, CALL_CREATE, void, genTextures, glGenTextures, (GLsizei n, GLuint *textures), (n, textures)) \
+    X(CUSTOM, CALL_CREATE, void, genVertexArrays, glGenVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays)) \
+    /* DELETE */ \
+    X(CUSTOM, CALL_DELETE, void, deleteBuffers, glDeleteBuffers, (GLsizei n, const GLuint *buffers), (n, buffers)) \
+    X(CUSTOM, CALL_DELETE, void, deleteFramebuffers, glDeleteFramebuffers, (GLsizei n, const GLuint *framebuffers), (n, framebuffers)) \
+    X(CUSTOM, CALL_DELETE, void, deleteProgram, glDeleteProgram, (GLuint program), (program)) \
+    X(CUSTOM, CALL_DELETE, void, deleteProgramPipelines, glDeleteProgramPipelines, (GLsizei n, const GLuint *pipelines), (n, pipelines)) \
+    X(CUSTOM, CALL_DELETE, void, deleteQueries, glDeleteQueries, (GLsizei n, const GLuint *ids), (n, ids)) \
+    X(CUSTOM, CALL_DELETE, void, deleteRenderbuffers, glDeleteRenderbuffers, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers)) \
+    X(CUSTOM, CALL_DELETE, void, deleteShader, glDeleteShader, (GLuint shader), (shader)) \
+    X(CUSTOM, CALL_DELETE, void, deleteTextures, glDeleteTextures, (GLsizei n, const GLuint *textures), (n, textures)) \
+    X(CUSTOM, CALL_DELETE, void, deleteVertexArrays, glDeleteVertexArrays, (GLsizei n, const GLuint *arrays), (n, arrays)) \
+    /* STATE */ \
+    X(AUTO, CALL_STATE, void, activeShaderProgram, glActiveShaderProgram, (GLuint pipeline, GLuint program), (pipeline, program)) \
+    X(AUTO, CALL_STATE, void, activeTexture, glActiveTexture, (GLenum texture), (texture)) \
+    X(AUTO, CALL_STATE, void, beginQuery, glBeginQuery, (GLenum target, GLuint id), (target, id)) \
+    X(AUTO, CALL_STATE, void, bindBuffer, glBindBuffer, (GLenum target, GLuint buffer), (target, buffer)) \
+    X(AUTO, CALL_STATE, void, bindBufferBase, glBindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer)) \
+    X(AUTO, CALL_STATE, void, bindFramebuffer, glBindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer)) \
+    X(AUTO, CALL_STATE, void, bindProgramPipeline, glBindProgramPipeline, (GLuint pipeline), (pipeline)) \
+    X(AUTO, CALL_STATE, void, bindRenderbuffer, glBindRenderbuffer, (GLenum target, GLuint renderbuffer), (target, renderbuffer)) \
+    X(AUTO, CALL_STATE, void, bindTexture, glBindTexture, (GLenum target, GLuint texture), (target, texture)) \
+    X(AUTO, CALL_STATE, void, bindVertexArray, glBindVertexArray, (GLuint array), (array)) \
+    X(AUTO, CALL_STATE, void, bindVertexBuffer, glBindVertexBuffer, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride)) \
+    X(AUTO, CALL_STATE, void, blendColor, glBlendColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha)) \
+    X(AUTO, CALL_STATE, void, blendFunc, glBlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor)) \
+    X(AUTO, CALL_STATE, void, clearColor, glClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha)) \
+    X(AUTO, CALL_STATE, void, depthMask, glDepthMask, (GLboolean flag), (flag)) \
+    X(AUTO, CALL_STATE, void, disable, glDisable, (GLenum cap), (cap)) \
+    X(AUTO, CALL_STATE, void, enable, glEnable, (GLenum cap), (cap)) \
+    X(AUTO, CALL_STATE, void, enableVertexAttribArray, glEnableVertexAttribArray, (GLuint index), (index)) \
+    X(AUTO, CALL_STATE, void, endQuery, glEndQuery, (GLenum target), (target)) \
+    X(AUTO, CALL_STATE, void, framebufferRenderbuffer, glFramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer)) \
+    X(AUTO, CALL_STATE, void, framebufferTexture2D, glFramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level)) \
+    X(AUTO, CALL_STATE, void, lineWidth, glLineWidth, (GLfloat width), (width)) \
+    X(AUTO, CALL_STATE, void, pixelStorei, glPixelStorei, (GLenum pname, GLint param), (pname, param)) \
+    X(AUTO, CALL_STATE, void, pointSize, glPointSize, (GLfloat size), (size)) \
+    X(AUTO, CALL_STATE, void, renderbufferStorage, glRenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height)) \
+    X(AUTO, CALL_STATE, void, texParameterf, glTexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param)) \
+    X(AUTO, CALL_STATE, void, texParameteri, glTexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param)) \
+    X(AUTO, CALL_STATE, void, textureParameteri, glTextureParameteri, (GLuint texture, GLenum pname, GLint param), (texture, pname, param)) \
+    X(AUTO, CALL_STATE, void, useProgram, glUseProgram, (GLuint program), (program)) \
+    X(AUTO, CALL_STATE, void, useProgramStages, glUseProgramStages, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program)) \
+    X(AUTO, CALL_STATE, void, vertexAttribBinding, glVertexAttribBinding, (GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex)) \
+    X(AUTO, CALL_STATE, void, vertexAttribDivisor, glVertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor)) \
+    X(AUTO, CALL_STATE, void, vertexAttribFormat, glVertexAttribFormat, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset)) \
+    X(AUTO, CALL_STATE, void, vertexAttribPointer, glVertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer)) \
+    X(AUTO, CALL_STATE, void, vertexBindingDivisor, glVertexBindingDivisor, (GLuint bindingindex, GLuint divisor), (bindingindex, divisor)) \
+    X(AUTO, CALL_STATE, void, viewport, glViewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height)) \
+    /* UNIFORM */ \
+    X(AUTO, CALL_UNIFORM, void, programUniform1f, glProgramUniform1f, (GLuint program, GLint location, GLfloat v0), (program, location, v0)) \
+    X(AUTO, CALL_UNIFORM, void, programUniform1i, glProgramUniform1i, (GLuint program, GLint location, GLint v0), (program, location, v0)) \
+    X(AUTO, CALL_UNIFORM, void, programUniform2f, glProgramUniform2f, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1)) \
+    X(AUTO, CALL_UNIFORM, void, programUniform3f, glProgramUniform3f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2)) \
+    X(AUTO, CALL_UNIFORM, void, programUniform4f, glProgramUniform4f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3)) \
+    X(AUTO, CALL_UNIFORM, void, programUniformMatrix4fv, glProgramUniformMatrix4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value)) \
+    X(AUTO, CALL_UNIFORM, void, uniform1f, glUniform1f, (GLint location, GLfloat v0), (location, v0)) \
+    X(AUTO, CALL_UNIFORM, void, uniform1fv, glUniform1fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value)) \
+    X(AUTO, CALL_UNIFORM, void, uniform1i, glUniform1i, (GLint location, GLint v0), (location, v0)) \
+    X(AUTO, CALL_UNIFORM, void, uniform1iv, glUniform1iv, (GLint location, GLsizei count, const GLint *value), (location, count, value)) \
+    X(AUTO, CALL_UNIFORM, void, uniform2f, glUniform2f, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1)) \
+    X(AUTO, CALL_UNIFORM, void, uniform2fv, glUniform2fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value)) \
+    X(AUTO, CALL_UNIFORM, void, uniform3f, glUniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2)) \
+    X(AUTO, CALL_UNIFORM, void, uniform4f, glUniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3)) \
+    X(AUTO, CALL_UNIFORM, void, uniformMatrix4fv, glUniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value)) \
+    /* UPLOAD */ \
+    X(CUSTOM, CALL_UPLOAD, void, bufferData, glBufferData, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage)) \
+    X(CUSTOM, CALL_UPLOAD, void, bufferSubData, glBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data)) \
+    X(CUSTOM, CALL_UPLOAD, void, namedBufferSubData, glNamedBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data)) \
+    X(CUSTOM, CALL_UPLOAD, void, texImage2D, glTexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels)) \
+    X(CUSTOM, CALL_UPLOAD, void *, mapBufferRange, glMapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access)) \
+    X(CUSTOM, CALL_UPLOAD, GLboolean, unmapBuffer, glUnmapBuffer, (GLenum target), (target)) \
+    /* DRAW */ \
+    X(AUTO, CALL_DRAW, void, blitFramebuffer, glBlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter)) \
+    X(AUTO, CALL_DRAW, void, clear, glClear, (GLbitfield mask), (mask)) \
+    X(AUTO, CALL_DRAW, void, dispatchCompute, glDispatchCompute, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z)) \
+    X(AUTO, CALL_DRAW, void, drawArrays, glDrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count)) \
+    X(AUTO, CALL_DRAW, void, drawArraysIndirect, glDrawArraysIndirect, (GLenum mode, const void *indirect), (mode, indirect)) \
+    X(AUTO, CALL_DRAW, void, drawArraysInstanced, glDrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount)) \
+    X(AUTO, CALL_DRAW, void, drawArraysInstancedBaseInstance, glDrawArraysInstancedBaseInstance, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance)) \
+    X(AUTO, CALL_DRAW, void, drawElementsInstanced, glDrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount)) \
+    X(AUTO, CALL_DRAW, void, multiDrawArraysIndirect, glMultiDrawArraysIndirect, (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride)) \
+    X(AUTO, CALL_DRAW, void, multiDrawElementsIndirect, glMultiDrawElementsIndirect, (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride)) \
+    /* SHADER */ \
+    X(AUTO, CALL_SHADER, void, attachShader, glAttachShader, (GLuint program, GLuint shader), (program, shader)) \
+    X(AUTO, CALL_SHADER, void, compileShader, glCompileShader, (GLuint shader), (shader)) \
+    X(AUTO, CALL_SHADER, void, linkProgram, glLinkProgram, (GLuint program), (program)) \
+    X(AUTO, CALL_SHADER, void, maxShaderCompilerThreadsKHR, glMaxShaderCompilerThreadsKHR, (GLuint count), (count)) \
+    X(AUTO, CALL_SHADER, void, programBinary, glProgramBinary, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length)) \
+    X(AUTO, CALL_SHADER, void, programParameteri, glProgramParameteri, (GLuint program, GLenum pname, GLint value), (program, pname, value)) \
+    X(AUTO, CALL_SHADER, void, shaderSource, glShaderSource, (GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length), (shader, count, string, length)) \
+    X(AUTO, CALL_SHADER, void, validateProgramPipeline, glValidateProgramPipeline, (GLuint pipeline), (pipeline)) \
+    /* QUERY */ \
+    X(CUSTOM, CALL_QUERY, GLenum, checkFramebufferStatus, glCheckFramebufferStatus, (GLenum target), (target)) \
+    X(CUSTOM, CALL_QUERY, GLenum, getError, glGetError, (), ()) \
+    X(CUSTOM, CALL_QUERY, void, getIntegerv, glGetIntegerv, (GLenum pname, GLint *data), (pname, data)) \
+    X(CUSTOM, CALL_QUERY, void, getProgramBinary, glGetProgramBinary, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary)) \
+    X(CUSTOM, CALL_QUERY, void, getProgramInfoLog, glGetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog)) \
+    X(CUSTOM, CALL_QUERY, void, getProgramPipelineInfoLog, glGetProgramPipelineInfoLog, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (pipeline, bufSize, length, infoLog)) \
+    X(CUSTOM, CALL_QUERY, void, getProgramPipelineiv, glGetProgramPipelineiv, (GLuint pipeline, GLenum pname, GLint *params), (pipeline, pname, params)) \
+    X(CUSTOM, CALL_QUERY, void, getProgramiv, glGetProgramiv, (GLuint program, GLenum pname, GLint *params), (program, pname, params)) \
+    X(CUSTOM, CALL_QUERY, void, getQueryObjectiv, glGetQueryObjectiv, (GLuint id, GLenum pname, GLint *params), (id, pname, params)) \
+    X(CUSTOM, CALL_QUERY, void, getQueryObjectui64v, glGetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params)) \
+    X(CUSTOM, CALL_QUERY, void, getShaderInfoLog, glGetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog)) \
+    X(CUSTOM, CALL_QUERY, void, getShaderiv, glGetShaderiv, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params)) \
+    X(CUSTOM, CALL_QUERY, GLint, getUniformLocation, glGetUniformLocation, (GLuint program, const GLchar *name), (program, name)) \
+    X(AUTO, CALL_QUERY, void, readPixels, glReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *data), (x, y, width, height, format, type, data)) \
+    /* SYNC */ \
+    X(CUSTOM, CALL_SYNC, GLenum, clientWaitSync, glClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout)) \
+    X(AUTO, CALL_SYNC, void, deleteSync, glDeleteSync, (GLsync sync), (sync)) \
+    X(CUSTOM, CALL_SYNC, GLsync, fenceSync, glFenceSync, (GLenum condition, GLbitfield flags), (condition, flags)) \
+    X(AUTO, CALL_SYNC, void, memoryBarrier, glMemoryBarrier, (GLbitfield barriers), (barriers)) \
+    /* DEBUG */ \
+    X(AUTO, CALL_DEBUG, void, debugMessageCallback, glDebugMessageCallback, (GLDEBUGPROC callback, const void *userParam), (callback, userParam)) \
+    X(AUTO, CALL_DEBUG, void, debugMessageControl, glDebugMessageControl, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled)) \
+    X(AUTO, CALL_DEBUG, void, objectLabel, glObjectLabel, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label))
+
+/**
+ * @brief Kind of work an entry point does, used to aggregate recorded calls
+ */
+enum class SGL_GL_CATEGORY : std::uint8_t
+{
+    CALL_CREATE,     ///< Object creation
+    CALL_DELETE,     ///< Object deletion
+    CALL_STATE,      ///< Binds, capabilities and fixed function state
+    CALL_UNIFORM,    ///< Uniform updates
+    CALL_UPLOAD,     ///< Buffer and texture data transfers
+    CALL_DRAW,       ///< Draws, dispatches, clears and blits
+    CALL_SHADER,     ///< Shader compilation and linking
+    CALL_QUERY,      ///< Queries that return data to the CPU
+    CALL_SYNC,       ///< Fences and barriers
+    CALL_DEBUG,      ///< Debug output and object labels
+    COUNT
+};
+
+/**
+ * @brief Identifies an entry point of SGL_GL_ENTRY_POINTS
+ */
+#define SGL_GL_ENTRY_ENUM(recording, category, ret, method, glName, params, args) method,
+enum class SGL_GL_CALL : std::uint16_t
+{
+    SGL_GL_ENTRY_POINTS(SGL_GL_ENTRY_ENUM)
+    COUNT
+};
+#undef SGL_GL_ENTRY_ENUM
+
+/**
+ * @brief Optional features the backend provides
+ * @section DESCRIPTION
+ *
+ * SGL_OpenGLManager picks its code paths from these instead of querying GLEW directly.
+ */
+struct SGL_GLFeatures
+{
+    bool multiDrawIndirect;      ///< GL 4.3 / ARB_multi_draw_indirect
+    bool computeShaders;         ///< GL 4.3 / ARB_compute_shader + ARB_shader_storage_buffer_object
+    bool separablePrograms;      ///< GL 4.1 / ARB_separate_shader_objects
+    bool programBinaries;        ///< GL 4.1 / ARB_get_program_binary, formats are checked separately
+    bool directStateAccess;      ///< GL 4.5 / ARB_direct_state_access
+    bool parallelShaderCompile;  ///< KHR_parallel_shader_compile
+    bool fenceSync;              ///< GL 3.2 / ARB_sync
+    bool debugOutput;            ///< GL 4.3 / KHR_debug
+    bool timerQuery;             ///< GL 3.3 / ARB_timer_query
+    SGL_GLFeatures() : multiDrawIndirect(false), computeShaders(false), separablePrograms(false), programBinaries(false),
+                       directStateAccess(false), parallelShaderCompile(false), fenceSync(false), debugOutput(false),
+                       timerQuery(false) {}
+};
+
+/**
+ * @brief Abstract OpenGL backend
+ * @section DESCRIPTION
+ *
+ * One virtual per entry point, named like the GL function without the gl prefix.
+ */
+class SGL_GLBackend
+{
+public:
+    virtual ~SGL_GLBackend() = default;
+
+    // Optional features available through this backend
+    virtual SGL_GLFeatures features() const noexcept = 0;
+
+#define SGL_GL_ENTRY_VIRTUAL(recording, category, ret, method, glName, params, args) virtual ret method params = 0;
+    SGL_GL_ENTRY_POINTS(SGL_GL_ENTRY_VIRTUAL)
+#undef SGL_GL_ENTRY_VIRTUAL
+};
+
+/**
+ * @brief Forwards every call to the current OpenGL context through GLEW
+ */
+class SGL_NativeGLBackend : public SGL_GLBackend
+{
+public:
+    SGL_GLFeatures features() const noexcept override;
+
+#define SGL_GL_ENTRY_NATIVE(recording, category, ret, method, glName, params, args) ret method params override;
+    SGL_GL_ENTRY_POINTS(SGL_GL_ENTRY_NATIVE)
+#undef SGL_GL_ENTRY_NATIVE
+};
+
+#endif // SRC_SKELETONGL_RENDERER_GLBACKEND_HPP
@@ -24,17 +24,150 @@
 
 #include "SGL_OpenGLManager.hpp"
 
+/**
+ * @brief Readable name of a glGetError code
+ *
+ * @param error Error code
+ * @return const char*
+ */
+static const char *sglGLErrorString(GLenum error) noexcept
+{
+    switch (error)
+    {
+    case GL_INVALID_ENUM: return "GL_INVALID_ENUM";
+    case GL_INVALID_VALUE: return "GL_INVALID_VALUE";
+    case GL_INVALID_OPERATION: return "GL_INVALID_OPERATION";
+    case GL_INVALID_FRAMEBUFFER_OPERATION: return "GL_INVALID_FRAMEBUFFER_OPERATION";
+    case GL_OUT_OF_MEMORY: return "GL_OUT_OF_MEMORY";
+    case GL_STACK_UNDERFLOW: return "GL_STACK_UNDERFLOW";
+    case GL_STACK_OVERFLOW: return "GL_STACK_OVERFLOW";
+    default: return "Unknown error";
+    }
+}
+
+/**
+ * @brief Readable name of a debug message type
+ *
+ * @param type GL_DEBUG_TYPE_*
+ * @return const char*
+ */
+static const char *sglDebugTypeString(GLenum type) noexcept
+{
+    switch (type)
+    {
+    case GL_DEBUG_TYPE_ERROR: return "ERROR";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "DEPRECATED";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "UNDEFINED BEHAVIOR";
+    case GL_DEBUG_TYPE_PORTABILITY: return "PORTABILITY";
+    case GL_DEBUG_TYPE_PERFORMANCE: return "PERFORMANCE";
+    case GL_DEBUG_TYPE_MARKER: return "MARKER";
+    default: return "OTHER";
+    }
+}
+
+/**
+ * @brief Readable name of a debug message severity
+ *
+ * @param severity GL_DEBUG_SEVERITY_*
+ * @return const char*
+ */
+static const char *sglDebugSeverityString(GLenum severity) noexcept
+{
+    switch (severity)
+    {
+    case GL_DEBUG_SEVERITY_HIGH: return "HIGH";
+    case GL_DEBUG_SEVERITY_MEDIUM: return "MEDIUM";
+    case GL_DEBUG_SEVERITY_LOW: return "LOW";
+    default: return "NOTIFICATION";
+    }
+}
+
+
+/**
+ * @brief Bytes of pixel data read by a texture upload
+ *
+ * @param width Image width
+ * @param height Image height
+ * @param format Pixel format
+ * @param type Pixel type
+ * @return std::uint64_t
+ */
+static std::uint64_t sglTextureBytes(GLsizei width, GLsizei height, GLenum format, GLenum type) noexcept
+{
+    std::uint64_t pixelSize;
+    switch (type)
+    {
+    case GL_UNSIGNED_BYTE: case GL_BYTE: pixelSize = 1; break;
+    case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: pixelSize = 2; break;
+    // Packed types hold the whole pixel
+    case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV: case GL_UNSIGNED_INT_2_10_10_10_REV: return 4ULL * width * height;
+    case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_5_5_5_1: return 2ULL * width * height;
+    default: pixelSize = 4; break;
+    }
+    switch (format)
+    {
+    case GL_RED: case GL_DEPTH_COMPONENT: break;
+    case GL_RG: pixelSize *= 2; break;
+    case GL_RGB: case GL_BGR: pixelSize *= 3; break;
+    default: pixelSize *= 4; break;
+    }
+    return pixelSize * width * height;
+}
+
 
 /**
  * @brief Main and only constructor
  *
+ * @param backend Receives every GL call, null selects the native driver
  * @return nothing
  */
-SGL_OpenGLManager::SGL_OpenGLManager()
+SGL_OpenGLManager::SGL_OpenGLManager(std::unique_ptr<SGL_GLBackend> backend)
+    : pGL(std::move(backend))
 {
+    if (!pGL)
+        pGL.reset(new SGL_NativeGLBackend());
     currentTextureID = 0;
     currentShaderID = 0;
     initialErrorCap = 0;
+    pHashFrames = false;
+    pLastFrameHash = 0;
+    this->resetFrameHash();
+    pFrameCounters = SGL_FrameCounters();
+    pLastFrameCounters = SGL_FrameCounters();
+    const SGL_GLFeatures features = pGL->features();
+    pMultiDrawIndirect = features.multiDrawIndirect;
+    pComputeShaders = features.computeShaders;
+    pSeparablePrograms = features.separablePrograms;
+    // Drivers may expose the entry points without supporting a single format
+    pProgramBinaries = false;
+    if (features.programBinaries)
+    {
+        GLint formats = 0;
+        pGL->getIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        pProgramBinaries = formats > 0;
+    }
+    // Edit objects by name instead of binding them first
+    pDirectStateAccess = features.directStateAccess;
+    // Let the driver pick how many threads compile in the background
+    pParallelShaderCompile = features.parallelShaderCompile;
+    if (pParallelShaderCompile)
+        pGL->maxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    pMappedData = nullptr;
+    pMappedSize = 0;
+    pOverdrawFBO = 0;
+    pFenceSync = features.fenceSync;
+    pFramesInFlight = 2;
+    pFramesFenced = 0;
+    pFramesRetired = 0;
+    // Off until enableDebugOutput(), glGetError polling is used instead
+    pDebugSupported = features.debugOutput;
+    pDebugOutput = false;
+    pDebugCallSite = {nullptr, nullptr, 0};
+    // Off until enableGPUTimers(), every timed scope costs a query
+    pGPUTimersSupported = features.timerQuery;
+    pGPUTimers = false;
+    pGPUTimerActive = false;
+    pGPUTimerFrame = 0;
 }
 
 /**
@@ -45,13 +178,21 @@ SGL_OpenGLManager::SGL_OpenGLManager()
 SGL_OpenGLManager::~SGL_OpenGLManager()
 {
     for (auto &iter : VBO)
-        deleteVBO(iter.second.name);
+        deferDeletion(GL_OBJECT_BUFFER, iter.second.ID);
     for (auto &iter : EBO)
-        deleteEBO(iter.second.name);
+        deferDeletion(GL_OBJECT_BUFFER, iter.second.ID);
     for (auto &iter : VAO)
-        deleteVAO(iter.second.name);
+        deferDeletion(GL_OBJECT_VERTEX_ARRAY, iter.second.ID);
     for (auto &iter : FBO)
-        deleteFBO(iter.second.name);
+        deferDeletion(GL_OBJECT_FRAMEBUFFER, iter.second.ID);
+    finishFrames();
+
+    // Queries are never in use once every frame finished
+    for (std::vector<GPUTimerQuery> &frame : pGPUTimerFrames)
+        for (const GPUTimerQuery &timer : frame)
+            pFreeQueries.push_back(timer.query);
+    if (!pFreeQueries.empty())
+        pGL->deleteQueries(static_cast<GLsizei>(pFreeQueries.size()), pFreeQueries.data());
 
     VBO.clear();
     VAO.clear();
@@ -76,7 +217,12 @@ void SGL_OpenGLManager::createVBO(const std::string &name) noexcept
     else
     {
         GLuint newVBO;
-        glGenBuffers(1, &newVBO);
+        // DSA creates the object right away instead of on first bind, so it can be labeled
+        if (pDirectStateAccess)
+            pGL->createBuffers(1, &newVBO);
+        else
+            pGL->genBuffers(1, &newVBO);
+        objectLabel(GL_BUFFER, newVBO, name);
         GLBuffer storeBuffer;
         storeBuffer.name = name;
         storeBuffer.ID = newVBO;
@@ -105,7 +251,11 @@ void SGL_OpenGLManager::createEBO(const std::string &name) noexcept
     else
     {
         GLuint newEBO;
-        glGenBuffers(1, &newEBO);
+        if (pDirectStateAccess)
+            pGL->createBuffers(1, &newEBO);
+        else
+            pGL->genBuffers(1, &newEBO);
+        objectLabel(GL_BUFFER, newEBO, name);
         GLBuffer storeBuffer;
         storeBuffer.name = name;
         storeBuffer.ID = newEBO;
@@ -135,7 +285,11 @@ void SGL_OpenGLManager::createVAO(const std::string &name) noexcept
     else
     {
         GLuint newVAO;
-        glGenVertexArrays(1, &newVAO);
+        if (pDirectStateAccess)
+            pGL->createVertexArrays(1, &newVAO);
+        else
+            pGL->genVertexArrays(1, &newVAO);
+        objectLabel(GL_VERTEX_ARRAY, newVAO, name);
         // SGL_OpenGLManager::pLog->print("New VAO: ", newVAO);
         GLBuffer storeBuffer;
         storeBuffer.name = name;
@@ -165,7 +319,11 @@ void SGL_OpenGLManager::createFBO(const std::string &name) noexcept
     else
     {
         GLuint newFBO;
-        glGenFramebuffers(1, &newFBO);
+        if (pDirectStateAccess)
+            pGL->createFramebuffers(1, &newFBO);
+        else
+            pGL->genFramebuffers(1, &newFBO);
+        objectLabel(GL_FRAMEBUFFER, newFBO, name);
         // SGL_OpenGLManager::pLog->print("New VAO: ", newFBO);
         GLBuffer storeBuffer;
         storeBuffer.name = name;
@@ -198,7 +356,9 @@ void SGL_OpenGLManager::bindVBO(const std::string &name) noexcept
         currentGLBuffers.currentVBO = VBO.at(name);
         //update currently bound VBO
         GLuint bufferToBind = SGL_OpenGLManager::currentGLBuffers.currentVBO.ID;
-        glBindBuffer(GL_ARRAY_BUFFER, bufferToBind);
+        hashFrameCall(BIND_VBO, bufferToBind);
+        pFrameCounters.bufferBinds++;
+        pGL->bindBuffer(GL_ARRAY_BUFFER, bufferToBind);
     }
 }
 
@@ -222,7 +382,9 @@ void SGL_OpenGLManager::bindEBO(const std::string &name) noexcept
         currentGLBuffers.currentEBO = EBO.at(name);
         //update currently bound VBO
         GLuint bufferToBind = SGL_OpenGLManager::currentGLBuffers.currentEBO.ID;
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferToBind);
+        hashFrameCall(BIND_EBO, bufferToBind);
+        pFrameCounters.bufferBinds++;
+        pGL->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferToBind);
     }
 }
 
@@ -246,7 +408,9 @@ void SGL_OpenGLManager::bindVAO(const std::string &name) noexcept
         currentGLBuffers.currentVAO = VAO.at(name);
         //update currently bound VBO
         GLuint bufferToBind = SGL_OpenGLManager::currentGLBuffers.currentVAO.ID;
-        glBindVertexArray(bufferToBind);
+        hashFrameCall(BIND_VAO, bufferToBind);
+        pFrameCounters.vaoBinds++;
+        pGL->bindVertexArray(bufferToBind);
     }
 }
 
@@ -268,25 +432,50 @@ void SGL_OpenGLManager::bindFBO(const std::string &name, GLCONSTANTS::FBO type)
     else
     {
         GLuint bufferToBind = FBO.at(name).ID;
+        hashFrameCall(BIND_FBO, bufferToBind, type);
+        pFrameCounters.fboBinds++;
         switch (type)
         {
         case GLCONSTANTS::RW:
-            glBindFramebuffer(GL_FRAMEBUFFER, bufferToBind);
+            pGL->bindFramebuffer(GL_FRAMEBUFFER, bufferToBind);
             currentGLBuffers.currentFBO_R = FBO.at(name);
             currentGLBuffers.currentFBO_W = FBO.at(name);
             break;
         case GLCONSTANTS::R:
-            glBindFramebuffer(GL_READ_FRAMEBUFFER, bufferToBind);
+            pGL->bindFramebuffer(GL_READ_FRAMEBUFFER, bufferToBind);
             currentGLBuffers.currentFBO_R = FBO.at(name);
             break;
         case GLCONSTANTS::W:
-            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, bufferToBind);
+            pGL->bindFramebuffer(GL_DRAW_FRAMEBUFFER, bufferToBind);
             currentGLBuffers.currentFBO_W = FBO.at(name);
             break;
         }
     }
 }
 
+/**
+ * @brief Binds a buffer as the GL_DRAW_INDIRECT_BUFFER
+ *
+ * @param name The buffer identifier, created with createVBO()
+ * @return nothing
+ */
+void SGL_OpenGLManager::bindDIBO(const std::string &name) noexcept
+{
+    if (VBO.find(name) == VBO.end())
+    {
+#ifdef SGL_OUTPUT_OPENGL_DETAILS
+        SGL_Log("ERROR: DIBO NOT FOUND: " + name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_CYAN);
+#endif
+    }
+    else
+    {
+        GLuint bufferToBind = VBO.at(name).ID;
+        hashFrameCall(BIND_VBO, GL_DRAW_INDIRECT_BUFFER, bufferToBind);
+        pFrameCounters.bufferBinds++;
+        pGL->bindBuffer(GL_DRAW_INDIRECT_BUFFER, bufferToBind);
+    }
+}
+
 /**
  * @brief Generates a texture
  *
@@ -296,7 +485,7 @@ void SGL_OpenGLManager::bindFBO(const std::string &name, GLCONSTANTS::FBO type)
  */
 void SGL_OpenGLManager::genTextures(GLsizei n, GLuint *textures) const noexcept
 {
-    glGenTextures(n, textures);
+    pGL->genTextures(n, textures);
 }
 
 
@@ -309,19 +498,22 @@ void SGL_OpenGLManager::genTextures(GLsizei n, GLuint *textures) const noexcept
  */
 void SGL_OpenGLManager::bindTexture(GLenum target, GLuint texture) const noexcept
 {
-    glBindTexture(target, texture);
+    hashFrameCall(BIND_TEXTURE, target, texture);
+    pFrameCounters.textureBinds++;
+    pGL->bindTexture(target, texture);
 }
 
 /**
- * @brief Deletes a texture
+ * @brief Deletes textures, they're freed once the GPU finished the current frame
  *
  * @param n Amount to delete
  * @param textures Texture ID
  * @return nothing
  */
-void SGL_OpenGLManager::deleteTextures(GLsizei n, const GLuint *textures) const noexcept
+void SGL_OpenGLManager::deleteTextures(GLsizei n, const GLuint *textures) noexcept
 {
-    glDeleteTextures(n, textures);
+    for (GLsizei i = 0; i < n; ++i)
+        deferDeletion(GL_OBJECT_TEXTURE, textures[i]);
 }
 
 /**
@@ -333,7 +525,24 @@ void SGL_OpenGLManager::deleteTextures(GLsizei n, const GLuint *textures) const
  */
 void SGL_OpenGLManager::pixelStorei(GLenum pname, GLint param) const noexcept
 {
-    glPixelStorei(pname, param);
+    pGL->pixelStorei(pname, param);
+}
+
+/**
+ * @brief Read a block of pixels from the bound read framebuffer
+ *
+ * @param x Left edge of the block
+ * @param y Bottom edge of the block
+ * @param width Block width
+ * @param height Block height
+ * @param format Pixel data format
+ * @param type Pixel data type
+ * @param data Client memory, or an offset into the pixel pack buffer if one is bound
+ * @return nothing
+ */
+void SGL_OpenGLManager::readPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *data) const noexcept
+{
+    pGL->readPixels(x, y, width, height, format, type, data);
 }
 
 /**
@@ -346,7 +555,7 @@ void SGL_OpenGLManager::pixelStorei(GLenum pname, GLint param) const noexcept
  */
 void SGL_OpenGLManager::texParameteri(GLenum target, GLenum pname, GLint param) const noexcept
 {
-    glTexParameteri(target, pname, param);
+    pGL->texParameteri(target, pname, param);
 }
 
 /**
@@ -359,7 +568,7 @@ void SGL_OpenGLManager::texParameteri(GLenum target, GLenum pname, GLint param)
  */
 void SGL_OpenGLManager::texParameterf(GLenum target, GLenum pname, GLfloat param) const noexcept
 {
-    glTexParameterf(target, pname, param);
+    pGL->texParameterf(target, pname, param);
 }
 
 
@@ -380,7 +589,15 @@ void SGL_OpenGLManager::texParameterf(GLenum target, GLenum pname, GLfloat param
  */
 void SGL_OpenGLManager::texImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *data) const noexcept
 {
-    glTexImage2D(target, level, internalformat, width, height, border, format, type, data);
+    // The pixels are hashed, not the pointer, a buffer reused for new contents must still change the hash
+    hashFrameCall(TEX_IMAGE, target, level, internalformat, width, height, format, type);
+    if (data != nullptr)
+    {
+        const std::uint64_t bytes = sglTextureBytes(width, height, format, type);
+        hashFrameData(data, bytes);
+        pFrameCounters.bytesUploaded += bytes;
+    }
+    pGL->texImage2D(target, level, internalformat, width, height, border, format, type, data);
 }
 
 
@@ -393,7 +610,7 @@ void SGL_OpenGLManager::texImage2D(GLenum target, GLint level, GLint internalfor
  */
 GLint SGL_OpenGLManager::getUniformLocation(GLuint program, const GLchar *name) const noexcept
 {
-    return glGetUniformLocation(program, name);
+    return pGL->getUniformLocation(program, name);
 }
 
 /**
@@ -405,7 +622,9 @@ GLint SGL_OpenGLManager::getUniformLocation(GLuint program, const GLchar *name)
  */
 void SGL_OpenGLManager::uniform1f(GLint location, GLfloat v0) const noexcept
 {
-    glUniform1f(location, v0);
+    hashFrameCall(UNIFORM, location, v0);
+    pFrameCounters.uniformUpdates++;
+    pGL->uniform1f(location, v0);
 }
 
 /**
@@ -417,7 +636,9 @@ void SGL_OpenGLManager::uniform1f(GLint location, GLfloat v0) const noexcept
  */
 void SGL_OpenGLManager::uniform1i(GLint location, GLint v0) const noexcept
 {
-    glUniform1i(location, v0);
+    hashFrameCall(UNIFORM, location, v0);
+    pFrameCounters.uniformUpdates++;
+    pGL->uniform1i(location, v0);
 }
 
 /**
@@ -430,7 +651,10 @@ void SGL_OpenGLManager::uniform1i(GLint location, GLint v0) const noexcept
  */
 void SGL_OpenGLManager::uniform1fv(GLint location, GLsizei count, const GLfloat *value) const noexcept
 {
-    glUniform1fv(location, count, value);
+    hashFrameCall(UNIFORM, location, count);
+    pFrameCounters.uniformUpdates++;
+    hashFrameData(value, sizeof(GLfloat) * count);
+    pGL->uniform1fv(location, count, value);
 }
 
 /**
@@ -443,7 +667,10 @@ void SGL_OpenGLManager::uniform1fv(GLint location, GLsizei count, const GLfloat
  */
 void SGL_OpenGLManager::uniform1iv(GLint location, GLsizei count, const GLint *value) const noexcept
 {
-    glUniform1iv(location, count, value);
+    hashFrameCall(UNIFORM, location, count);
+    pFrameCounters.uniformUpdates++;
+    hashFrameData(value, sizeof(GLint) * count);
+    pGL->uniform1iv(location, count, value);
 }
 
 /**
@@ -456,7 +683,10 @@ void SGL_OpenGLManager::uniform1iv(GLint location, GLsizei count, const GLint *v
  */
 void SGL_OpenGLManager::uniform2fv(GLint location, GLsizei count, const GLfloat *value) const noexcept
 {
-    glUniform2fv(location, count, value);
+    hashFrameCall(UNIFORM, location, count);
+    pFrameCounters.uniformUpdates++;
+    hashFrameData(value, sizeof(GLfloat) * 2 * count);
+    pGL->uniform2fv(location, count, value);
 }
 
 /**
@@ -469,7 +699,9 @@ void SGL_OpenGLManager::uniform2fv(GLint location, GLsizei count, const GLfloat
  */
 void SGL_OpenGLManager::uniform2f(GLint location, GLfloat v0, GLfloat v1) const noexcept
 {
-    glUniform2f(location, v0, v1);
+    hashFrameCall(UNIFORM, location, v0, v1);
+    pFrameCounters.uniformUpdates++;
+    pGL->uniform2f(location, v0, v1);
 }
 
 
@@ -484,7 +716,9 @@ void SGL_OpenGLManager::uniform2f(GLint location, GLfloat v0, GLfloat v1) const
  */
 void SGL_OpenGLManager::uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) const noexcept
 {
-    glUniform3f(location, v0, v1, v2);
+    hashFrameCall(UNIFORM, location, v0, v1, v2);
+    pFrameCounters.uniformUpdates++;
+    pGL->uniform3f(location, v0, v1, v2);
 }
 
 
@@ -500,7 +734,9 @@ void SGL_OpenGLManager::uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloa
  */
 void SGL_OpenGLManager::uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) const noexcept
 {
-    glUniform4f(location, v0, v1, v2, v3);
+    hashFrameCall(UNIFORM, location, v0, v1, v2, v3);
+    pFrameCounters.uniformUpdates++;
+    pGL->uniform4f(location, v0, v1, v2, v3);
 }
 
 
@@ -515,7 +751,10 @@ void SGL_OpenGLManager::uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloa
  */
 void SGL_OpenGLManager::uniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) const noexcept
 {
-    glUniformMatrix4fv(location, count, transpose, value);
+    hashFrameCall(UNIFORM, location, count, transpose);
+    pFrameCounters.uniformUpdates++;
+    hashFrameData(value, sizeof(GLfloat) * 16 * count);
+    pGL->uniformMatrix4fv(location, count, transpose, value);
 }
 
 /**
@@ -526,7 +765,7 @@ void SGL_OpenGLManager::uniformMatrix4fv(GLint location, GLsizei count, GLboolea
  */
 void SGL_OpenGLManager::deleteProgram(GLuint program) const noexcept
 {
-    glDeleteProgram(program);
+    pGL->deleteProgram(program);
 }
 
 /**
@@ -537,8 +776,272 @@ void SGL_OpenGLManager::deleteProgram(GLuint program) const noexcept
  */
 void SGL_OpenGLManager::useProgram(GLuint program) noexcept
 {
+    // Binding a program that's still linking would stall until the driver is done
+    if (!pPendingPrograms.empty())
+    {
+        auto pending = pPendingPrograms.find(program);
+        if (pending != pPendingPrograms.end())
+            program = pending->second;
+    }
     currentShaderID = program;
-    glUseProgram(program);
+    hashFrameCall(USE_PROGRAM, program);
+    pFrameCounters.programSwitches++;
+    pGL->useProgram(program);
+}
+
+/**
+ * @brief Compiles and links a single stage separable program
+ *
+ * @param type Shader stage
+ * @param count Amount of source strings
+ * @param strings Shader source
+ * @return GLuint Program ID, check its link status for errors
+ */
+GLuint SGL_OpenGLManager::createShaderProgramv(GLenum type, GLsizei count, const GLchar *const *strings) const noexcept
+{
+    return pGL->createShaderProgramv(type, count, strings);
+}
+
+/**
+ * @brief Generate program pipeline names
+ *
+ * @param n Amount of pipelines
+ * @param pipelines Array to store the names
+ * @return nothing
+ */
+void SGL_OpenGLManager::genProgramPipelines(GLsizei n, GLuint *pipelines) const noexcept
+{
+    pGL->genProgramPipelines(n, pipelines);
+}
+
+/**
+ * @brief Delete program pipelines, the stage programs are left untouched
+ *
+ * @param n Amount of pipelines
+ * @param pipelines Pipeline names
+ * @return nothing
+ */
+void SGL_OpenGLManager::deleteProgramPipelines(GLsizei n, const GLuint *pipelines) const noexcept
+{
+    pGL->deleteProgramPipelines(n, pipelines);
+}
+
+/**
+ * @brief Bind a program pipeline, it's only used while no program is active through useProgram()
+ *
+ * @param pipeline Pipeline name, 0 unbinds
+ * @return nothing
+ */
+void SGL_OpenGLManager::bindProgramPipeline(GLuint pipeline) noexcept
+{
+    hashFrameCall(USE_PROGRAM, GL_PROGRAM_PIPELINE, pipeline);
+    pFrameCounters.programSwitches++;
+    pGL->bindProgramPipeline(pipeline);
+}
+
+/**
+ * @brief Attach the stages of a separable program to a pipeline
+ *
+ * @param pipeline Pipeline name
+ * @param stages GL_*_SHADER_BIT stages to take from program
+ * @param program Separable program
+ * @return nothing
+ */
+void SGL_OpenGLManager::useProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) const noexcept
+{
+    pGL->useProgramStages(pipeline, stages, program);
+}
+
+/**
+ * @brief Select the pipeline stage program that receives glUniform* calls
+ *
+ * @param pipeline Pipeline name
+ * @param program Stage program attached to the pipeline
+ * @return nothing
+ */
+void SGL_OpenGLManager::activeShaderProgram(GLuint pipeline, GLuint program) const noexcept
+{
+    hashFrameCall(USE_PROGRAM, GL_PROGRAM_PIPELINE, pipeline, program);
+    pGL->activeShaderProgram(pipeline, program);
+}
+
+/**
+ * @brief Check whether the pipeline can execute, the result is stored as GL_VALIDATE_STATUS
+ *
+ * @param pipeline Pipeline name
+ * @return nothing
+ */
+void SGL_OpenGLManager::validateProgramPipeline(GLuint pipeline) const noexcept
+{
+    pGL->validateProgramPipeline(pipeline);
+}
+
+/**
+ * @brief Return a parameter from a program pipeline
+ *
+ * @param pipeline Pipeline name
+ * @param pname Specifies the object parameter.
+ * @param params Returns the requested object parameter.
+ * @return nothing
+ */
+void SGL_OpenGLManager::getProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) const noexcept
+{
+    pGL->getProgramPipelineiv(pipeline, pname, params);
+}
+
+/**
+ * @brief Returns the information log for a program pipeline
+ *
+ * @param pipeline Pipeline name
+ * @param maxLength Size of the character buffer for storing the returned information log.
+ * @param length Returns the length of the string returned in infoLog (excluding the null terminator).
+ * @param infoLog Array of characters that is used to return the information log.
+ * @return nothing
+ */
+void SGL_OpenGLManager::getProgramPipelineInfoLog(GLuint pipeline, GLsizei maxLength, GLsizei *length, GLchar *infoLog) const noexcept
+{
+    pGL->getProgramPipelineInfoLog(pipeline, maxLength, length, infoLog);
+}
+
+/**
+ * @brief Are separable programs and program pipelines available?
+ * @return bool
+ */
+bool SGL_OpenGLManager::separableProgramsSupported() const noexcept
+{
+    return pSeparablePrograms;
+}
+
+/**
+ * @brief Set a program parameter
+ *
+ * @param program Shader program ID
+ * @param pname GL_PROGRAM_BINARY_RETRIEVABLE_HINT or GL_PROGRAM_SEPARABLE
+ * @param value New value
+ * @return nothing
+ */
+void SGL_OpenGLManager::programParameteri(GLuint program, GLenum pname, GLint value) const noexcept
+{
+    pGL->programParameteri(program, pname, value);
+}
+
+/**
+ * @brief Retrieve the driver specific binary of a linked program
+ *
+ * @param program Shader program ID
+ * @param bufSize Size of binary, query GL_PROGRAM_BINARY_LENGTH first
+ * @param length Returns the amount of bytes written
+ * @param binaryFormat Returns the driver format of the binary
+ * @param binary Destination buffer
+ * @return nothing
+ */
+void SGL_OpenGLManager::getProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) const noexcept
+{
+    pGL->getProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+
+/**
+ * @brief Load a program from a previously retrieved binary
+ *
+ * @param program Shader program ID
+ * @param binaryFormat Format returned by getProgramBinary()
+ * @param binary Binary data
+ * @param length Binary size in bytes
+ * @return nothing
+ *
+ * Drivers reject binaries from other versions silently, GL_LINK_STATUS tells whether it was accepted.
+ */
+void SGL_OpenGLManager::programBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) const noexcept
+{
+    pGL->programBinary(program, binaryFormat, binary, length);
+}
+
+/**
+ * @brief Can linked programs be saved and reloaded as binaries?
+ * @return bool
+ */
+bool SGL_OpenGLManager::programBinarySupported() const noexcept
+{
+    return pProgramBinaries;
+}
+
+/**
+ * @brief Can the compile and link status be polled without blocking? (KHR_parallel_shader_compile)
+ * @return bool
+ */
+bool SGL_OpenGLManager::parallelShaderCompileSupported() const noexcept
+{
+    return pParallelShaderCompile;
+}
+
+/**
+ * @brief Makes useProgram() bind a placeholder while program is still linking
+ *
+ * @param program Program submitted for linking
+ * @param placeholder Program bound in its place
+ * @return nothing
+ */
+void SGL_OpenGLManager::setProgramPlaceholder(GLuint program, GLuint placeholder) noexcept
+{
+    pPendingPrograms[program] = placeholder;
+}
+
+/**
+ * @brief Stops replacing a program, call it once it finished linking
+ *
+ * @param program Program passed to setProgramPlaceholder()
+ * @param linked Did it link? The uniforms set while it was pending are written to it, otherwise discarded
+ * @return nothing
+ */
+void SGL_OpenGLManager::clearProgramPlaceholder(GLuint program, bool linked) noexcept
+{
+    pPendingPrograms.erase(program);
+    auto deferred = pPendingUniforms.find(program);
+    if (deferred == pPendingUniforms.end())
+        return;
+    if (linked)
+    {
+        // Without DSA the writes land on the current program
+        GLuint previous = currentShaderID;
+        if (!pDirectStateAccess)
+            this->useProgram(program);
+        for (auto &uniform : deferred->second)
+        {
+            GLint location = pGL->getUniformLocation(program, uniform.first.c_str());
+            if (location >= 0)
+                uniform.second(location);
+        }
+        if (!pDirectStateAccess)
+            this->useProgram(previous);
+    }
+    pPendingUniforms.erase(deferred);
+}
+
+/**
+ * @brief Is the program replaced by a placeholder?
+ *
+ * @param program Shader program ID
+ * @return bool
+ */
+bool SGL_OpenGLManager::programPending(GLuint program) const noexcept
+{
+    return !pPendingPrograms.empty() && pPendingPrograms.count(program) > 0;
+}
+
+/**
+ * @brief Defers a uniform write to a program that's still linking
+ *
+ * @param program Pending program
+ * @param name Uniform name, a later write to the same uniform replaces this one
+ * @param write Writes the value, receives the uniform location once the program linked
+ * @return nothing
+ *
+ * Querying the location now would block until the driver finishes linking,
+ * clearProgramPlaceholder() replays the writes instead.
+ */
+void SGL_OpenGLManager::deferProgramUniform(GLuint program, const GLchar *name, std::function<void(GLint)> write)
+{
+    pPendingUniforms[program][name] = std::move(write);
 }
 
 /**
@@ -552,7 +1055,7 @@ void SGL_OpenGLManager::useProgram(GLuint program) noexcept
  */
 void SGL_OpenGLManager::shaderSource(GLuint shader, GLsizei count, const GLchar **string, const GLint *length) const noexcept
 {
-    glShaderSource(shader, count, string, length);
+    pGL->shaderSource(shader, count, string, length);
 }
 
 /**
@@ -563,7 +1066,7 @@ void SGL_OpenGLManager::shaderSource(GLuint shader, GLsizei count, const GLchar
  */
 GLuint SGL_OpenGLManager::createShader(GLenum shaderType) const noexcept
 {
-    return glCreateShader(shaderType);
+    return pGL->createShader(shaderType);
 }
 
 
@@ -575,7 +1078,7 @@ GLuint SGL_OpenGLManager::createShader(GLenum shaderType) const noexcept
  */
 void SGL_OpenGLManager::compileShader(GLuint shader) const noexcept
 {
-    glCompileShader(shader);
+    pGL->compileShader(shader);
 }
 
 
@@ -588,7 +1091,7 @@ void SGL_OpenGLManager::compileShader(GLuint shader) const noexcept
  */
 void SGL_OpenGLManager::attachShader(GLuint program, GLuint shader) const noexcept
 {
-    glAttachShader(program, shader);
+    pGL->attachShader(program, shader);
 }
 
 
@@ -600,7 +1103,7 @@ void SGL_OpenGLManager::attachShader(GLuint program, GLuint shader) const noexce
  */
 void SGL_OpenGLManager::deleteShader(GLuint shader) const noexcept
 {
-    glDeleteShader(shader);
+    pGL->deleteShader(shader);
 }
 
 
@@ -611,7 +1114,7 @@ void SGL_OpenGLManager::deleteShader(GLuint shader) const noexcept
  */
 GLuint SGL_OpenGLManager::createProgram() const noexcept
 {
-    return glCreateProgram();
+    return pGL->createProgram();
 }
 
 /**
@@ -621,7 +1124,7 @@ GLuint SGL_OpenGLManager::createProgram() const noexcept
  */
 void SGL_OpenGLManager::linkProgram(GLuint program) const noexcept
 {
-    glLinkProgram(program);
+    pGL->linkProgram(program);
 }
 
 /**
@@ -634,7 +1137,7 @@ void SGL_OpenGLManager::linkProgram(GLuint program) const noexcept
  */
 void SGL_OpenGLManager::getShaderiv(GLuint shader, GLenum pname, GLint *params) const noexcept
 {
-    glGetShaderiv(shader, pname, params);
+    pGL->getShaderiv(shader, pname, params);
 }
 
 /**
@@ -648,7 +1151,7 @@ void SGL_OpenGLManager::getShaderiv(GLuint shader, GLenum pname, GLint *params)
  */
 void SGL_OpenGLManager::getShaderInfoLog(GLuint shader,  GLsizei maxLength, GLsizei *length, GLchar *infoLog) const noexcept
 {
-    glGetShaderInfoLog(shader, maxLength, length, infoLog);
+    pGL->getShaderInfoLog(shader, maxLength, length, infoLog);
 }
 
 
@@ -662,7 +1165,7 @@ void SGL_OpenGLManager::getShaderInfoLog(GLuint shader,  GLsizei maxLength, GLsi
  */
 void SGL_OpenGLManager::getProgramiv(GLuint shader, GLenum pname, GLint *params) const noexcept
 {
-    glGetProgramiv(shader, pname, params);
+    pGL->getProgramiv(shader, pname, params);
 }
 
 /**
@@ -676,7 +1179,7 @@ void SGL_OpenGLManager::getProgramiv(GLuint shader, GLenum pname, GLint *params)
  */
 void SGL_OpenGLManager::getProgramInfoLog(GLuint shader,  GLsizei maxLength, GLsizei *length, GLchar *infoLog) const noexcept
 {
-    glGetProgramInfoLog(shader, maxLength, length, infoLog);
+    pGL->getProgramInfoLog(shader, maxLength, length, infoLog);
 }
 
 
@@ -687,7 +1190,7 @@ void SGL_OpenGLManager::getProgramInfoLog(GLuint shader,  GLsizei maxLength, GLs
  */
 GLenum SGL_OpenGLManager::checkFrameBufferStatus(GLenum target) const noexcept
 {
-    return glCheckFramebufferStatus(target);
+    return pGL->checkFramebufferStatus(target);
 }
 
 /**
@@ -702,7 +1205,73 @@ GLenum SGL_OpenGLManager::checkFrameBufferStatus(GLenum target) const noexcept
  */
 void SGL_OpenGLManager::frameBufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) const noexcept
 {
-    glFramebufferTexture2D(target, attachment, textarget, texture, level);
+    hashFrameCall(FBO_TEXTURE, target, attachment, textarget, texture, level);
+    pGL->framebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+/**
+ * @brief Generate renderbuffer object names
+ *
+ * @param n Number of renderbuffer object names to generate
+ * @param renderbuffers Array in which the generated names are stored
+ * @return nothing
+ */
+void SGL_OpenGLManager::genRenderbuffers(GLsizei n, GLuint *renderbuffers) const noexcept
+{
+    pGL->genRenderbuffers(n, renderbuffers);
+}
+
+/**
+ * @brief Delete renderbuffer objects, zeros and unknown names are ignored
+ *
+ * @param n Number of renderbuffer objects to be deleted
+ * @param renderbuffers Array of renderbuffer objects to be deleted
+ * @return nothing
+ */
+void SGL_OpenGLManager::deleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) const noexcept
+{
+    pGL->deleteRenderbuffers(n, renderbuffers);
+}
+
+/**
+ * @brief Bind a renderbuffer to a renderbuffer target
+ *
+ * @param target Must be GL_RENDERBUFFER
+ * @param renderbuffer Name of the renderbuffer object
+ * @return nothing
+ */
+void SGL_OpenGLManager::bindRenderbuffer(GLenum target, GLuint renderbuffer) const noexcept
+{
+    pGL->bindRenderbuffer(target, renderbuffer);
+}
+
+/**
+ * @brief Establish data storage, format and dimensions of the bound renderbuffer's image
+ *
+ * @param target Must be GL_RENDERBUFFER
+ * @param internalformat Internal format to use for the renderbuffer object's image
+ * @param width Width of the renderbuffer, in pixels
+ * @param height Height of the renderbuffer, in pixels
+ * @return nothing
+ */
+void SGL_OpenGLManager::renderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) const noexcept
+{
+    pGL->renderbufferStorage(target, internalformat, width, height);
+}
+
+/**
+ * @brief Attach a renderbuffer as a logical buffer of the bound framebuffer
+ *
+ * @param target Specifies the framebuffer target
+ * @param attachment Attachment point of the framebuffer
+ * @param renderbuffertarget Must be GL_RENDERBUFFER
+ * @param renderbuffer Renderbuffer object to attach
+ * @return nothing
+ */
+void SGL_OpenGLManager::framebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) const noexcept
+{
+    hashFrameCall(FBO_TEXTURE, target, attachment, renderbuffertarget, renderbuffer);
+    pGL->framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
 }
 
 /**
@@ -722,7 +1291,8 @@ void SGL_OpenGLManager::frameBufferTexture2D(GLenum target, GLenum attachment, G
  */
 void SGL_OpenGLManager::blitFrameBuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) const noexcept
 {
-    glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    hashFrameCall(BLIT, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    pGL->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
 
@@ -732,9 +1302,9 @@ void SGL_OpenGLManager::blitFrameBuffer(GLint srcX0, GLint srcY0, GLint srcX1, G
  */
 void SGL_OpenGLManager::clearBuffers() noexcept
 {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    pGL->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    pGL->bindBuffer(GL_ARRAY_BUFFER, 0);
+    pGL->bindVertexArray(0);
 }
 
 /**
@@ -744,11 +1314,11 @@ void SGL_OpenGLManager::clearBuffers() noexcept
  */
 void SGL_OpenGLManager::deleteVBO(const std::string &name) noexcept
 {
-    if (!VBO.empty() && VBO.find(name) == VBO.end())
+    auto byeBuffer = VBO.find(name);
+    if (byeBuffer != VBO.end())
     {
-        GLBuffer byeBuffer = VBO.at(name);
-        glDeleteBuffers(1, &byeBuffer.ID);
-        VBO.erase(name);
+        deferDeletion(GL_OBJECT_BUFFER, byeBuffer->second.ID);
+        VBO.erase(byeBuffer);
     }
 }
 
@@ -760,11 +1330,11 @@ void SGL_OpenGLManager::deleteVBO(const std::string &name) noexcept
  */
 void SGL_OpenGLManager::deleteEBO(const std::string &name) noexcept
 {
-    if (!EBO.empty() && EBO.find(name) == EBO.end())
+    auto byeBuffer = EBO.find(name);
+    if (byeBuffer != EBO.end())
     {
-        GLBuffer byeBuffer = EBO.at(name);
-        glDeleteBuffers(1, &byeBuffer.ID);
-        EBO.erase(name);
+        deferDeletion(GL_OBJECT_BUFFER, byeBuffer->second.ID);
+        EBO.erase(byeBuffer);
     }
 }
 
@@ -775,11 +1345,11 @@ void SGL_OpenGLManager::deleteEBO(const std::string &name) noexcept
  */
 void SGL_OpenGLManager::deleteVAO(const std::string &name) noexcept
 {
-    if (!VAO.empty() && VAO.find(name) == VAO.end())
+    auto byeBuffer = VAO.find(name);
+    if (byeBuffer != VAO.end())
     {
-        GLBuffer byeBuffer = VAO.at(name);
-        glDeleteBuffers(1, &byeBuffer.ID);
-        VAO.erase(name);
+        deferDeletion(GL_OBJECT_VERTEX_ARRAY, byeBuffer->second.ID);
+        VAO.erase(byeBuffer);
     }
 }
 
@@ -791,11 +1361,11 @@ void SGL_OpenGLManager::deleteVAO(const std::string &name) noexcept
  */
 void SGL_OpenGLManager::deleteFBO(const std::string &name) noexcept
 {
-    if (!FBO.empty() && FBO.find(name) == FBO.end())
+    auto byeBuffer = FBO.find(name);
+    if (byeBuffer != FBO.end())
     {
-        GLBuffer byeBuffer = FBO.at(name);
-        glDeleteBuffers(1, &byeBuffer.ID);
-        FBO.erase(name);
+        deferDeletion(GL_OBJECT_FRAMEBUFFER, byeBuffer->second.ID);
+        FBO.erase(byeBuffer);
     }
 }
 
@@ -805,7 +1375,7 @@ void SGL_OpenGLManager::deleteFBO(const std::string &name) noexcept
  */
 void SGL_OpenGLManager::unbindVBO() noexcept
 {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    pGL->bindBuffer(GL_ARRAY_BUFFER, 0);
     currentGLBuffers.currentVBO.name = "NO_VBO";
     currentGLBuffers.currentVBO.ID = 0;
 }
@@ -817,7 +1387,7 @@ void SGL_OpenGLManager::unbindVBO() noexcept
  */
 void SGL_OpenGLManager::unbindEBO() noexcept
 {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    pGL->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     currentGLBuffers.currentEBO.name = "NO_EBO";
     currentGLBuffers.currentEBO.ID = 0;
 }
@@ -829,43 +1399,121 @@ void SGL_OpenGLManager::unbindEBO() noexcept
  */
 void SGL_OpenGLManager::unbindVAO() noexcept
 {
-    glBindVertexArray(0);
+    pGL->bindVertexArray(0);
     currentGLBuffers.currentVAO.name = "NO_VAO";
     currentGLBuffers.currentVAO.ID = 0;
 
 }
 
 /**
- * @brief Unbind FBO
+ * @brief Unbind the draw indirect buffer
  * @return nothing
  */
-void SGL_OpenGLManager::unbindFBO() noexcept
+void SGL_OpenGLManager::unbindDIBO() noexcept
 {
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
-    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
-
-    currentGLBuffers.currentFBO_W.name = "NO_WRITE_FBO";
-    currentGLBuffers.currentFBO_R.name = "NO_READ_FBO";
-
-    currentGLBuffers.currentFBO_R.ID = 0;
-    currentGLBuffers.currentFBO_W.ID = 0;
-
+    pGL->bindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
 }
 
-
-
 /**
- * @brief Toggles depth testing
- * @param value Enable depth testing?
+ * @brief Binds a buffer as the GL_PIXEL_PACK_BUFFER
+ *
+ * @param name The buffer identifier, created with createVBO()
  * @return nothing
  */
-void SGL_OpenGLManager::depthTesting(bool value) noexcept
+void SGL_OpenGLManager::bindPBO(const std::string &name) noexcept
 {
-    if (value)
+    if (VBO.find(name) == VBO.end())
     {
-        this->enable(GL_DEPTH_TEST);
-        currentGLSettings.depth.active = true;
+#ifdef SGL_OUTPUT_OPENGL_DETAILS
+        SGL_Log("ERROR: PBO NOT FOUND: " + name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_CYAN);
+#endif
+    }
+    else
+    {
+        GLuint bufferToBind = VBO.at(name).ID;
+        hashFrameCall(BIND_VBO, GL_PIXEL_PACK_BUFFER, bufferToBind);
+        pFrameCounters.bufferBinds++;
+        pGL->bindBuffer(GL_PIXEL_PACK_BUFFER, bufferToBind);
+    }
+}
+
+/**
+ * @brief Unbind the pixel pack buffer
+ * @return nothing
+ */
+void SGL_OpenGLManager::unbindPBO() noexcept
+{
+    pGL->bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+/**
+ * @brief Binds a buffer to an indexed GL_SHADER_STORAGE_BUFFER binding point
+ *
+ * @param index Binding point, matches the layout (binding = N) qualifier in the shader
+ * @param name The buffer identifier, created with createVBO()
+ * @return nothing
+ */
+void SGL_OpenGLManager::bindSSBO(GLuint index, const std::string &name) noexcept
+{
+    if (VBO.find(name) == VBO.end())
+    {
+#ifdef SGL_OUTPUT_OPENGL_DETAILS
+        SGL_Log("ERROR: SSBO NOT FOUND: " + name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_CYAN);
+#endif
+    }
+    else
+    {
+        GLuint bufferToBind = VBO.at(name).ID;
+        hashFrameCall(BIND_VBO, GL_SHADER_STORAGE_BUFFER, index, bufferToBind);
+        pFrameCounters.bufferBinds++;
+        pGL->bindBufferBase(GL_SHADER_STORAGE_BUFFER, index, bufferToBind);
+    }
+}
+
+/**
+ * @brief Clears an indexed GL_SHADER_STORAGE_BUFFER binding point
+ *
+ * @param index Binding point
+ * @return nothing
+ */
+void SGL_OpenGLManager::unbindSSBO(GLuint index) noexcept
+{
+    pGL->bindBufferBase(GL_SHADER_STORAGE_BUFFER, index, 0);
+}
+
+/**
+ * @brief Unbind FBO
+ * @return nothing
+ */
+void SGL_OpenGLManager::unbindFBO() noexcept
+{
+    hashFrameCall(UNBIND_FBO);
+    pFrameCounters.fboBinds++;
+    pGL->bindFramebuffer(GL_FRAMEBUFFER, 0);
+    pGL->bindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    pGL->bindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+
+    currentGLBuffers.currentFBO_W.name = "NO_WRITE_FBO";
+    currentGLBuffers.currentFBO_R.name = "NO_READ_FBO";
+
+    currentGLBuffers.currentFBO_R.ID = 0;
+    currentGLBuffers.currentFBO_W.ID = 0;
+
+}
+
+
+
+/**
+ * @brief Toggles depth testing
+ * @param value Enable depth testing?
+ * @return nothing
+ */
+void SGL_OpenGLManager::depthTesting(bool value) noexcept
+{
+    if (value)
+    {
+        this->enable(GL_DEPTH_TEST);
+        currentGLSettings.depth.active = true;
     }
     else
     {
@@ -884,12 +1532,12 @@ void SGL_OpenGLManager::depthMask(bool value) noexcept
 {
     if (value)
     {
-        glDepthMask(GL_TRUE);
+        pGL->depthMask(GL_TRUE);
         currentGLSettings.depthMask.active = true;
     }
     else
     {
-        glDepthMask(GL_FALSE);
+        pGL->depthMask(GL_FALSE);
         currentGLSettings.depthMask.active = false;
     }
 }
@@ -922,13 +1570,23 @@ void SGL_OpenGLManager::faceCulling(bool value) noexcept
  */
 void SGL_OpenGLManager::blending(bool value, BLENDING_TYPE type, GLenum sfactor, GLenum dfactor) noexcept
 {
-    if (value || !(type == BLENDING_TYPE::NONE))
+    hashFrameCall(BLENDING, value, type, sfactor, dfactor);
+    pFrameCounters.blendChanges++;
+    if (pOverdrawFBO != 0 && currentGLBuffers.currentFBO_W.ID == pOverdrawFBO)
+    {
+        // Overdraw view, every fragment halves the target no matter what the shader outputs
+        this->enable(GL_BLEND);
+        currentGLSettings.blending.active = true;
+        pGL->blendColor(0.5f, 0.5f, 0.5f, 0.5f);
+        pGL->blendFunc(GL_ZERO, GL_CONSTANT_COLOR);
+    }
+    else if (value || !(type == BLENDING_TYPE::NONE))
     {
         this->enable(GL_BLEND);
         currentGLSettings.blending.active = true;
 
         if (type == BLENDING_TYPE::CUSTOM) // Use the provided sfactor & dfactor enums
-            glBlendFunc(sfactor, dfactor);
+            pGL->blendFunc(sfactor, dfactor);
         else // Use the convenience wrappers
         {
             switch(type)
@@ -936,30 +1594,30 @@ void SGL_OpenGLManager::blending(bool value, BLENDING_TYPE type, GLenum sfactor,
             case NONE:
                 break;
             case DEFAULT_RENDERING:
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                pGL->blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
                 break;
             case SPRITE_RENDERING:
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                pGL->blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
                 break;
             case TEXT_RENDERING:
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                pGL->blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
                 break;
             case PARTICLE_RENDERING:
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+                pGL->blendFunc(GL_SRC_ALPHA, GL_ONE);
                 break;
             case INVISIBLE_RENDERING:
-                glBlendFunc(GL_ZERO, GL_ZERO);
+                pGL->blendFunc(GL_ZERO, GL_ZERO);
                 break;
 
             case TEST_RENDERING_1:
-                glBlendFunc(GL_SRC_COLOR, GL_ZERO);
+                pGL->blendFunc(GL_SRC_COLOR, GL_ZERO);
                 break;
             case TEST_RENDERING_2:
                 // glBlendFunc(GL_ONE_MINUS_SRC_ALPHA, GL_ONE);
-                glBlendFunc(GL_SRC_COLOR, GL_ONE);
+                pGL->blendFunc(GL_SRC_COLOR, GL_ONE);
                 break;
             case TEST_RENDERING_3:
-                glBlendFunc(GL_SRC_COLOR, GL_DST_COLOR);
+                pGL->blendFunc(GL_SRC_COLOR, GL_DST_COLOR);
                 break;
 
             }
@@ -979,7 +1637,9 @@ void SGL_OpenGLManager::blending(bool value, BLENDING_TYPE type, GLenum sfactor,
  */
 void SGL_OpenGLManager::enable(GLenum cap) const noexcept
 {
-    glEnable(cap);
+    hashFrameCall(CAPABILITY, cap, true);
+    pFrameCounters.capabilityChanges++;
+    pGL->enable(cap);
 }
 
 /**
@@ -989,7 +1649,9 @@ void SGL_OpenGLManager::enable(GLenum cap) const noexcept
  */
 void SGL_OpenGLManager::disable(GLenum cap) const noexcept
 {
-    glDisable(cap);
+    hashFrameCall(CAPABILITY, cap, false);
+    pFrameCounters.capabilityChanges++;
+    pGL->disable(cap);
 }
 
 /**
@@ -999,7 +1661,8 @@ void SGL_OpenGLManager::disable(GLenum cap) const noexcept
  */
 void SGL_OpenGLManager::lineWidth(GLfloat width) const noexcept
 {
-    glLineWidth(width);
+    hashFrameCall(LINE_WIDTH, width);
+    pGL->lineWidth(width);
 }
 
 /**
@@ -1009,7 +1672,8 @@ void SGL_OpenGLManager::lineWidth(GLfloat width) const noexcept
  */
 void SGL_OpenGLManager::pixelSize(GLfloat size) const noexcept
 {
-    glPointSize(size);
+    hashFrameCall(POINT_SIZE, size);
+    pGL->pointSize(size);
 }
 
 /**
@@ -1022,7 +1686,9 @@ void SGL_OpenGLManager::pixelSize(GLfloat size) const noexcept
  */
 void SGL_OpenGLManager::resizeGL(int x, int y, int w, int h) const noexcept
 {
-    glViewport(x, y, w, h);
+    hashFrameCall(VIEWPORT, x, y, w, h);
+    pFrameCounters.viewportChanges++;
+    pGL->viewport(x, y, w, h);
     // SGL_OpenGLManager::pLog->print("New window width: ", w);
     // SGL_OpenGLManager::pLog->print("New window heigth: ", h);
 }
@@ -1034,7 +1700,8 @@ void SGL_OpenGLManager::resizeGL(int x, int y, int w, int h) const noexcept
  */
 void SGL_OpenGLManager::setClearColor(SGL_Color &newColor) const noexcept
 {
-    glClearColor(newColor.r, newColor.g, newColor.b, newColor.a);
+    hashFrameCall(CLEAR_COLOR, newColor.r, newColor.g, newColor.b, newColor.a);
+    pGL->clearColor(newColor.r, newColor.g, newColor.b, newColor.a);
 
 }
 
@@ -1045,7 +1712,8 @@ void SGL_OpenGLManager::setClearColor(SGL_Color &newColor) const noexcept
  */
 void SGL_OpenGLManager::clearColorBuffer() const noexcept
 {
-    glClear(GL_COLOR_BUFFER_BIT);
+    hashFrameCall(CLEAR, GL_COLOR_BUFFER_BIT);
+    pGL->clear(GL_COLOR_BUFFER_BIT);
 }
 
 
@@ -1055,7 +1723,8 @@ void SGL_OpenGLManager::clearColorBuffer() const noexcept
  */
 void SGL_OpenGLManager::clearDepthBuffer() const noexcept
 {
-    glClear(GL_DEPTH_BUFFER_BIT);
+    hashFrameCall(CLEAR, GL_DEPTH_BUFFER_BIT);
+    pGL->clear(GL_DEPTH_BUFFER_BIT);
 }
 
 
@@ -1065,7 +1734,8 @@ void SGL_OpenGLManager::clearDepthBuffer() const noexcept
  */
 void SGL_OpenGLManager::clearColorAndDepthBuffers() const noexcept
 {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    hashFrameCall(CLEAR, GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    pGL->clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
 
@@ -1080,7 +1750,13 @@ void SGL_OpenGLManager::clearColorAndDepthBuffers() const noexcept
  */
 void SGL_OpenGLManager::bufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage) const noexcept
 {
-    glBufferData(target, size, data, usage);
+    hashFrameCall(BUFFER_DATA, target, size, usage);
+    if (data != nullptr)
+    {
+        hashFrameData(data, size);
+        pFrameCounters.bytesUploaded += size;
+    }
+    pGL->bufferData(target, size, data, usage);
 }
 
 /**
@@ -1094,7 +1770,79 @@ void SGL_OpenGLManager::bufferData(GLenum target, GLsizeiptr size, const GLvoid*
  */
 void SGL_OpenGLManager::bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data) const noexcept
 {
-    glBufferSubData(target, offset, size, data);
+    hashFrameCall(BUFFER_SUB_DATA, target, offset, size);
+    if (data != nullptr)
+    {
+        hashFrameData(data, size);
+        pFrameCounters.bytesUploaded += size;
+    }
+    pGL->bufferSubData(target, offset, size, data);
+}
+
+/**
+ * @brief Selects the overdraw view target
+ * @section DESCRIPTION
+ *
+ * While the FBO is bound for drawing blending() ignores the requested mode and multiplies the
+ * destination by a constant 0.5 instead. Cleared to 1.0, a pixel covered by n fragments ends up
+ * at 2^-n, so a float target counts up to 126 layers exactly regardless of the shaders used.
+ *
+ * @param name The FBO identifier, an empty string restores normal blending
+ * @return nothing
+ */
+void SGL_OpenGLManager::setOverdrawTarget(const std::string &name) noexcept
+{
+    if (name.empty())
+        pOverdrawFBO = 0;
+    else if (FBO.find(name) == FBO.end())
+        SGL_Log("SGL_OpenGLManager::setOverdrawTarget | FBO not found: " + name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+    else
+        pOverdrawFBO = FBO.at(name).ID;
+}
+
+/**
+ * @brief Is an overdraw target set?
+ * @return bool
+ */
+bool SGL_OpenGLManager::overdrawActive() const noexcept
+{
+    return pOverdrawFBO != 0;
+}
+
+/**
+ * @brief Maps all or part of a buffer object's data store into the client's address space
+ *
+ * @param target Specifies the target to which the buffer object is bound.
+ * @param offset Specifies the starting offset within the buffer of the range to be mapped.
+ * @param length Specifies the length of the range to be mapped.
+ * @param access Specifies a combination of access flags indicating the desired access to the mapped range.
+ * @return void* Pointer to the mapped range, nullptr on failure
+ */
+void *SGL_OpenGLManager::mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) noexcept
+{
+    hashFrameCall(BUFFER_SUB_DATA, target, offset, length);
+    pMappedData = pGL->mapBufferRange(target, offset, length, access);
+    // Read back mappings aren't uploads
+    pMappedSize = (pMappedData != nullptr && (access & GL_MAP_WRITE_BIT)) ? length : 0;
+    return pMappedData;
+}
+
+/**
+ * @brief Releases the mapping of a buffer object's data store, the written range is folded into the frame hash
+ *
+ * @param target Specifies the target to which the buffer object is bound.
+ * @return bool GL_FALSE if the data store contents became corrupt while mapped
+ */
+bool SGL_OpenGLManager::unmapBuffer(GLenum target) noexcept
+{
+    if (pMappedData != nullptr && pMappedSize > 0)
+    {
+        hashFrameData(pMappedData, pMappedSize);
+        pFrameCounters.bytesUploaded += pMappedSize;
+    }
+    pMappedData = nullptr;
+    pMappedSize = 0;
+    return pGL->unmapBuffer(target) == GL_TRUE;
 }
 
 
@@ -1107,7 +1855,8 @@ void SGL_OpenGLManager::bufferSubData(GLenum target, GLintptr offset, GLsizeiptr
 void SGL_OpenGLManager::activeTexture(GLenum texture) noexcept
 {
     currentTextureID = texture;
-    glActiveTexture(texture);
+    hashFrameCall(ACTIVE_TEXTURE, texture);
+    pGL->activeTexture(texture);
 }
 
 
@@ -1121,7 +1870,9 @@ void SGL_OpenGLManager::activeTexture(GLenum texture) noexcept
  */
 void SGL_OpenGLManager::drawArrays(GLenum mode, GLint first, GLsizei count) const noexcept
 {
-    glDrawArrays(mode, first, count);
+    hashFrameCall(DRAW, mode, first, count);
+    pFrameCounters.drawCalls++;
+    pGL->drawArrays(mode, first, count);
 }
 
 /**
@@ -1135,7 +1886,9 @@ void SGL_OpenGLManager::drawArrays(GLenum mode, GLint first, GLsizei count) cons
  */
 void SGL_OpenGLManager::drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) const noexcept
 {
-    glDrawArraysInstanced(mode, first, count, instancecount);
+    hashFrameCall(DRAW, mode, first, count, instancecount);
+    countInstancedDraw(instancecount);
+    pGL->drawArraysInstanced(mode, first, count, instancecount);
 }
 
 /**
@@ -1150,108 +1903,1072 @@ void SGL_OpenGLManager::drawArraysInstanced(GLenum mode, GLint first, GLsizei co
  */
 void SGL_OpenGLManager::drawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) const noexcept
 {
-    glDrawElementsInstanced(mode, count, type, indices, instancecount);
+    hashFrameCall(DRAW, mode, count, type, indices, instancecount);
+    countInstancedDraw(instancecount);
+    pGL->drawElementsInstanced(mode, count, type, indices, instancecount);
 }
 
 /**
- * @brief Enable or disable a generic vertex attribute array
- * @param index Specifies the index of the generic vertex attribute to be enabled or disabled.
+ * @brief Draw multiple instances of a range of elements with an offset applied to instanced attributes
+ *
+ * @param mode Specifies what kind of primitives to render.
+ * @param first Specifies the starting index in the enabled arrays.
+ * @param count Specifies the number of indices to be rendered.
+ * @param instancecount Specifies the number of instances of the specified range of indices to be rendered
+ * @param baseinstance Specifies the base instance for use in fetching instanced vertex attributes.
  * @return nothing
  */
-void SGL_OpenGLManager::enableVertexAttribArray(GLuint index) const noexcept
+void SGL_OpenGLManager::drawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) const noexcept
 {
-    glEnableVertexAttribArray(index);
+    hashFrameCall(DRAW, mode, first, count, instancecount, baseinstance);
+    countInstancedDraw(instancecount);
+    pGL->drawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
 }
 
 /**
- * @brief Modify the rate at which generic vertex attributes advance during instanced rendering
- * @param index Specifies the index of the generic vertex attribute to be enabled or disabled.
- * @param divisor  Specify the number of instances that will pass between updates of the generic attribute at slot index.
+ * @brief Render multiple sets of primitives from array data
+ *
+ * @param mode Specifies what kind of primitives to render.
+ * @param indirect Byte offset into the bound GL_DRAW_INDIRECT_BUFFER of the first SGL_DrawArraysIndirectCommand.
+ * @param drawcount Specifies the number of commands to execute.
+ * @param stride Distance in bytes between commands, 0 means tightly packed.
  * @return nothing
  */
-void SGL_OpenGLManager::vertexAttribDivisor(GLuint index, GLint divisor) const noexcept
+void SGL_OpenGLManager::multiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) const noexcept
+{
+    hashFrameCall(DRAW, mode, indirect, drawcount, stride);
+    pFrameCounters.drawCalls++;
+    pFrameCounters.indirectDraws += drawcount;
+    pGL->multiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+
+/**
+ * @brief Render multiple sets of indexed primitives
+ *
+ * @param mode Specifies what kind of primitives to render.
+ * @param type Specifies the type of data in the bound GL_ELEMENT_ARRAY_BUFFER.
+ * @param indirect Byte offset into the bound GL_DRAW_INDIRECT_BUFFER of the first SGL_DrawElementsIndirectCommand.
+ * @param drawcount Specifies the number of commands to execute.
+ * @param stride Distance in bytes between commands, 0 means tightly packed.
+ * @return nothing
+ */
+void SGL_OpenGLManager::multiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) const noexcept
 {
-    glVertexAttribDivisor(index, divisor);
+    hashFrameCall(DRAW, mode, type, indirect, drawcount, stride);
+    pFrameCounters.drawCalls++;
+    pFrameCounters.indirectDraws += drawcount;
+    pGL->multiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
 }
 
+/**
+ * @brief Is glMultiDraw*Indirect available?
+ * @return bool
+ */
+bool SGL_OpenGLManager::multiDrawIndirectSupported() const noexcept
+{
+    return pMultiDrawIndirect;
+}
 
 /**
- * @brief Define an array of generic vertex attribute data
+ * @brief Render primitives from array data
  *
- * @param index Specifies the index of the generic vertex attribute to be modified.
- * @param size Specifies the number of components per generic vertex attribute.
- * @param type Specifies the data type of each component in the array.
- * @param normalized For glVertexAttribPointer, specifies whether fixed-point data values should be normalized (GL_TRUE) or converted directly as fixed-point values (GL_FALSE) when they are accessed.
- * @param stride Specifies the byte offset between consecutive generic vertex attributes.
- * @param pointer Specifies a offset of the first component of the first generic vertex attribute in the array in the data store of the buffer currently bound to the GL_ARRAY_BUFFER target. The initial value is 0.
+ * @param mode Specifies what kind of primitives to render.
+ * @param indirect Byte offset into the bound GL_DRAW_INDIRECT_BUFFER of the SGL_DrawArraysIndirectCommand.
  * @return nothing
  */
-void SGL_OpenGLManager::vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer) const noexcept
+void SGL_OpenGLManager::drawArraysIndirect(GLenum mode, const void *indirect) const noexcept
 {
-    glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    hashFrameCall(DRAW, mode, indirect);
+    pFrameCounters.drawCalls++;
+    pFrameCounters.indirectDraws++;
+    pGL->drawArraysIndirect(mode, indirect);
 }
 
+/**
+ * @brief Launch one or more compute work groups
+ *
+ * @param groupsX Number of work groups in the X dimension.
+ * @param groupsY Number of work groups in the Y dimension.
+ * @param groupsZ Number of work groups in the Z dimension.
+ * @return nothing
+ */
+void SGL_OpenGLManager::dispatchCompute(GLuint groupsX, GLuint groupsY, GLuint groupsZ) const noexcept
+{
+    hashFrameCall(DISPATCH, groupsX, groupsY, groupsZ);
+    pFrameCounters.dispatches++;
+    pGL->dispatchCompute(groupsX, groupsY, groupsZ);
+}
 
 /**
- * @brief Check for anyhow internal OpenGL errors
+ * @brief Defines a barrier ordering memory transactions
+ *
+ * @param barriers Bitfield of the barriers to insert (GL_COMMAND_BARRIER_BIT, GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT...)
  * @return nothing
  */
-void SGL_OpenGLManager::checkForGLErrors() noexcept
+void SGL_OpenGLManager::memoryBarrier(GLbitfield barriers) const noexcept
 {
-    GLenum errCode;
-    const GLubyte *errString;
-    // SGL_Log("DEBUG MACRO ENABLED", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
-    if ((errCode = glGetError()) != GL_NO_ERROR)
+    pGL->memoryBarrier(barriers);
+}
+
+/**
+ * @brief Replace data of a buffer without binding it, falls back to binding it to GL_ARRAY_BUFFER
+ *
+ * @param name Buffer created with createVBO
+ * @param offset Offset into the buffer's data store where data replacement will begin, measured in bytes.
+ * @param size Size in bytes of the data store region being replaced.
+ * @param data Pointer to the new data that will be copied into the data store.
+ * @return nothing
+ */
+void SGL_OpenGLManager::namedBufferSubData(const std::string &name, GLintptr offset, GLsizeiptr size, const GLvoid *data) noexcept
+{
+    if (!pDirectStateAccess)
     {
-        if (initialErrorCap == 0)
-        {
-            initialErrorCap++;
-            return;
-        }
+        this->bindVBO(name);
+        this->bufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+        return;
+    }
 
-        errString = gluErrorString(errCode);
-        std::stringstream ss;
-        ss << errString;
-        SGL_Log("SkeletonGL OpenGL Error: " + ss.str(), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
-        SGL_Log("Current shader ID: " + std::to_string(currentShaderID), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
-        SGL_Log("Current texture ID: " + std::to_string(currentTextureID), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
-        SGL_Log("Current VAO: " + currentGLBuffers.currentVAO.name + " " + std::to_string(currentGLBuffers.currentVAO.ID), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
-        //assert(false);
+    auto buffer = VBO.find(name);
+    if (buffer == VBO.end())
+    {
+#ifdef SGL_OUTPUT_OPENGL_DETAILS
+        SGL_Log("ERROR: VBO NOT FOUND: " + name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_CYAN);
+#endif
+        return;
+    }
+    hashFrameCall(BUFFER_SUB_DATA, buffer->second.ID, offset, size);
+    if (data != nullptr)
+    {
+        hashFrameData(data, size);
+        pFrameCounters.bytesUploaded += size;
     }
+    pGL->namedBufferSubData(buffer->second.ID, offset, size, data);
 }
 
 /**
- * @brief Returns the total active VBOs
- * @return int
+ * @brief Set a parameter of a 2D texture without binding it, falls back to binding it to GL_TEXTURE_2D
+ *
+ * @param texture Texture name
+ * @param pname Parameter to set
+ * @param param New value
+ * @return nothing
  */
-int  SGL_OpenGLManager::totalVBO() const noexcept
+void SGL_OpenGLManager::textureParameteri(GLuint texture, GLenum pname, GLint param) const noexcept
 {
-    return VBO.size();
+    if (pDirectStateAccess)
+        pGL->textureParameteri(texture, pname, param);
+    else
+    {
+        this->bindTexture(GL_TEXTURE_2D, texture);
+        pGL->texParameteri(GL_TEXTURE_2D, pname, param);
+    }
 }
 
 /**
- * @brief Returns the total active VAOs
- * @return int
+ * @brief Specify the value of a float uniform of program, the current program without DSA
+ *
+ * @param program Program that owns the uniform
+ * @param location Uniform location
+ * @param v0 Value to use
+ * @return nothing
  */
-int SGL_OpenGLManager::totalVAO() const noexcept
+void SGL_OpenGLManager::programUniform1f(GLuint program, GLint location, GLfloat v0) const noexcept
 {
-    return VAO.size();
+    hashFrameCall(UNIFORM, program, location, v0);
+    pFrameCounters.uniformUpdates++;
+    if (pDirectStateAccess)
+        pGL->programUniform1f(program, location, v0);
+    else
+        pGL->uniform1f(location, v0);
 }
 
 /**
- * @brief Returns the total active EBOs
- * @return int
+ * @brief Specify the value of an integer uniform of program, the current program without DSA
+ *
+ * @param program Program that owns the uniform
+ * @param location Uniform location
+ * @param v0 Value to use
+ * @return nothing
  */
-int SGL_OpenGLManager::totalEBO() const noexcept
+void SGL_OpenGLManager::programUniform1i(GLuint program, GLint location, GLint v0) const noexcept
 {
-    return EBO.size();
+    hashFrameCall(UNIFORM, program, location, v0);
+    pFrameCounters.uniformUpdates++;
+    if (pDirectStateAccess)
+        pGL->programUniform1i(program, location, v0);
+    else
+        pGL->uniform1i(location, v0);
 }
 
 /**
- * @brief Returns the total active FBOs
- * @return int
+ * @brief Specify the value of a vec2 uniform of program, the current program without DSA
+ *
+ * @param program Program that owns the uniform
+ * @param location Uniform location
+ * @param v0 X value
+ * @param v1 Y value
+ * @return nothing
  */
-int SGL_OpenGLManager::totalFBO() const noexcept
+void SGL_OpenGLManager::programUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) const noexcept
 {
-    return FBO.size();
+    hashFrameCall(UNIFORM, program, location, v0, v1);
+    pFrameCounters.uniformUpdates++;
+    if (pDirectStateAccess)
+        pGL->programUniform2f(program, location, v0, v1);
+    else
+        pGL->uniform2f(location, v0, v1);
+}
+
+/**
+ * @brief Specify the value of a vec3 uniform of program, the current program without DSA
+ *
+ * @param program Program that owns the uniform
+ * @param location Uniform location
+ * @param v0 X value
+ * @param v1 Y value
+ * @param v2 Z value
+ * @return nothing
+ */
+void SGL_OpenGLManager::programUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) const noexcept
+{
+    hashFrameCall(UNIFORM, program, location, v0, v1, v2);
+    pFrameCounters.uniformUpdates++;
+    if (pDirectStateAccess)
+        pGL->programUniform3f(program, location, v0, v1, v2);
+    else
+        pGL->uniform3f(location, v0, v1, v2);
+}
+
+/**
+ * @brief Specify the value of a vec4 uniform of program, the current program without DSA
+ *
+ * @param program Program that owns the uniform
+ * @param location Uniform location
+ * @param v0 X value
+ * @param v1 Y value
+ * @param v2 Z value
+ * @param v3 W value
+ * @return nothing
+ */
+void SGL_OpenGLManager::programUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) const noexcept
+{
+    hashFrameCall(UNIFORM, program, location, v0, v1, v2, v3);
+    pFrameCounters.uniformUpdates++;
+    if (pDirectStateAccess)
+        pGL->programUniform4f(program, location, v0, v1, v2, v3);
+    else
+        pGL->uniform4f(location, v0, v1, v2, v3);
+}
+
+/**
+ * @brief Specify the value of a mat4 uniform of program, the current program without DSA
+ *
+ * @param program Program that owns the uniform
+ * @param location Uniform location
+ * @param count Amount of matrices
+ * @param transpose Transpose the matrices as they're loaded?
+ * @param value Column major matrices
+ * @return nothing
+ */
+void SGL_OpenGLManager::programUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) const noexcept
+{
+    hashFrameCall(UNIFORM, program, location, count, transpose);
+    pFrameCounters.uniformUpdates++;
+    hashFrameData(value, sizeof(GLfloat) * 16 * count);
+    if (pDirectStateAccess)
+        pGL->programUniformMatrix4fv(program, location, count, transpose, value);
+    else
+        pGL->uniformMatrix4fv(location, count, transpose, value);
+}
+
+/**
+ * @brief Is the DSA code path active? (GL 4.5 / ARB_direct_state_access)
+ * @return bool
+ */
+bool SGL_OpenGLManager::directStateAccessSupported() const noexcept
+{
+    return pDirectStateAccess;
+}
+
+/**
+ * @brief Backend every GL call goes through
+ * @return SGL_GLBackend
+ */
+SGL_GLBackend &SGL_OpenGLManager::getBackend() const noexcept
+{
+    return *pGL;
+}
+
+/**
+ * @brief Logs a KHR_debug message with the SGL call site that raised it
+ *
+ * @param source Message source
+ * @param type Message type
+ * @param id Driver specific message ID
+ * @param severity Message severity
+ * @param length Message length
+ * @param message The message
+ * @param userParam The manager that installed the callback
+ * @return nothing
+ */
+void GLAPIENTRY SGL_OpenGLManager::debugMessageCallback(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                                        GLsizei length, const GLchar *message, const void *userParam)
+{
+    // Group markers pushed by external tools aren't worth reporting
+    if (type == GL_DEBUG_TYPE_PUSH_GROUP || type == GL_DEBUG_TYPE_POP_GROUP)
+        return;
+
+    const SGL_OpenGLManager *oglm = static_cast<const SGL_OpenGLManager *>(userParam);
+    std::string report = "GL " + std::string(sglDebugTypeString(type)) + " [" + sglDebugSeverityString(severity) + "] (" +
+        std::to_string(id) + ") " + std::string(message, (length < 0) ? std::strlen(message) : length);
+
+    const SGL_DebugCallSite &site = oglm->pDebugCallSite;
+    if (site.function != nullptr)
+        report += " | at " + std::string(site.function) + " (" + site.file + ":" + std::to_string(site.line) + ")";
+    else
+        report += " | outside any SGL call site";
+
+    LOG_COLOR color = LOG_COLOR::TERM_CYAN;
+    if (severity == GL_DEBUG_SEVERITY_HIGH || type == GL_DEBUG_TYPE_ERROR)
+        color = LOG_COLOR::TERM_RED;
+    else if (severity == GL_DEBUG_SEVERITY_MEDIUM)
+        color = LOG_COLOR::TERM_YELLOW;
+    SGL_Log(report, LOG_LEVEL::SGL_DEBUG, color);
+    (void)source;
+}
+
+/**
+ * @brief Installs or removes the KHR_debug callback
+ *
+ * @param enable Report driver messages?
+ * @param minSeverity Least severe GL_DEBUG_SEVERITY_* that gets reported
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * Messages are delivered synchronously, inside the GL call that raised them, so the reported
+ * SGL_DEBUG_SCOPE is the one that issued the call. Drivers only report everything on debug
+ * contexts, see the [DEBUG] section of the .ini file.
+ */
+void SGL_OpenGLManager::enableDebugOutput(bool enable, GLenum minSeverity) noexcept
+{
+    if (!pDebugSupported)
+    {
+        if (enable)
+            SGL_Log("SGL_OpenGLManager::enableDebugOutput | KHR_debug is not available.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_YELLOW);
+        pDebugOutput = false;
+        return;
+    }
+
+    if (enable)
+    {
+        pGL->enable(GL_DEBUG_OUTPUT);
+        pGL->enable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        pGL->debugMessageCallback(debugMessageCallback, this);
+        // Filter on the driver side, from the most severe down to minSeverity
+        pGL->debugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_FALSE);
+        const GLenum severities[] = {GL_DEBUG_SEVERITY_HIGH, GL_DEBUG_SEVERITY_MEDIUM, GL_DEBUG_SEVERITY_LOW, GL_DEBUG_SEVERITY_NOTIFICATION};
+        for (GLenum severity : severities)
+        {
+            pGL->debugMessageControl(GL_DONT_CARE, GL_DONT_CARE, severity, 0, nullptr, GL_TRUE);
+            if (severity == minSeverity)
+                break;
+        }
+    }
+    else
+    {
+        pGL->debugMessageCallback(nullptr, nullptr);
+        pGL->disable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        pGL->disable(GL_DEBUG_OUTPUT);
+    }
+    pDebugOutput = enable;
+}
+
+/**
+ * @brief Is the debug callback installed?
+ * @return bool
+ */
+bool SGL_OpenGLManager::debugOutputEnabled() const noexcept
+{
+    return pDebugOutput;
+}
+
+/**
+ * @brief Is KHR_debug available?
+ * @return bool
+ */
+bool SGL_OpenGLManager::debugOutputSupported() const noexcept
+{
+    return pDebugSupported;
+}
+
+/**
+ * @brief Names an object in debug messages and GPU debuggers
+ *
+ * @param identifier GL_BUFFER, GL_VERTEX_ARRAY, GL_FRAMEBUFFER, GL_PROGRAM, GL_TEXTURE...
+ * @param name Object name
+ * @param label Readable name
+ * @return nothing
+ */
+void SGL_OpenGLManager::objectLabel(GLenum identifier, GLuint name, const std::string &label) const noexcept
+{
+    // Names reserved with glGen* aren't objects until bound, only label created ones
+    if (!pDebugOutput || name == 0)
+        return;
+    if (!pDirectStateAccess && identifier != GL_PROGRAM && identifier != GL_SHADER)
+        return;
+    pGL->objectLabel(identifier, name, static_cast<GLsizei>(label.size()), label.c_str());
+}
+
+/**
+ * @brief Sets the SGL call site reported with debug messages
+ *
+ * @param site Function, file and line issuing the next GL calls
+ * @return SGL_DebugCallSite The previous call site
+ */
+SGL_DebugCallSite SGL_OpenGLManager::setDebugCallSite(const SGL_DebugCallSite &site) noexcept
+{
+    SGL_DebugCallSite previous = pDebugCallSite;
+    pDebugCallSite = site;
+    return previous;
+}
+
+/**
+ * @brief Enables or disables GPU timing of SGL_GPU_TIMER_SCOPE blocks
+ *
+ * @param enable Time scopes?
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * Requires GL 3.3 or ARB_timer_query. Results collected so far are kept, see resetGPUTimers().
+ */
+void SGL_OpenGLManager::enableGPUTimers(bool enable) noexcept
+{
+    if (enable && !pGPUTimersSupported)
+    {
+        SGL_Log("SGL_OpenGLManager::enableGPUTimers | Timer queries are not supported by the driver.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_YELLOW);
+        return;
+    }
+    if (!enable)
+        this->endGPUTimer();
+    if (enable && pGPUTimerFrames.empty())
+        pGPUTimerFrames.resize(SGL_OGL_CONSTANTS::GPU_TIMER_LATENCY);
+    pGPUTimers = enable;
+}
+
+/**
+ * @brief Are scopes being timed?
+ * @return bool
+ */
+bool SGL_OpenGLManager::gpuTimersEnabled() const noexcept
+{
+    return pGPUTimers;
+}
+
+/**
+ * @brief Are timer queries available? (GL 3.3 / ARB_timer_query)
+ * @return bool
+ */
+bool SGL_OpenGLManager::gpuTimersSupported() const noexcept
+{
+    return pGPUTimersSupported;
+}
+
+/**
+ * @brief Index of a scope's results, registers it on first use
+ *
+ * @param name Scope name
+ * @return std::size_t
+ */
+std::size_t SGL_OpenGLManager::gpuTimerScope(const char *name)
+{
+    auto cached = pGPUTimerScopes.find(name);
+    if (cached != pGPUTimerScopes.end())
+        return cached->second;
+
+    // The same name may live at different addresses in different translation units
+    std::size_t scope = 0;
+    while (scope < pGPUTimerStats.size() && pGPUTimerStats[scope].name != name)
+        scope++;
+    if (scope == pGPUTimerStats.size())
+    {
+        pGPUTimerStats.push_back({name, 0, 0, 0.0, 0.0, 0.0});
+        pGPUTimerFrameNs.push_back(0);
+        pGPUTimerFrameCalls.push_back(0);
+    }
+    pGPUTimerScopes[name] = scope;
+    return scope;
+}
+
+/**
+ * @brief Starts an elapsed time query for the scope
+ *
+ * @param name Scope name, must outlive the manager
+ * @return bool Was a query started? Only then endGPUTimer() must be called
+ */
+bool SGL_OpenGLManager::beginGPUTimer(const char *name) noexcept
+{
+    if (!pGPUTimers || pGPUTimerActive)
+        return false;
+
+    GPUTimerQuery timer;
+    timer.scope = gpuTimerScope(name);
+    if (pFreeQueries.empty())
+        pGL->genQueries(1, &timer.query);
+    else
+    {
+        timer.query = pFreeQueries.back();
+        pFreeQueries.pop_back();
+    }
+    pGL->beginQuery(GL_TIME_ELAPSED, timer.query);
+    pGPUTimerFrames[pGPUTimerFrame].push_back(timer);
+    pGPUTimerActive = true;
+    return true;
+}
+
+/**
+ * @brief Ends the running elapsed time query
+ *
+ * @return nothing
+ */
+void SGL_OpenGLManager::endGPUTimer() noexcept
+{
+    if (!pGPUTimerActive)
+        return;
+    pGL->endQuery(GL_TIME_ELAPSED);
+    pGPUTimerActive = false;
+}
+
+/**
+ * @brief Moves to the next slot of the ring, reading back the frame it held
+ *
+ * @return nothing
+ */
+void SGL_OpenGLManager::advanceGPUTimers() noexcept
+{
+    if (pGPUTimerFrames.empty())
+        return;
+    // A scope can't span frames
+    this->endGPUTimer();
+    pGPUTimerFrame = (pGPUTimerFrame + 1) % pGPUTimerFrames.size();
+    collectGPUTimers(pGPUTimerFrames[pGPUTimerFrame]);
+}
+
+/**
+ * @brief Reads the results of a frame's queries into the per scope statistics
+ *
+ * @param frame Queries issued during the frame, emptied
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * Queries whose results aren't ready yet are dropped instead of waited on, the frame still
+ * counts with the scopes that did finish.
+ */
+void SGL_OpenGLManager::collectGPUTimers(std::vector<GPUTimerQuery> &frame) noexcept
+{
+    if (frame.empty())
+        return;
+
+    std::vector<GLuint> dropped;
+    for (const GPUTimerQuery &timer : frame)
+    {
+        GLint available = GL_FALSE;
+        pGL->getQueryObjectiv(timer.query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available == GL_FALSE)
+        {
+            dropped.push_back(timer.query);
+            continue;
+        }
+        GLuint64 elapsed = 0;
+        pGL->getQueryObjectui64v(timer.query, GL_QUERY_RESULT, &elapsed);
+        pGPUTimerFrameNs[timer.scope] += elapsed;
+        pGPUTimerFrameCalls[timer.scope]++;
+        pFreeQueries.push_back(timer.query);
+    }
+    // Still pending on the GPU, the driver frees them once they finish
+    if (!dropped.empty())
+        pGL->deleteQueries(static_cast<GLsizei>(dropped.size()), dropped.data());
+
+    for (std::size_t scope = 0; scope < pGPUTimerStats.size(); ++scope)
+    {
+        if (pGPUTimerFrameCalls[scope] == 0)
+            continue;
+        SGL_GPUTimerStats &stats = pGPUTimerStats[scope];
+        const double ms = pGPUTimerFrameNs[scope] / 1000000.0;
+        stats.averageMs = (stats.averageMs * stats.frames + ms) / (stats.frames + 1);
+        stats.frames++;
+        stats.calls += pGPUTimerFrameCalls[scope];
+        stats.lastMs = ms;
+        stats.maxMs = std::max(stats.maxMs, ms);
+        pGPUTimerFrameNs[scope] = 0;
+        pGPUTimerFrameCalls[scope] = 0;
+    }
+    frame.clear();
+}
+
+/**
+ * @brief GPU time of every scope timed so far
+ * @return std::vector<SGL_GPUTimerStats>
+ */
+const std::vector<SGL_GPUTimerStats> &SGL_OpenGLManager::getGPUTimers() const noexcept
+{
+    return pGPUTimerStats;
+}
+
+/**
+ * @brief Clears the accumulated results, scopes stay registered
+ *
+ * @return nothing
+ */
+void SGL_OpenGLManager::resetGPUTimers() noexcept
+{
+    for (SGL_GPUTimerStats &stats : pGPUTimerStats)
+    {
+        stats.frames = 0;
+        stats.calls = 0;
+        stats.averageMs = 0.0;
+        stats.lastMs = 0.0;
+        stats.maxMs = 0.0;
+    }
+}
+
+/**
+ * @brief Queues a GL object for deletion
+ *
+ * @param type Kind of object
+ * @param ID Object name
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * Commands already submitted may still reference the object, deleting it right away can make
+ * the driver stall or orphan it. Without fence support objects are deleted immediately.
+ */
+void SGL_OpenGLManager::deferDeletion(GL_OBJECT type, GLuint ID) noexcept
+{
+    if (ID == 0)
+        return;
+
+    PendingDeletion object = {type, ID};
+    if (pFenceSync)
+        pDeletionQueue.push_back(object);
+    else
+        destroyObject(object);
+}
+
+/**
+ * @brief Frees a GL object
+ *
+ * @param object Object to free
+ * @return nothing
+ */
+void SGL_OpenGLManager::destroyObject(const PendingDeletion &object) const noexcept
+{
+    switch (object.type)
+    {
+    case GL_OBJECT_BUFFER:
+        pGL->deleteBuffers(1, &object.ID);
+        break;
+    case GL_OBJECT_VERTEX_ARRAY:
+        pGL->deleteVertexArrays(1, &object.ID);
+        break;
+    case GL_OBJECT_FRAMEBUFFER:
+        pGL->deleteFramebuffers(1, &object.ID);
+        break;
+    case GL_OBJECT_TEXTURE:
+        pGL->deleteTextures(1, &object.ID);
+        break;
+    }
+}
+
+/**
+ * @brief Retires the oldest queued frame once its fence signaled
+ *
+ * @param wait Block until the fence signals?
+ * @return bool Was a frame retired?
+ */
+bool SGL_OpenGLManager::retireFrame(bool wait) noexcept
+{
+    if (pFrameFences.empty())
+        return false;
+
+    FrameFence &frame = pFrameFences.front();
+    // Flush on the first wait so the fence is guaranteed to reach the GPU
+    GLbitfield flags = wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0;
+    GLuint64 timeout = wait ? 1000000000 : 0;
+    while (true)
+    {
+        GLenum status = pGL->clientWaitSync(frame.fence, flags, timeout);
+        if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+            break;
+        if (status == GL_WAIT_FAILED)
+        {
+            // Nothing sensible left to wait on, the GL error is reported by checkForGLErrors()
+            SGL_Log("SGL_OpenGLManager::retireFrame | glClientWaitSync failed.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+            break;
+        }
+        if (!wait)
+            return false;
+        flags = 0;
+    }
+
+    pGL->deleteSync(frame.fence);
+    for (const PendingDeletion &object : frame.deletions)
+        destroyObject(object);
+    pFrameFences.pop_front();
+    pFramesRetired++;
+    return true;
+}
+
+/**
+ * @brief Sets how many frames the CPU may submit before waiting for the GPU
+ *
+ * @param frames Frame count, values below 1 are clamped to 1
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * 1 waits for the previous frame every time (lowest latency), higher values trade latency
+ * for throughput.
+ */
+void SGL_OpenGLManager::setFramesInFlight(GLuint frames) noexcept
+{
+    pFramesInFlight = (frames < 1) ? 1 : frames;
+}
+
+/**
+ * @brief Maximum amount of frames queued ahead of the GPU
+ * @return GLuint
+ */
+GLuint SGL_OpenGLManager::getFramesInFlight() const noexcept
+{
+    return pFramesInFlight;
+}
+
+/**
+ * @brief Ends the frame with a fence
+ *
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * Called right after the buffer swap. The objects deleted during the frame are tied to its
+ * fence, if more than getFramesInFlight() frames are unfinished the CPU blocks on the oldest one.
+ * Frames that already finished are retired without waiting. Also advances the GPU timer ring.
+ */
+void SGL_OpenGLManager::fenceFrame() noexcept
+{
+    this->advanceGPUTimers();
+    if (!pFenceSync)
+        return;
+
+    FrameFence frame;
+    frame.fence = pGL->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    frame.deletions.swap(pDeletionQueue);
+    pFrameFences.push_back(std::move(frame));
+    pFramesFenced++;
+
+    while (pFrameFences.size() > pFramesInFlight)
+        retireFrame(true);
+    while (retireFrame(false))
+        ;
+}
+
+/**
+ * @brief Waits for every queued frame and frees every pending deletion
+ *
+ * @return nothing
+ */
+void SGL_OpenGLManager::finishFrames() noexcept
+{
+    // Only ever filled when fences are supported
+    if (!pDeletionQueue.empty())
+        fenceFrame();
+    while (retireFrame(true))
+        ;
+}
+
+/**
+ * @brief Amount of objects waiting for their frame to finish
+ * @return std::size_t
+ */
+std::size_t SGL_OpenGLManager::pendingDeletions() const noexcept
+{
+    std::size_t total = pDeletionQueue.size();
+    for (const FrameFence &frame : pFrameFences)
+        total += frame.deletions.size();
+    return total;
+}
+
+/**
+ * @brief Are frames fenced?
+ * @return bool
+ */
+bool SGL_OpenGLManager::fenceSyncSupported() const noexcept
+{
+    return pFenceSync;
+}
+
+/**
+ * @brief Amount of frames fenced by fenceFrame()
+ * @return std::uint64_t Serial of the last fenced frame
+ */
+std::uint64_t SGL_OpenGLManager::framesFenced() const noexcept
+{
+    return pFramesFenced;
+}
+
+/**
+ * @brief Amount of fenced frames the GPU finished
+ * @return std::uint64_t Every frame up to this serial completed
+ * @section DESCRIPTION
+ *
+ * Fences are only polled by fenceFrame() and finishFrames(), a frame is seen as finished at
+ * the first poll after the GPU signaled it.
+ */
+std::uint64_t SGL_OpenGLManager::framesRetired() const noexcept
+{
+    return pFramesRetired;
+}
+
+/**
+ * @brief Are compute shaders and shader storage buffers available?
+ * @return bool
+ */
+bool SGL_OpenGLManager::computeShaderSupported() const noexcept
+{
+    return pComputeShaders;
+}
+
+/**
+ * @brief Enable or disable a generic vertex attribute array
+ * @param index Specifies the index of the generic vertex attribute to be enabled or disabled.
+ * @return nothing
+ */
+void SGL_OpenGLManager::enableVertexAttribArray(GLuint index) const noexcept
+{
+    pGL->enableVertexAttribArray(index);
+}
+
+/**
+ * @brief Modify the rate at which generic vertex attributes advance during instanced rendering
+ * @param index Specifies the index of the generic vertex attribute to be enabled or disabled.
+ * @param divisor  Specify the number of instances that will pass between updates of the generic attribute at slot index.
+ * @return nothing
+ */
+void SGL_OpenGLManager::vertexAttribDivisor(GLuint index, GLint divisor) const noexcept
+{
+    pGL->vertexAttribDivisor(index, divisor);
+}
+
+/**
+ * @brief Specify the format of a generic vertex attribute, the buffer is supplied by its binding point
+ * @param index Generic vertex attribute
+ * @param size Number of components per attribute
+ * @param type Component data type
+ * @param normalized Normalize fixed-point data
+ * @param relativeOffset Byte offset of the attribute inside a vertex
+ * @return nothing
+ */
+void SGL_OpenGLManager::vertexAttribFormat(GLuint index, GLint size, GLenum type, GLboolean normalized, GLuint relativeOffset) const noexcept
+{
+    pGL->vertexAttribFormat(index, size, type, normalized, relativeOffset);
+}
+
+/**
+ * @brief Associate a generic vertex attribute with a vertex buffer binding point
+ * @param index Generic vertex attribute
+ * @param binding Vertex buffer binding point
+ * @return nothing
+ */
+void SGL_OpenGLManager::vertexAttribBinding(GLuint index, GLuint binding) const noexcept
+{
+    pGL->vertexAttribBinding(index, binding);
+}
+
+/**
+ * @brief Bind a VBO to a vertex buffer binding point of the current VAO
+ * @param binding Vertex buffer binding point
+ * @param name VBO name
+ * @param offset Byte offset of the first vertex
+ * @param stride Byte distance between consecutive vertices
+ * @return nothing
+ */
+void SGL_OpenGLManager::bindVertexBuffer(GLuint binding, const std::string &name, GLintptr offset, GLsizei stride) const noexcept
+{
+    if (VBO.find(name) == VBO.end())
+    {
+#ifdef SGL_OUTPUT_OPENGL_DETAILS
+        SGL_Log("ERROR: VBO NOT FOUND: " + name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_CYAN);
+#endif
+        return;
+    }
+    pGL->bindVertexBuffer(binding, VBO.at(name).ID, offset, stride);
+}
+
+/**
+ * @brief Modify the rate at which the attributes sourced from a binding point advance during instanced rendering
+ * @param binding Vertex buffer binding point
+ * @param divisor Instances that pass between updates, 0 advances per vertex
+ * @return nothing
+ */
+void SGL_OpenGLManager::vertexBindingDivisor(GLuint binding, GLuint divisor) const noexcept
+{
+    pGL->vertexBindingDivisor(binding, divisor);
+}
+
+
+/**
+ * @brief Define an array of generic vertex attribute data
+ *
+ * @param index Specifies the index of the generic vertex attribute to be modified.
+ * @param size Specifies the number of components per generic vertex attribute.
+ * @param type Specifies the data type of each component in the array.
+ * @param normalized For glVertexAttribPointer, specifies whether fixed-point data values should be normalized (GL_TRUE) or converted directly as fixed-point values (GL_FALSE) when they are accessed.
+ * @param stride Specifies the byte offset between consecutive generic vertex attributes.
+ * @param pointer Specifies a offset of the first component of the first generic vertex attribute in the array in the data store of the buffer currently bound to the GL_ARRAY_BUFFER target. The initial value is 0.
+ * @return nothing
+ */
+void SGL_OpenGLManager::vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer) const noexcept
+{
+    pGL->vertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+
+/**
+ * @brief Check for anyhow internal OpenGL errors
+ * @return nothing
+ */
+void SGL_OpenGLManager::checkForGLErrors() noexcept
+{
+    // The debug callback already reported every error as it happened, glGetError would only
+    // serialize the pipeline
+    if (pDebugOutput)
+        return;
+
+    GLenum errCode;
+    // SGL_Log("DEBUG MACRO ENABLED", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+    if ((errCode = pGL->getError()) != GL_NO_ERROR)
+    {
+        if (initialErrorCap == 0)
+        {
+            initialErrorCap++;
+            return;
+        }
+
+        SGL_Log("SkeletonGL OpenGL Error: " + std::string(sglGLErrorString(errCode)), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        SGL_Log("Current shader ID: " + std::to_string(currentShaderID), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        SGL_Log("Current texture ID: " + std::to_string(currentTextureID), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        SGL_Log("Current VAO: " + currentGLBuffers.currentVAO.name + " " + std::to_string(currentGLBuffers.currentVAO.ID), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        //assert(false);
+    }
+}
+
+/**
+ * @brief Returns the total active VBOs
+ * @return int
+ */
+int  SGL_OpenGLManager::totalVBO() const noexcept
+{
+    return VBO.size();
+}
+
+/**
+ * @brief Returns the total active VAOs
+ * @return int
+ */
+int SGL_OpenGLManager::totalVAO() const noexcept
+{
+    return VAO.size();
+}
+
+/**
+ * @brief Returns the total active EBOs
+ * @return int
+ */
+int SGL_OpenGLManager::totalEBO() const noexcept
+{
+    return EBO.size();
+}
+
+/**
+ * @brief Returns the total active FBOs
+ * @return int
+ */
+int SGL_OpenGLManager::totalFBO() const noexcept
+{
+    return FBO.size();
+}
+
+/**
+ * @brief Folds raw bytes into the frame hash (FNV-1a, 64 bits)
+ * @param data Bytes to hash
+ * @param size Amount of bytes
+ * @return nothing
+ */
+void SGL_OpenGLManager::hashFrameData(const void *data, std::size_t size) const noexcept
+{
+    if (!pHashFrames)
+        return;
+
+    pFrameHash = sglFNV1a(pFrameHash, data, size);
+}
+
+/**
+ * @brief Closes the current frame's counters, getFrameCounters() returns them until the next call
+ * @return nothing
+ */
+void SGL_OpenGLManager::endFrameCounters() noexcept
+{
+    pLastFrameCounters = pFrameCounters;
+    pFrameCounters = SGL_FrameCounters();
+}
+
+/**
+ * @brief Draws, state changes and uploads issued through the manager during the last complete frame
+ * @return SGL_FrameCounters
+ */
+const SGL_FrameCounters &SGL_OpenGLManager::getFrameCounters() const noexcept
+{
+    return pLastFrameCounters;
+}
+
+/**
+ * @brief Starts or stops recording the frame hash, recording costs a pass over every uploaded byte
+ * @param enable Record the hash?
+ * @return nothing
+ */
+void SGL_OpenGLManager::enableFrameHashing(bool enable) noexcept
+{
+    pHashFrames = enable;
+    this->resetFrameHash();
+}
+
+/**
+ * @brief Restarts the frame hash
+ * @return nothing
+ */
+void SGL_OpenGLManager::resetFrameHash() noexcept
+{
+    pFrameHash = SGL_FNV1A_OFFSET;
+}
+
+/**
+ * @brief Hash of every command issued through the manager since the last reset
+ * @return std::uint64_t
+ */
+std::uint64_t SGL_OpenGLManager::getFrameHash() const noexcept
+{
+    return pFrameHash;
+}
+
+/**
+ * @brief Closes the frame hash and compares it with the previous frame's
+ * @return bool True if the frame issued the exact same commands as the previous one
+ *
+ * The hash restarts right away instead of when the next frame begins, so projection
+ * changes, uniforms and uploads made between two frames still change the next hash.
+ */
+bool SGL_OpenGLManager::closeFrameHash() noexcept
+{
+    const bool repeated = (pFrameHash == pLastFrameHash);
+    pLastFrameHash = pFrameHash;
+    this->resetFrameHash();
+    return repeated;
 }
@@ -30,12 +30,21 @@
 #include <iostream>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <deque>
+#include <memory>
 #include <sstream>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <functional>
 // Dependencies
 #include <GL/glew.h>
 // SkeletonGL
 #include "../utility/SGL_DataStructures.hpp"
 #include "../utility/SGL_Utility.hpp"
+#include "../utility/SGL_Hash.hpp"
+#include "SGL_GLBackend.hpp"
 
 /**
  * @brief Encapsulates an OpenGL context.
@@ -47,6 +56,7 @@
 class SGL_OpenGLManager
 {
 private:
+    std::unique_ptr<SGL_GLBackend> pGL;       ///< Receives every GL call, the native driver unless replaced
     CurrentSettings currentGLSettings;        ///< OpenGL rendering settings
     CurrentBuffers currentGLBuffers;          ///< Currently active buffers
 
@@ -57,15 +67,125 @@ private:
     std::map<std::string, GLSetting>Settings; ///< Supported OpenGL render settings
     GLuint currentShaderID, currentTextureID; ///< Bound shader and texture IDs
     SGL_Color currentClearColor;              ///< Clear screen color
+    bool pMultiDrawIndirect;                  ///< GL 4.3 / ARB_multi_draw_indirect available
+    bool pComputeShaders;                     ///< GL 4.3 / ARB_compute_shader + ARB_shader_storage_buffer_object available
+    bool pSeparablePrograms;                  ///< GL 4.1 / ARB_separate_shader_objects available
+    bool pProgramBinaries;                    ///< GL 4.1 / ARB_get_program_binary with at least one binary format
+    bool pParallelShaderCompile;              ///< KHR_parallel_shader_compile available
+    bool pDirectStateAccess;                  ///< GL 4.5 / ARB_direct_state_access available, selects the DSA code path
+    std::map<GLuint, GLuint> pPendingPrograms;///< Programs still linking and the placeholder bound in their place
+    std::map<GLuint, std::map<std::string, std::function<void(GLint)>>> pPendingUniforms; ///< Last write to each uniform of a pending program
+    void *pMappedData;                        ///< Currently mapped buffer range, hashed on unmap
+    GLsizeiptr pMappedSize;                   ///< Size of the mapped range, 0 for read only mappings
+    GLuint pOverdrawFBO;                      ///< Draws into this FBO count fragments instead of blending, 0 when off
+    mutable SGL_FrameCounters pFrameCounters; ///< Work issued since the last endFrameCounters()
+    SGL_FrameCounters pLastFrameCounters;     ///< Work issued during the last complete frame
+
+    // Counts an instanced draw call
+    void countInstancedDraw(GLsizei instancecount) const noexcept
+        {
+            pFrameCounters.drawCalls++;
+            pFrameCounters.instancedDraws++;
+            pFrameCounters.instances += instancecount;
+        }
+
+    // FRAMES IN FLIGHT
+    // Every frame ends with a fence, the CPU blocks once more than pFramesInFlight frames are
+    // queued. Deleted objects are kept alive until the fence of the frame that released them signals
+    enum GL_OBJECT : std::uint8_t { GL_OBJECT_BUFFER, GL_OBJECT_VERTEX_ARRAY, GL_OBJECT_FRAMEBUFFER, GL_OBJECT_TEXTURE };
+    struct PendingDeletion
+    {
+        GL_OBJECT type;
+        GLuint ID;
+    };
+    struct FrameFence
+    {
+        GLsync fence;
+        std::vector<PendingDeletion> deletions;
+    };
+    bool pFenceSync;                          ///< GL 3.2 / ARB_sync available
+    GLuint pFramesInFlight;                   ///< Maximum frames the CPU may queue ahead of the GPU
+    std::vector<PendingDeletion> pDeletionQueue;///< Objects released during the current frame
+    std::deque<FrameFence> pFrameFences;      ///< Unfinished frames, oldest first
+    std::uint64_t pFramesFenced;              ///< Frames fenced since creation
+    std::uint64_t pFramesRetired;             ///< Fenced frames the GPU finished, in submission order
+
+    // DEBUG OUTPUT
+    bool pDebugSupported;                     ///< GL 4.3 / KHR_debug available
+    bool pDebugOutput;                        ///< Is the debug callback installed?
+    SGL_DebugCallSite pDebugCallSite;         ///< Innermost SGL_DEBUG_SCOPE, reported with every message
+
+    // Receives the driver's debug messages, userParam is the manager
+    static void GLAPIENTRY debugMessageCallback(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                                GLsizei length, const GLchar *message, const void *userParam);
+
+    // Releases an object once the GPU is done with the current frame
+    void deferDeletion(GL_OBJECT type, GLuint ID) noexcept;
+    // Frees the GL object
+    void destroyObject(const PendingDeletion &object) const noexcept;
+    // Checks (or waits for) the oldest frame fence, frees its objects once it signaled
+    bool retireFrame(bool wait) noexcept;
 
     // Currently, an opengl error arises when checking for
     // errors after initializing the GL context, doesn't
     // seem to affect rendering at all
     uint8_t initialErrorCap;
 
+    // GPU TIMERS
+    // Scopes are timed with GL_TIME_ELAPSED queries, every frame fills one slot of a ring that is
+    // read back GPU_TIMER_LATENCY frames later, by then the results are ready and reading them
+    // doesn't stall. Elapsed time queries can't nest, a scope entered while another one is being
+    // timed is counted as part of the outer one
+    struct GPUTimerQuery
+    {
+        std::size_t scope;
+        GLuint query;
+    };
+    bool pGPUTimersSupported;                 ///< GL 3.3 / ARB_timer_query available
+    bool pGPUTimers;                          ///< Are scopes being timed?
+    bool pGPUTimerActive;                     ///< Is an elapsed time query running?
+    std::vector<GLuint> pFreeQueries;         ///< Query objects ready to be reused
+    std::vector<std::vector<GPUTimerQuery>> pGPUTimerFrames;///< Ring of issued queries, one slot per frame
+    std::size_t pGPUTimerFrame;               ///< Slot of the current frame
+    std::unordered_map<const char *, std::size_t> pGPUTimerScopes;///< Scope name to index into pGPUTimerStats
+    std::vector<SGL_GPUTimerStats> pGPUTimerStats;///< Per scope results
+    std::vector<GLuint64> pGPUTimerFrameNs;   ///< Per scope time of the slot being read back
+    std::vector<std::uint32_t> pGPUTimerFrameCalls;///< Per scope calls of the slot being read back
+
+    // Index of the scope, registered on first use
+    std::size_t gpuTimerScope(const char *name);
+    // Reads back the oldest slot of the ring and makes it the current one
+    void advanceGPUTimers() noexcept;
+    // Folds a slot into the per scope results and recycles its queries
+    void collectGPUTimers(std::vector<GPUTimerQuery> &frame) noexcept;
+
+    // FRAME FINGERPRINT
+    // Every state change, upload and draw issued through the manager is folded into
+    // a FNV-1a hash, two frames with the same hash issued the exact same commands
+    enum FRAME_HASH_CMD : std::uint8_t { BIND_VBO, BIND_EBO, BIND_VAO, BIND_FBO, UNBIND_FBO, BIND_TEXTURE, ACTIVE_TEXTURE,
+                                         USE_PROGRAM, UNIFORM, BLENDING, CAPABILITY, CLEAR_COLOR, CLEAR, VIEWPORT,
+                                         LINE_WIDTH, POINT_SIZE, BUFFER_DATA, BUFFER_SUB_DATA, TEX_IMAGE, FBO_TEXTURE,
+                                         BLIT, DRAW, DISPATCH };
+    mutable std::uint64_t pFrameHash;         ///< Hash of the commands issued since the last resetFrameHash()
+    std::uint64_t pLastFrameHash;             ///< Hash of the previous frame, kept by closeFrameHash()
+    bool pHashFrames;                         ///< Is the frame hash being recorded?
+
+    // Folds raw bytes into the frame hash
+    void hashFrameData(const void *data, std::size_t size) const noexcept;
+    // Folds a command and its arguments into the frame hash
+    template <typename... Args>
+    void hashFrameCall(FRAME_HASH_CMD cmd, Args... args) const noexcept
+        {
+            if (!pHashFrames)
+                return;
+            hashFrameData(&cmd, sizeof(cmd));
+            int expand[] = { 0, (hashFrameData(&args, sizeof(args)), 0)... };
+            (void)expand;
+        }
+
 public:
-    // Constructor
-    SGL_OpenGLManager();
+    // Constructor, a null backend selects the native driver
+    explicit SGL_OpenGLManager(std::unique_ptr<SGL_GLBackend> backend = nullptr);
 
     // Destructor
     ~SGL_OpenGLManager();
@@ -91,6 +211,8 @@ public:
     void bindVAO(const std::string &name) noexcept;
     // Bind the selected FBO
     void bindFBO(const std::string &name, GLCONSTANTS::FBO type = GLCONSTANTS::RW) noexcept;
+    // Bind the selected buffer (created with createVBO) as the draw indirect buffer
+    void bindDIBO(const std::string &name) noexcept;
     // Unbind the current buffer
     void unbindVBO() noexcept;
     // Unbind the current EBO
@@ -99,15 +221,25 @@ public:
     void unbindVAO() noexcept;
     // Unbind the current FBO
     void unbindFBO() noexcept;
+    // Unbind the draw indirect buffer
+    void unbindDIBO() noexcept;
+    // Bind the selected buffer (created with createVBO) as the pixel pack buffer, readPixels() writes into it
+    void bindPBO(const std::string &name) noexcept;
+    // Unbind the pixel pack buffer
+    void unbindPBO() noexcept;
+    // Bind the selected buffer (created with createVBO) to an indexed shader storage binding point
+    void bindSSBO(GLuint index, const std::string &name) noexcept;
+    // Clear an indexed shader storage binding point
+    void unbindSSBO(GLuint index) noexcept;
     // Cleans all buffer storage
     void clearBuffers() noexcept;
-    // Deletes all the VBO
+    // Deletes a VBO, the GL buffer is freed once the GPU finished the current frame
     void deleteVBO(const std::string &name) noexcept;
-    // Deletes all the EBO
+    // Deletes an EBO, the GL buffer is freed once the GPU finished the current frame
     void deleteEBO(const std::string &name) noexcept;
-    // Deletes all the VAO
+    // Deletes a VAO, the GL object is freed once the GPU finished the current frame
     void deleteVAO(const std::string &name) noexcept;
-    // Deletes all the FBO
+    // Deletes a FBO, the GL object is freed once the GPU finished the current frame
     void deleteFBO(const std::string &name) noexcept;
 
     // Activates the specified shader program
@@ -135,6 +267,50 @@ public:
     // Gets the program log
     void getProgramInfoLog(GLuint shader,  GLsizei maxLength, GLsizei *length, GLchar *infoLog) const noexcept;
 
+    // SEPARABLE PROGRAMS
+    // Compiles and links a single stage separable program
+    GLuint createShaderProgramv(GLenum type, GLsizei count, const GLchar *const *strings) const noexcept;
+    // Generate program pipeline names
+    void genProgramPipelines(GLsizei n, GLuint *pipelines) const noexcept;
+    // Delete program pipelines
+    void deleteProgramPipelines(GLsizei n, const GLuint *pipelines) const noexcept;
+    // Bind a program pipeline, only used while no program is active through useProgram()
+    void bindProgramPipeline(GLuint pipeline) noexcept;
+    // Attach the stages of a separable program to a pipeline
+    void useProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) const noexcept;
+    // Select the pipeline stage program that receives glUniform* calls
+    void activeShaderProgram(GLuint pipeline, GLuint program) const noexcept;
+    // Check whether the pipeline can execute in the current state
+    void validateProgramPipeline(GLuint pipeline) const noexcept;
+    // Get pipeline data
+    void getProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) const noexcept;
+    // Get the pipeline log
+    void getProgramPipelineInfoLog(GLuint pipeline, GLsizei maxLength, GLsizei *length, GLchar *infoLog) const noexcept;
+    // Are separable programs and program pipelines available?
+    bool separableProgramsSupported() const noexcept;
+
+    // PROGRAM BINARIES
+    // Set a program parameter, GL_PROGRAM_BINARY_RETRIEVABLE_HINT must be set before linking
+    void programParameteri(GLuint program, GLenum pname, GLint value) const noexcept;
+    // Retrieve the driver specific binary of a linked program
+    void getProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) const noexcept;
+    // Load a program from a binary retrieved with getProgramBinary(), check its link status
+    void programBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) const noexcept;
+    // Can linked programs be saved and reloaded as binaries?
+    bool programBinarySupported() const noexcept;
+
+    // PARALLEL COMPILATION
+    // Can the compile / link status be polled without blocking?
+    bool parallelShaderCompileSupported() const noexcept;
+    // useProgram() binds placeholder instead of program until the placeholder is cleared
+    void setProgramPlaceholder(GLuint program, GLuint placeholder) noexcept;
+    // program finished linking, bind it from now on, linked replays the uniforms deferred meanwhile
+    void clearProgramPlaceholder(GLuint program, bool linked) noexcept;
+    // Is program replaced by a placeholder?
+    bool programPending(GLuint program) const noexcept;
+    // Keeps the last write to a uniform of a pending program, write receives the location once it links
+    void deferProgramUniform(GLuint program, const GLchar *name, std::function<void(GLint)> write);
+
     // Sets a uniform location from the specified shader
     GLint getUniformLocation(GLuint program, const GLchar *name) const noexcept;
     // Sets a float uniform location from the specified shader
@@ -156,6 +332,74 @@ public:
     // Sets a 1fv from the specified shader
     void uniform1fv(GLint location, GLsizei count, const GLfloat *value) const noexcept;
 
+    // DIRECT STATE ACCESS
+    // These edit an object by name, with GL 4.5 / ARB_direct_state_access nothing gets bound, older contexts
+    // fall back to bind-to-edit. Uniforms fall back to the current program, use() it first
+    // Replace data of a buffer created with createVBO
+    void namedBufferSubData(const std::string &name, GLintptr offset, GLsizeiptr size, const GLvoid *data) noexcept;
+    // Set a parameter of a 2D texture
+    void textureParameteri(GLuint texture, GLenum pname, GLint param) const noexcept;
+    // Set uniforms of a program
+    void programUniform1f(GLuint program, GLint location, GLfloat v0) const noexcept;
+    void programUniform1i(GLuint program, GLint location, GLint v0) const noexcept;
+    void programUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) const noexcept;
+    void programUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) const noexcept;
+    void programUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) const noexcept;
+    void programUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) const noexcept;
+    // Is the DSA code path active?
+    bool directStateAccessSupported() const noexcept;
+    // Backend receiving the GL calls, cast it to SGL_RecordingGLBackend to read its statistics
+    SGL_GLBackend &getBackend() const noexcept;
+
+    // FRAMES IN FLIGHT
+    // Maximum frames the CPU may queue ahead of the GPU, at least 1
+    void setFramesInFlight(GLuint frames) noexcept;
+    GLuint getFramesInFlight() const noexcept;
+    // Fences the frame just submitted, blocks while too many frames are queued and frees finished deletions
+    void fenceFrame() noexcept;
+    // Waits for every queued frame and frees all pending deletions
+    void finishFrames() noexcept;
+    // Objects waiting for their frame fence
+    std::size_t pendingDeletions() const noexcept;
+    // Are frames fenced? Without ARB_sync the counters below stay at 0
+    bool fenceSyncSupported() const noexcept;
+    // Frames fenced so far, the serial of the last one
+    std::uint64_t framesFenced() const noexcept;
+    // Frames the GPU is known to have finished, every serial up to this one completed
+    std::uint64_t framesRetired() const noexcept;
+
+    // DEBUG OUTPUT
+    // Install or remove the KHR_debug callback, messages less severe than minSeverity are filtered by the driver
+    void enableDebugOutput(bool enable, GLenum minSeverity = GL_DEBUG_SEVERITY_MEDIUM) noexcept;
+    // Is the debug callback installed?
+    bool debugOutputEnabled() const noexcept;
+    // Is KHR_debug available?
+    bool debugOutputSupported() const noexcept;
+    // Name an object in debug messages and GPU debuggers, only while the debug output is enabled
+    void objectLabel(GLenum identifier, GLuint name, const std::string &label) const noexcept;
+    // Set the call site reported with debug messages, returns the previous one
+    SGL_DebugCallSite setDebugCallSite(const SGL_DebugCallSite &site) noexcept;
+
+    // GPU TIMERS
+    // Time SGL_GPU_TIMER_SCOPE blocks on the GPU
+    void enableGPUTimers(bool enable) noexcept;
+    bool gpuTimersEnabled() const noexcept;
+    bool gpuTimersSupported() const noexcept;
+    // Starts timing a scope, returns false if timers are off or another scope is being timed
+    bool beginGPUTimer(const char *name) noexcept;
+    // Stops timing the current scope
+    void endGPUTimer() noexcept;
+    // Per scope GPU time, results lag GPU_TIMER_LATENCY frames behind
+    const std::vector<SGL_GPUTimerStats> &getGPUTimers() const noexcept;
+    // Clear the accumulated results
+    void resetGPUTimers() noexcept;
+
+    // FRAME COUNTERS
+    // Closes the current frame's counters, called once per frame after the buffer swap
+    void endFrameCounters() noexcept;
+    // Work issued during the last complete frame
+    const SGL_FrameCounters &getFrameCounters() const noexcept;
+
     // Sets the clear screen color
     void setClearColor(SGL_Color &newColor) const noexcept;
     // Clears the color buffer
@@ -172,6 +416,10 @@ public:
     void faceCulling(bool value) noexcept;
     // Set blending type
     void blending(bool value = true, BLENDING_TYPE type = BLENDING_TYPE::DEFAULT_RENDERING, GLenum sfactor = 0, GLenum dfactor = 0) noexcept;
+    // Every draw into the FBO halves its contents instead of blending, empty restores normal blending
+    void setOverdrawTarget(const std::string &name) noexcept;
+    // Is an overdraw target set?
+    bool overdrawActive() const noexcept;
 
     // Generate a texture
     void genTextures(GLsizei n, GLuint *textures) const noexcept;
@@ -179,10 +427,12 @@ public:
     void bindTexture(GLenum target, GLuint texture) const noexcept;
     // Activates a texture
     void activeTexture(GLenum texture) noexcept;
-    // Deletes textures
-    void deleteTextures(GLsizei n, const GLuint *textures) const noexcept;
+    // Deletes textures once the GPU finished the current frame
+    void deleteTextures(GLsizei n, const GLuint *textures) noexcept;
     // Texture pixel format
     void pixelStorei(GLenum pname, GLint param) const noexcept;
+    // Read a block of pixels from the read framebuffer, data is an offset while a pixel pack buffer is bound
+    void readPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *data) const noexcept;
     // Texture creation parameters
     void texParameteri(GLenum target, GLenum pname, GLint param) const noexcept;
     // Texture creation parameters
@@ -196,20 +446,55 @@ public:
     void drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) const noexcept;
     // Draw multiple instances of a set of elements
     void drawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) const noexcept;
+    // Draw multiple instances of a range of elements with an offset applied to instanced attributes
+    void drawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) const noexcept;
+    // Render multiple sets of primitives from array data, parameters read from the bound draw indirect buffer
+    void multiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) const noexcept;
+    // Render multiple sets of indexed primitives, parameters read from the bound draw indirect buffer
+    void multiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) const noexcept;
+    // Is glMultiDraw*Indirect available?
+    bool multiDrawIndirectSupported() const noexcept;
+    // Render primitives from array data, parameters read from the bound draw indirect buffer
+    void drawArraysIndirect(GLenum mode, const void *indirect) const noexcept;
+    // Launch compute work groups with the active program
+    void dispatchCompute(GLuint groupsX, GLuint groupsY, GLuint groupsZ) const noexcept;
+    // Order memory transactions issued by shaders
+    void memoryBarrier(GLbitfield barriers) const noexcept;
+    // Are compute shaders and shader storage buffers available?
+    bool computeShaderSupported() const noexcept;
     // Add data to buffer
     void bufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage) const noexcept;
     // Replace data to buffer
     void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data) const noexcept;
+    // Map a range of the buffer bound to target into client memory
+    void *mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) noexcept;
+    // Release the mapping of the buffer bound to target
+    bool unmapBuffer(GLenum target) noexcept;
     // Enable or disable a generic vertex attribute array
     void enableVertexAttribArray(GLuint index) const noexcept;
     // Define an array of generic vertex attribute data
     void vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer) const noexcept;
     // modify the rate at which generic vertex attributes advance during instanced rendering
     void vertexAttribDivisor(GLuint index, GLint divisor) const noexcept;
+    // Specify the format of a generic vertex attribute, separate from its buffer
+    void vertexAttribFormat(GLuint index, GLint size, GLenum type, GLboolean normalized, GLuint relativeOffset) const noexcept;
+    // Associate a generic vertex attribute with a vertex buffer binding point
+    void vertexAttribBinding(GLuint index, GLuint binding) const noexcept;
+    // Bind a VBO to a vertex buffer binding point of the current VAO
+    void bindVertexBuffer(GLuint binding, const std::string &name, GLintptr offset, GLsizei stride) const noexcept;
+    // Modify the rate at which the attributes sourced from a binding point advance during instanced rendering
+    void vertexBindingDivisor(GLuint binding, GLuint divisor) const noexcept;
     // Deletes a compiled and linked shader program
     void deleteProgram(GLuint program) const noexcept;
     // Generate framebuffer
     void frameBufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) const noexcept;
+    // Renderbuffer objects, owned by the caller
+    void genRenderbuffers(GLsizei n, GLuint *renderbuffers) const noexcept;
+    void deleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) const noexcept;
+    void bindRenderbuffer(GLenum target, GLuint renderbuffer) const noexcept;
+    void renderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) const noexcept;
+    // Attach a renderbuffer to the bound framebuffer
+    void framebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) const noexcept;
     // Render framebuffer
     void blitFrameBuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) const noexcept;
 
@@ -235,7 +520,79 @@ public:
     // En / Dis able OpenGL capabilities
     void enable(GLenum cap) const noexcept;
     void disable(GLenum cap) const noexcept;
+
+    // Start / stop recording the frame hash
+    void enableFrameHashing(bool enable) noexcept;
+    // Restart the frame hash
+    void resetFrameHash() noexcept;
+    // Hash of every command issued since the last reset
+    std::uint64_t getFrameHash() const noexcept;
+    // Ends the frame's hash, true if it matches the previous frame, then restarts it so state set
+    // before the next frame begins is part of the next hash
+    bool closeFrameHash() noexcept;
     // void toggleLineAA(bool toggle) const noexcept;
 };
 
+/**
+ * @brief Marks the enclosing function as the call site of the GL calls it issues
+ * @section DESCRIPTION
+ *
+ * Debug messages raised while the scope is alive name the function, file and line. Use it
+ * through SGL_DEBUG_SCOPE, defining SGL_DISABLE_GL_DEBUG compiles every scope out.
+ */
+class SGL_DebugScope
+{
+private:
+    SGL_OpenGLManager &pOGLM;                 ///< Manager receiving the call site
+    SGL_DebugCallSite pPrevious;              ///< Call site restored on exit
+
+    // Disable all copy and move constructors
+    SGL_DebugScope(const SGL_DebugScope&) = delete;
+    SGL_DebugScope *operator = (const SGL_DebugScope&) = delete;
+    SGL_DebugScope(SGL_DebugScope &&) = delete;
+    SGL_DebugScope &operator = (SGL_DebugScope &&) = delete;
+
+public:
+    SGL_DebugScope(SGL_OpenGLManager &oglm, const char *function, const char *file, int line) noexcept
+        : pOGLM(oglm), pPrevious(oglm.setDebugCallSite({function, file, line})) {}
+    ~SGL_DebugScope() { pOGLM.setDebugCallSite(pPrevious); }
+};
+
+#ifdef SGL_DISABLE_GL_DEBUG
+#define SGL_DEBUG_SCOPE(oglm)
+#else
+#define SGL_DEBUG_SCOPE(oglm) SGL_DebugScope sglDebugScope((oglm), __func__, __FILE__, __LINE__)
+#endif
+
+/**
+ * @brief Times the enclosing block on the GPU
+ * @section DESCRIPTION
+ *
+ * Does nothing unless the manager's GPU timers are enabled. Use it through SGL_GPU_TIMER_SCOPE,
+ * defining SGL_DISABLE_GPU_TIMERS compiles every scope out. The name must outlive the manager.
+ */
+class SGL_GPUTimerScope
+{
+private:
+    SGL_OpenGLManager &pOGLM;                 ///< Manager issuing the queries
+    bool pTiming;                             ///< Did this scope start a query?
+
+    // Disable all copy and move constructors
+    SGL_GPUTimerScope(const SGL_GPUTimerScope&) = delete;
+    SGL_GPUTimerScope *operator = (const SGL_GPUTimerScope&) = delete;
+    SGL_GPUTimerScope(SGL_GPUTimerScope &&) = delete;
+    SGL_GPUTimerScope &operator = (SGL_GPUTimerScope &&) = delete;
+
+public:
+    SGL_GPUTimerScope(SGL_OpenGLManager &oglm, const char *name) noexcept
+        : pOGLM(oglm), pTiming(oglm.beginGPUTimer(name)) {}
+    ~SGL_GPUTimerScope() { if (pTiming) pOGLM.endGPUTimer(); }
+};
+
+#ifdef SGL_DISABLE_GPU_TIMERS
+#define SGL_GPU_TIMER_SCOPE(oglm, name)
+#else
+#define SGL_GPU_TIMER_SCOPE(oglm, name) SGL_GPUTimerScope sglGPUTimerScope((oglm), (name))
+#endif
+
 #endif // SRC_SKELETONGL_RENDERER_OPENGLMANAGER_HPP
@@ -45,6 +45,7 @@ void SGL_PostProcessor::deleteBuffers()
     WMOGLM->deleteFBO(pMainFBO);
     WMOGLM->deleteFBO(pSecondaryFBO);
     WMOGLM->deleteVBO(pMainVBO);
+    this->enableOverdraw(false);
 }
 
 /**
@@ -55,7 +56,7 @@ void SGL_PostProcessor::deleteBuffers()
  * @return nothing
  */
 SGL_PostProcessor::SGL_PostProcessor(std::shared_ptr<SGL_OpenGLManager> oglm, const SGL_Shader &defaultShader) :
-    confuse(GL_FALSE), shake(GL_FALSE), chaos(GL_FALSE)
+    pTime(0.0f), pOverdraw(false), pOverdrawReads(0), confuse(GL_FALSE), shake(GL_FALSE), chaos(GL_FALSE)
 {
     if (defaultShader.shaderType == SHADER_TYPE::POST_PROCESSOR)
         pShader = defaultShader;
@@ -68,6 +69,16 @@ SGL_PostProcessor::SGL_PostProcessor(std::shared_ptr<SGL_OpenGLManager> oglm, co
     this->pSecondaryFBO = "_Secondary_SGL_PostProcessor_FBO";
     this->pMainVAO = "_Primary_SGL_PostProcessor_VAO";
     this->pMainVBO = "_Primary_SGL_PostProcessor_VBO";
+    this->pOverdrawFBO = "_Overdraw_SGL_PostProcessor_FBO";
+    for (std::uint32_t i = 0; i < OVERDRAW_READBACK_FRAMES; ++i)
+        this->pOverdrawPBOs.push_back("_Overdraw_SGL_PostProcessor_PBO_" + std::to_string(i));
+
+    // One float channel, sampled as is so the layer count isn't filtered
+    this->pOverdrawTexture.ID = 0;
+    this->pOverdrawTexture.internalFormat = GL_R32F;
+    this->pOverdrawTexture.imageFormat = GL_RED;
+    this->pOverdrawTexture.filterMin = GL_NEAREST;
+    this->pOverdrawTexture.filterMax = GL_NEAREST;
 }
 
 
@@ -92,6 +103,7 @@ void SGL_PostProcessor::setClearColor(SGL_Color color) noexcept
  */
 void SGL_PostProcessor::reload(GLuint newWidth, GLuint newHeight)
 {
+    SGL_DEBUG_SCOPE(*WMOGLM);
     pHeight = newHeight;
     pWidth = newWidth;
     // Init frame buffer and render buffer objects
@@ -99,19 +111,19 @@ void SGL_PostProcessor::reload(GLuint newWidth, GLuint newHeight)
     WMOGLM->createFBO(pMainFBO);
     WMOGLM->createFBO(pSecondaryFBO);
 
-    glDeleteRenderbuffers(1, &this->pRBO);
-    glGenRenderbuffers(1, &this->pRBO);
+    WMOGLM->deleteRenderbuffers(1, &this->pRBO);
+    WMOGLM->genRenderbuffers(1, &this->pRBO);
 
     // Initialize renderbuffer storage with a multisampled color buffer (don't need a depth/stencil buffer)
     WMOGLM->bindFBO(this->pMainFBO);
 
-    glBindRenderbuffer(GL_RENDERBUFFER, this->pRBO);
+    WMOGLM->bindRenderbuffer(GL_RENDERBUFFER, this->pRBO);
     // Allocate storage for render buffer object
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGB, pWidth, pHeight);
+    WMOGLM->renderbufferStorage(GL_RENDERBUFFER, GL_RGB, pWidth, pHeight);
     //glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, pWidth, pHeight);
     WMOGLM->checkForGLErrors();
 
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, pRBO);
+    WMOGLM->framebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, pRBO);
     //glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, pRBO);
     WMOGLM->checkForGLErrors();
 
@@ -135,37 +147,161 @@ void SGL_PostProcessor::reload(GLuint newWidth, GLuint newHeight)
     }
     WMOGLM->unbindFBO();
 
+    if (pOverdraw)
+        this->loadOverdrawTarget();
+
     // Load buffers and init data
     this->loadBuffers();
     this->pShader.setInteger(*WMOGLM, "scene", 0, GL_TRUE);
+}
+
+
+/**
+ * @brief Creates the overdraw FBO, its float texture and the readback ring at the current size
+ *
+ * @return nothing
+ */
+void SGL_PostProcessor::loadOverdrawTarget()
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    if (this->pOverdrawTexture.ID != 0)
+        WMOGLM->deleteTextures(1, &this->pOverdrawTexture.ID);
+
+    WMOGLM->createFBO(this->pOverdrawFBO);
+    WMOGLM->bindFBO(this->pOverdrawFBO);
+    this->pOverdrawTexture.generate(*WMOGLM, pWidth, pHeight, NULL);
+    WMOGLM->frameBufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, this->pOverdrawTexture.ID, 0);
+    if (WMOGLM->checkFrameBufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        WMOGLM->checkForGLErrors();
+        SGL_Log("ERROR::POST_PROCESSOR: Failed to initialize the overdraw FBO", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    }
+    WMOGLM->unbindFBO();
+
+    // Each buffer holds a whole frame, they're only ever written by the GPU
+    const GLsizeiptr size = sizeof(GLfloat) * pWidth * pHeight;
+    for (const std::string &pbo : this->pOverdrawPBOs)
+    {
+        WMOGLM->createVBO(pbo);
+        WMOGLM->bindPBO(pbo);
+        WMOGLM->bufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    }
+    WMOGLM->unbindPBO();
 
-    // GLfloat offset = 1.0f / 300.0f;
-    // GLfloat offsets[9][2] = {
-    //     { -offset,  offset  },  // top-left
-    //     {  0.0f,    offset  },  // top-center
-    //     {  offset,  offset  },  // top-right
-    //     { -offset,  0.0f    },  // center-left
-    //     {  0.0f,    0.0f    },  // center-center
-    //     {  offset,  0.0f    },  // center - right
-    //     { -offset, -offset  },  // bottom-left
-    //     {  0.0f,   -offset  },  // bottom-center
-    //     {  offset, -offset  }   // bottom-right
-    // };
-    // WMOGLM->uniform2fv(glGetUniformLocation(this->pShader.ID, "offsets"), 9, (GLfloat*)offsets);
-    // GLint edge_kernel[9] = {
-    //     -1, -1, -1,
-    //     -1,  8, -1,
-    //     -1, -1, -1
-    // };
-    // WMOGLM->uniform1iv(glGetUniformLocation(this->pShader.ID, "edge_kernel"), 9, edge_kernel);
-    // GLfloat blur_kernel[9] = {
-    //     1.0 / 16, 2.0 / 16, 1.0 / 16,
-    //     2.0 / 16, 4.0 / 16, 2.0 / 16,
-    //     1.0 / 16, 2.0 / 16, 1.0 / 16
-    // };
-    // WMOGLM->uniform1fv(glGetUniformLocation(this->pShader.ID, "blur_kernel"), 9, blur_kernel);
+    pOverdrawReads = 0;
+    pOverdrawStats = SGL_OverdrawStats();
 }
 
+/**
+ * @brief Toggles the overdraw view
+ * @section DESCRIPTION
+ *
+ * Every primitive rendered between beginRender() and endRender() adds one layer to the
+ * pixels it covers, whatever its shader or blending mode. Offscreen render layers are
+ * composited as a single layer.
+ *
+ * @param enable Render the overdraw view instead of the scene?
+ * @return nothing
+ */
+void SGL_PostProcessor::enableOverdraw(bool enable)
+{
+    if (enable == pOverdraw)
+        return;
+    pOverdraw = enable;
+
+    if (pOverdraw)
+    {
+        this->loadOverdrawTarget();
+        WMOGLM->setOverdrawTarget(this->pOverdrawFBO);
+    }
+    else
+    {
+        WMOGLM->setOverdrawTarget("");
+        WMOGLM->deleteFBO(this->pOverdrawFBO);
+        for (const std::string &pbo : this->pOverdrawPBOs)
+            WMOGLM->deleteVBO(pbo);
+        if (this->pOverdrawTexture.ID != 0)
+            WMOGLM->deleteTextures(1, &this->pOverdrawTexture.ID);
+        this->pOverdrawTexture.ID = 0;
+    }
+}
+
+/**
+ * @brief Is the overdraw view enabled?
+ * @return bool
+ */
+bool SGL_PostProcessor::overdrawEnabled() const noexcept
+{
+    return pOverdraw;
+}
+
+/**
+ * @brief Fragments per pixel of the overdraw view
+ *
+ * @return SGL_OverdrawStats Decoded OVERDRAW_READBACK_FRAMES - 1 frames after being rendered
+ */
+const SGL_OverdrawStats &SGL_PostProcessor::getOverdrawStats() const noexcept
+{
+    return pOverdrawStats;
+}
+
+/**
+ * @brief Queues a readback of the overdraw target and decodes the oldest one in the ring
+ *
+ * @return nothing
+ */
+void SGL_PostProcessor::readOverdraw() noexcept
+{
+    SGL_TRACE_ZONE("SGL_PostProcessor::readOverdraw");
+    const std::size_t pixels = static_cast<std::size_t>(pWidth) * pHeight;
+    // R32F targets flush denormals, halving 2^-126 once more already stores zero
+    const std::uint32_t saturated = 127;
+
+    WMOGLM->bindFBO(this->pOverdrawFBO, GLCONSTANTS::R);
+    WMOGLM->bindPBO(this->pOverdrawPBOs[pOverdrawReads % OVERDRAW_READBACK_FRAMES]);
+    WMOGLM->readPixels(0, 0, pWidth, pHeight, GL_RED, GL_FLOAT, nullptr);
+    pOverdrawReads++;
+
+    // The next buffer in the ring is the oldest one, the GPU had a few frames to fill it
+    if (pOverdrawReads >= OVERDRAW_READBACK_FRAMES)
+    {
+        WMOGLM->bindPBO(this->pOverdrawPBOs[pOverdrawReads % OVERDRAW_READBACK_FRAMES]);
+        const GLfloat *data = static_cast<const GLfloat *>(
+            WMOGLM->mapBufferRange(GL_PIXEL_PACK_BUFFER, 0, sizeof(GLfloat) * pixels, GL_MAP_READ_BIT));
+        if (data != nullptr)
+        {
+            std::uint64_t fragments = 0;
+            std::uint32_t max = 0;
+            for (std::size_t i = 0; i < pixels; ++i)
+            {
+                // A pixel covered n times holds 2^-n, frexp() returns its exponent as 1 - n
+                int exponent = 0;
+                std::frexp(data[i], &exponent);
+                std::uint32_t layers = (data[i] <= 0.0f) ? saturated : (exponent < 1) ? static_cast<std::uint32_t>(1 - exponent) : 0;
+                fragments += layers;
+                max = std::max(max, layers);
+            }
+            pOverdrawStats.fragments = fragments;
+            pOverdrawStats.max = max;
+            pOverdrawStats.average = (pixels > 0) ? static_cast<double>(fragments) / pixels : 0.0;
+            pOverdrawStats.width = pWidth;
+            pOverdrawStats.height = pHeight;
+            pOverdrawStats.frame++;
+            WMOGLM->unmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+    }
+    WMOGLM->unbindPBO();
+}
+
+/**
+ * @brief FBO the scene is rendered into
+ *
+ * @return std::string The overdraw target while the overdraw view is enabled
+ */
+const std::string &SGL_PostProcessor::sceneFBO() const noexcept
+{
+    return pOverdraw ? this->pOverdrawFBO : this->pMainFBO;
+}
 
 /**
  * @brief Must be called before rendering
@@ -174,14 +310,30 @@ void SGL_PostProcessor::reload(GLuint newWidth, GLuint newHeight)
  */
 void SGL_PostProcessor::beginRender() noexcept
 {
-    WMOGLM->bindFBO(this->pMainFBO);
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    WMOGLM->bindFBO(this->sceneFBO());
     //SGL_Color color{1.0f, 1.0f, 1.0f, 1.0f};
-    WMOGLM->setClearColor(pClearColor);
+    // The overdraw target starts at 2^0, zero layers
+    SGL_Color clearColor = pOverdraw ? SGL_Color(1.0f, 1.0f, 1.0f, 1.0f) : pClearColor;
+    WMOGLM->setClearColor(clearColor);
     WMOGLM->clearColorBuffer();
     //WMOGLM->clearDepthBuffer();
 }
 
 
+/**
+ * @brief Rebinds the framebuffer and its viewport without clearing, used to return
+ * from an offscreen render target mid frame
+ *
+ * @return nothing
+ */
+void SGL_PostProcessor::resumeRender() noexcept
+{
+    WMOGLM->bindFBO(this->sceneFBO());
+    WMOGLM->resizeGL(0, 0, this->pWidth, this->pHeight);
+}
+
+
 /**
  * @brief Must be called after rendering
  *
@@ -189,6 +341,16 @@ void SGL_PostProcessor::beginRender() noexcept
  */
 void SGL_PostProcessor::endRender() noexcept
 {
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_PostProcessor::endRender");
+    SGL_TRACE_ZONE("SGL_PostProcessor::endRender");
+    // The overdraw target is sampled directly, there's nothing to resolve
+    if (pOverdraw)
+    {
+        this->readOverdraw();
+        WMOGLM->unbindFBO();
+        return;
+    }
     // Resolve multisampled color-buffer into intermediate FBO to store to texture
     WMOGLM->bindFBO(this->pMainFBO, GLCONSTANTS::R);
     WMOGLM->bindFBO(this->pSecondaryFBO, GLCONSTANTS::W);
@@ -198,6 +360,26 @@ void SGL_PostProcessor::endRender() noexcept
 
 
 
+/**
+ * @brief Variant key of the enabled effects
+ *
+ * @return std::uint32_t SGL_PP_VARIANT bits, 0 if no effect is enabled
+ */
+std::uint32_t SGL_PostProcessor::variantKey() const noexcept
+{
+    // The other effects would distort the layer counts
+    if (pOverdraw)
+        return SGL_PP_VARIANT::OVERDRAW;
+    std::uint32_t key = 0;
+    if (confuse)
+        key |= SGL_PP_VARIANT::CONFUSE;
+    if (chaos)
+        key |= SGL_PP_VARIANT::CHAOS;
+    if (shake)
+        key |= SGL_PP_VARIANT::SHAKE;
+    return key;
+}
+
 /**
  * @brief Render the final texture to the screen
  *
@@ -207,6 +389,9 @@ void SGL_PostProcessor::endRender() noexcept
  */
 void SGL_PostProcessor::render(const SGL_Shader &shader, UV_Wrapper *UVdata)
 {
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_PostProcessor::render");
+    SGL_TRACE_ZONE("SGL_PostProcessor::render");
     SGL_Shader activeShader;
     activeShader = shader;
 
@@ -223,8 +408,7 @@ void SGL_PostProcessor::render(const SGL_Shader &shader, UV_Wrapper *UVdata)
             UVdata->UV_botRight.x / pWidth, UVdata->UV_botRight.y / pHeight
         };
         WMOGLM->bindVAO(this->pMainVAO);
-        WMOGLM->bindVBO(this->pTextureCoordVBO);
-        WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(UV), &UV[0]);
+        WMOGLM->namedBufferSubData(this->pTextureCoordVBO, 0, sizeof(UV), &UV[0]);
     }
     else
     {
@@ -238,8 +422,7 @@ void SGL_PostProcessor::render(const SGL_Shader &shader, UV_Wrapper *UVdata)
             1.0f, 1.0f //bot right
         };
         WMOGLM->bindVAO(this->pMainVAO);
-        WMOGLM->bindVBO(this->pTextureCoordVBO);
-        WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(UV), &UV[0]);
+        WMOGLM->namedBufferSubData(this->pTextureCoordVBO, 0, sizeof(UV), &UV[0]);
     }
 
     WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
@@ -247,12 +430,15 @@ void SGL_PostProcessor::render(const SGL_Shader &shader, UV_Wrapper *UVdata)
     activeShader.setFloat(*WMOGLM, "deltaTime", activeShader.renderDetails.deltaTime);
     activeShader.setVector2f(*WMOGLM, "textureDimensions", pWidth, pHeight);
     activeShader.setVector2f(*WMOGLM, "mousePosition", activeShader.renderDetails.mousePosX, activeShader.renderDetails.mousePosY);
-    // activeShader.setInteger(*WMOGLM, "confuse", this->confuse);
-    // activeShader.setInteger(*WMOGLM, "chaos", this->chaos);
-    // activeShader.setInteger(*WMOGLM, "shake", this->shake);
+    // Effects are compiled into the shader variant, only their clock is a uniform
+    pTime += activeShader.renderDetails.deltaTime;
+    activeShader.setFloat(*WMOGLM, "time", pTime);
     // Render textured quad
     WMOGLM->activeTexture(GL_TEXTURE0);
-    this->pTexture.bind(*WMOGLM);
+    if (pOverdraw)
+        this->pOverdrawTexture.bind(*WMOGLM);
+    else
+        this->pTexture.bind(*WMOGLM);
     WMOGLM->bindVAO(this->pMainVAO);
     WMOGLM->drawArrays(GL_TRIANGLES, 0, 6);
     WMOGLM->unbindVAO();
@@ -303,14 +489,8 @@ void SGL_PostProcessor::loadBuffers()
     WMOGLM->bindVBO(this->pMainVBO);
     WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
     // Link it to the shader
-    // VBO
-    WMOGLM->bindVBO(this->pMainVBO);
-    WMOGLM->enableVertexAttribArray(0);
-    WMOGLM->vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GL_FLOAT), (GLvoid*)0);
-    // UVCoords
-    WMOGLM->bindVBO(this->pTextureCoordVBO);
-    WMOGLM->enableVertexAttribArray(1);
-    WMOGLM->vertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), (GLvoid*)0);
+    SGL_PositionLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pMainVBO);
+    SGL_UVLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::UVS, this->pTextureCoordVBO);
 
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
@@ -27,20 +27,43 @@
 #include <iostream>
 #include <string>
 #include <memory>
+#include <vector>
+#include <cstdint>
+#include <cmath>
 // Dependencies
 #include <GL/glew.h>
 // SkeletonGL
 #include "../utility/SGL_DataStructures.hpp"
 #include "../utility/SGL_Utility.hpp"
+#include "../utility/SGL_Trace.hpp"
 #include "SGL_OpenGLManager.hpp"
 #include "SGL_Shader.hpp"
 #include "SGL_Texture.hpp"
+#include "SGL_VertexLayout.hpp"
+
+/**
+ * @brief Post processor effects, each one is a define compiled into a variant of the built-in
+ * post processor shader, the key bits follow the order of SGL_PP_VARIANT::DEFINES
+ */
+namespace SGL_PP_VARIANT
+{
+    const std::uint32_t CONFUSE = 1 << 0;
+    const std::uint32_t CHAOS = 1 << 1;
+    const std::uint32_t SHAKE = 1 << 2;
+    const std::uint32_t OVERDRAW = 1 << 3;
+    const std::vector<std::string> DEFINES = {"SGL_PP_CONFUSE", "SGL_PP_CHAOS", "SGL_PP_SHAKE", "SGL_PP_OVERDRAW"};
+}
 
 /**
  * @brief Post processor for the final texture to be rendered, adds effects and filters
  * @section DESCRIPTION
  *
  * This class encapsulates all final effects.
+ *
+ * The overdraw view redirects the frame into a single channel float target cleared to 1.0
+ * that the OpenGL manager halves on every fragment, the final pass turns the exponent back
+ * into a layer count and maps it through a color ramp. The target is also read back through
+ * a ring of pixel pack buffers, consumed a few frames later so the CPU never waits on the GPU.
  */
 class SGL_PostProcessor
 {
@@ -56,9 +79,22 @@ private:
     //NOTE: until this leaves testing, keep teh texture here and not in the manager
     SGL_Texture pTexture;                                                      ///< SGL texture for the FBO
     SGL_Color pClearColor;                                                     ///< Clear screen color
+    float pTime;                                                               ///< Seconds rendered, drives the animated effects
+    bool pOverdraw;                                                            ///< Render the overdraw view instead of the scene
+    std::string pOverdrawFBO;                                                  ///< Fragment count target
+    SGL_Texture pOverdrawTexture;                                              ///< GL_R32F color attachment of the overdraw FBO
+    std::vector<std::string> pOverdrawPBOs;                                    ///< Readback ring, one buffer per frame in flight
+    std::uint64_t pOverdrawReads;                                              ///< Readbacks issued since the target was created
+    SGL_OverdrawStats pOverdrawStats;                                          ///< Last decoded readback
 
     // Load the buffer data
     void loadBuffers();
+    // (Re)creates the overdraw target and its readback buffers at the current size
+    void loadOverdrawTarget();
+    // Queues this frame's readback and decodes the oldest one
+    void readOverdraw() noexcept;
+    // FBO the scene is rendered into
+    const std::string &sceneFBO() const noexcept;
 
     // Disable all copying and moving to protect BO
     SGL_PostProcessor(const SGL_PostProcessor&) = delete;
@@ -67,6 +103,8 @@ private:
     SGL_PostProcessor &operator = (SGL_PostProcessor &&) = delete;
 
 public:
+    static const std::uint32_t OVERDRAW_READBACK_FRAMES = 3; ///< Frames between an overdraw readback and its decoding
+
     GLboolean confuse, chaos, shake; ///< Toggle the corresponding effect
     // Start the PP with the window's opengl context and the default shader (rander the FBO without any effects)
     SGL_PostProcessor(std::shared_ptr<SGL_OpenGLManager> oglm, const SGL_Shader &defaultShader);
@@ -80,8 +118,17 @@ public:
     void deleteBuffers();
     // Prepare the postpocessor framebuffer operations (before any rendering)
     void beginRender() noexcept;
+    // Rebind the framebuffer without clearing it (after rendering to an offscreen layer)
+    void resumeRender() noexcept;
     // Call it once the rendering is done so it stores everything into a texture object
     void endRender() noexcept;
+    // Variant key of the enabled effects (SGL_PP_VARIANT bits)
+    std::uint32_t variantKey() const noexcept;
+    // Render the overdraw view instead of the scene
+    void enableOverdraw(bool enable);
+    bool overdrawEnabled() const noexcept;
+    // Fragments per pixel, lags OVERDRAW_READBACK_FRAMES frames behind
+    const SGL_OverdrawStats &getOverdrawStats() const noexcept;
 
     // Render the final texture (a screen sized sprite)
     // Render with specific UV coords (camera zoom for example)
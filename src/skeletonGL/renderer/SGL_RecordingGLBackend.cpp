@@ -0,0 +1,603 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/renderer/SGL_RecordingGLBackend.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief OpenGL backend that records calls instead of executing them
+ *
+ * @section DESCRIPTION
+ *
+ * See SGL_RecordingGLBackend.hpp
+ */
+
+#include "SGL_RecordingGLBackend.hpp"
+
+/**
+ * @brief Constructor
+ *
+ * @param features Features reported to the OpenGL manager
+ * @return nothing
+ */
+SGL_RecordingGLBackend::SGL_RecordingGLBackend(const SGL_GLFeatures &features)
+    : pFeatures(features), pRecordStream(false), pNextName(1), pNextSync(1), pMappedWrite(false)
+{
+
+}
+
+/**
+ * @brief Features of a GL 4.4 core context, the version SGL_Window requests
+ * @return SGL_GLFeatures
+ */
+SGL_GLFeatures SGL_RecordingGLBackend::coreFeatures() noexcept
+{
+    SGL_GLFeatures features;
+    features.multiDrawIndirect = true;
+    features.computeShaders = true;
+    features.separablePrograms = true;
+    features.programBinaries = true;
+    features.fenceSync = true;
+    features.timerQuery = true;
+    return features;
+}
+
+/**
+ * @brief Category an entry point is counted under
+ *
+ * @param call Entry point
+ * @return SGL_GL_CATEGORY
+ */
+SGL_GL_CATEGORY SGL_RecordingGLBackend::callCategory(SGL_GL_CALL call) noexcept
+{
+#define SGL_GL_ENTRY_CATEGORY(recording, category, ret, method, glName, params, args) SGL_GL_CATEGORY::category,
+    static const SGL_GL_CATEGORY categories[] = { SGL_GL_ENTRY_POINTS(SGL_GL_ENTRY_CATEGORY) };
+#undef SGL_GL_ENTRY_CATEGORY
+    return categories[static_cast<std::size_t>(call)];
+}
+
+/**
+ * @brief GL function name of an entry point
+ *
+ * @param call Entry point
+ * @return const char*
+ */
+const char *SGL_RecordingGLBackend::callName(SGL_GL_CALL call) noexcept
+{
+#define SGL_GL_ENTRY_NAME(recording, category, ret, method, glName, params, args) #glName,
+    static const char *names[] = { SGL_GL_ENTRY_POINTS(SGL_GL_ENTRY_NAME) };
+#undef SGL_GL_ENTRY_NAME
+    return names[static_cast<std::size_t>(call)];
+}
+
+/**
+ * @brief Readable name of a category
+ *
+ * @param category Call category
+ * @return const char*
+ */
+const char *SGL_RecordingGLBackend::categoryName(SGL_GL_CATEGORY category) noexcept
+{
+    static const char *names[] = {"create", "delete", "state", "uniform", "upload", "draw", "shader", "query", "sync", "debug"};
+    return names[static_cast<std::size_t>(category)];
+}
+
+/**
+ * @brief Keep the formatted call stream?
+ *
+ * @param enable Record every call as text, expensive
+ * @return nothing
+ */
+void SGL_RecordingGLBackend::recordCallStream(bool enable) noexcept
+{
+    pRecordStream = enable;
+}
+
+/**
+ * @brief Clears the counters and the call stream, usually once per frame
+ *
+ * @return nothing
+ */
+void SGL_RecordingGLBackend::reset() noexcept
+{
+    pStats = SGL_GLCallStats();
+    pStream.clear();
+}
+
+/**
+ * @brief Counters since the last reset()
+ * @return SGL_GLCallStats
+ */
+const SGL_GLCallStats &SGL_RecordingGLBackend::stats() const noexcept
+{
+    return pStats;
+}
+
+/**
+ * @brief Calls to an entry point since the last reset()
+ *
+ * @param call Entry point
+ * @return std::uint64_t
+ */
+std::uint64_t SGL_RecordingGLBackend::callCount(SGL_GL_CALL call) const noexcept
+{
+    return pStats.calls[static_cast<std::size_t>(call)];
+}
+
+/**
+ * @brief Calls of a category since the last reset()
+ *
+ * @param category Call category
+ * @return std::uint64_t
+ */
+std::uint64_t SGL_RecordingGLBackend::categoryCount(SGL_GL_CATEGORY category) const noexcept
+{
+    return pStats.categories[static_cast<std::size_t>(category)];
+}
+
+/**
+ * @brief Names created and not yet deleted
+ * @return std::size_t
+ */
+std::size_t SGL_RecordingGLBackend::liveObjects() const noexcept
+{
+    return pLiveObjects.size();
+}
+
+/**
+ * @brief Recorded calls since the last reset(), empty unless recordCallStream() is enabled
+ * @return std::vector<std::string>
+ */
+const std::vector<std::string> &SGL_RecordingGLBackend::callStream() const noexcept
+{
+    return pStream;
+}
+
+/**
+ * @brief Writes the counters
+ *
+ * @param out Destination stream
+ * @return nothing
+ */
+void SGL_RecordingGLBackend::dumpStats(std::ostream &out) const
+{
+    out << "calls: " << pStats.totalCalls << "\n";
+    for (std::size_t i = 0; i < pStats.categories.size(); ++i)
+        out << "  " << categoryName(static_cast<SGL_GL_CATEGORY>(i)) << ": " << pStats.categories[i] << "\n";
+    out << "bytes uploaded: " << pStats.bytesUploaded << "\n";
+    out << "bytes allocated: " << pStats.bytesAllocated << "\n";
+    out << "objects created: " << pStats.objectsCreated << " deleted: " << pStats.objectsDeleted << " live: " << pLiveObjects.size() << "\n";
+    for (std::size_t i = 0; i < pStats.calls.size(); ++i)
+    {
+        if (pStats.calls[i] > 0)
+            out << "  " << callName(static_cast<SGL_GL_CALL>(i)) << ": " << pStats.calls[i] << "\n";
+    }
+}
+
+/**
+ * @brief Writes the recorded calls
+ *
+ * @param out Destination stream
+ * @return nothing
+ */
+void SGL_RecordingGLBackend::dumpCalls(std::ostream &out) const
+{
+    for (const std::string &call : pStream)
+        out << call << "\n";
+}
+
+/**
+ * @brief Features reported to the OpenGL manager
+ * @return SGL_GLFeatures
+ */
+SGL_GLFeatures SGL_RecordingGLBackend::features() const noexcept
+{
+    return pFeatures;
+}
+
+/**
+ * @brief Hands out unique object names
+ *
+ * @param n Amount of names
+ * @param names Destination
+ * @return nothing
+ */
+void SGL_RecordingGLBackend::createNames(GLsizei n, GLuint *names)
+{
+    for (GLsizei i = 0; i < n; ++i)
+    {
+        names[i] = pNextName++;
+        pLiveObjects.insert(names[i]);
+    }
+    pStats.objectsCreated += n;
+    recordNames(n, names);
+}
+
+/**
+ * @brief Releases object names
+ *
+ * @param n Amount of names
+ * @param names Names to release
+ * @return nothing
+ */
+void SGL_RecordingGLBackend::deleteNames(GLsizei n, const GLuint *names)
+{
+    for (GLsizei i = 0; i < n; ++i)
+    {
+        if (pLiveObjects.erase(names[i]) > 0)
+            pStats.objectsDeleted++;
+    }
+}
+
+/**
+ * @brief Appends the names handed out to the last recorded call
+ *
+ * @param n Amount of names
+ * @param names Created names
+ * @return nothing
+ */
+void SGL_RecordingGLBackend::recordNames(GLsizei n, const GLuint *names)
+{
+    if (!pRecordStream || pStream.empty())
+        return;
+    std::string &call = pStream.back();
+    call += " ->";
+    for (GLsizei i = 0; i < n; ++i)
+        call += " " + std::to_string(names[i]);
+}
+
+/**
+ * @brief Writes an empty, NUL terminated info log
+ *
+ * @param bufSize Size of infoLog
+ * @param length Written length, may be null
+ * @param infoLog Destination
+ * @return nothing
+ */
+void SGL_RecordingGLBackend::emptyLog(GLsizei bufSize, GLsizei *length, GLchar *infoLog) noexcept
+{
+    if (length != nullptr)
+        *length = 0;
+    if (bufSize > 0 && infoLog != nullptr)
+        infoLog[0] = '\0';
+}
+
+// Entry points without side effects are only counted
+#define SGL_GL_UNPACK(...) __VA_ARGS__
+#define SGL_GL_RECORD_AUTO(recording, category, ret, method, glName, params, args) \
+    ret SGL_RecordingGLBackend::method params { record(SGL_GL_CALL::method, #glName, SGL_GL_UNPACK args); }
+#define SGL_GL_RECORD_CUSTOM(recording, category, ret, method, glName, params, args)
+#define SGL_GL_ENTRY_RECORDING(recording, category, ret, method, glName, params, args) \
+    SGL_GL_RECORD_##recording(recording, category, ret, method, glName, params, args)
+SGL_GL_ENTRY_POINTS(SGL_GL_ENTRY_RECORDING)
+#undef SGL_GL_ENTRY_RECORDING
+#undef SGL_GL_RECORD_CUSTOM
+#undef SGL_GL_RECORD_AUTO
+#undef SGL_GL_UNPACK
+
+// CREATE
+void SGL_RecordingGLBackend::createBuffers(GLsizei n, GLuint *buffers)
+{
+    record(SGL_GL_CALL::createBuffers, "glCreateBuffers", n, buffers);
+    createNames(n, buffers);
+}
+
+void SGL_RecordingGLBackend::createFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+    record(SGL_GL_CALL::createFramebuffers, "glCreateFramebuffers", n, framebuffers);
+    createNames(n, framebuffers);
+}
+
+GLuint SGL_RecordingGLBackend::createProgram()
+{
+    record(SGL_GL_CALL::createProgram, "glCreateProgram");
+    GLuint program;
+    createNames(1, &program);
+    return program;
+}
+
+GLuint SGL_RecordingGLBackend::createShader(GLenum type)
+{
+    record(SGL_GL_CALL::createShader, "glCreateShader", type);
+    GLuint shader;
+    createNames(1, &shader);
+    return shader;
+}
+
+GLuint SGL_RecordingGLBackend::createShaderProgramv(GLenum type, GLsizei count, const GLchar *const *strings)
+{
+    record(SGL_GL_CALL::createShaderProgramv, "glCreateShaderProgramv", type, count, strings);
+    GLuint program;
+    createNames(1, &program);
+    return program;
+}
+
+void SGL_RecordingGLBackend::createVertexArrays(GLsizei n, GLuint *arrays)
+{
+    record(SGL_GL_CALL::createVertexArrays, "glCreateVertexArrays", n, arrays);
+    createNames(n, arrays);
+}
+
+void SGL_RecordingGLBackend::genBuffers(GLsizei n, GLuint *buffers)
+{
+    record(SGL_GL_CALL::genBuffers, "glGenBuffers", n, buffers);
+    createNames(n, buffers);
+}
+
+void SGL_RecordingGLBackend::genFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+    record(SGL_GL_CALL::genFramebuffers, "glGenFramebuffers", n, framebuffers);
+    createNames(n, framebuffers);
+}
+
+void SGL_RecordingGLBackend::genProgramPipelines(GLsizei n, GLuint *pipelines)
+{
+    record(SGL_GL_CALL::genProgramPipelines, "glGenProgramPipelines", n, pipelines);
+    createNames(n, pipelines);
+}
+
+void SGL_RecordingGLBackend::genQueries(GLsizei n, GLuint *ids)
+{
+    record(SGL_GL_CALL::genQueries, "glGenQueries", n, ids);
+    createNames(n, ids);
+}
+
+void SGL_RecordingGLBackend::genRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+    record(SGL_GL_CALL::genRenderbuffers, "glGenRenderbuffers", n, renderbuffers);
+    createNames(n, renderbuffers);
+}
+
+void SGL_RecordingGLBackend::genTextures(GLsizei n, GLuint *textures)
+{
+    record(SGL_GL_CALL::genTextures, "glGenTextures", n, textures);
+    createNames(n, textures);
+}
+
+void SGL_RecordingGLBackend::genVertexArrays(GLsizei n, GLuint *arrays)
+{
+    record(SGL_GL_CALL::genVertexArrays, "glGenVertexArrays", n, arrays);
+    createNames(n, arrays);
+}
+
+// DELETE
+void SGL_RecordingGLBackend::deleteBuffers(GLsizei n, const GLuint *buffers)
+{
+    record(SGL_GL_CALL::deleteBuffers, "glDeleteBuffers", n, buffers);
+    deleteNames(n, buffers);
+}
+
+void SGL_RecordingGLBackend::deleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+    record(SGL_GL_CALL::deleteFramebuffers, "glDeleteFramebuffers", n, framebuffers);
+    deleteNames(n, framebuffers);
+}
+
+void SGL_RecordingGLBackend::deleteProgram(GLuint program)
+{
+    record(SGL_GL_CALL::deleteProgram, "glDeleteProgram", program);
+    deleteNames(1, &program);
+}
+
+void SGL_RecordingGLBackend::deleteProgramPipelines(GLsizei n, const GLuint *pipelines)
+{
+    record(SGL_GL_CALL::deleteProgramPipelines, "glDeleteProgramPipelines", n, pipelines);
+    deleteNames(n, pipelines);
+}
+
+void SGL_RecordingGLBackend::deleteQueries(GLsizei n, const GLuint *ids)
+{
+    record(SGL_GL_CALL::deleteQueries, "glDeleteQueries", n, ids);
+    deleteNames(n, ids);
+}
+
+void SGL_RecordingGLBackend::deleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+    record(SGL_GL_CALL::deleteRenderbuffers, "glDeleteRenderbuffers", n, renderbuffers);
+    deleteNames(n, renderbuffers);
+}
+
+void SGL_RecordingGLBackend::deleteShader(GLuint shader)
+{
+    record(SGL_GL_CALL::deleteShader, "glDeleteShader", shader);
+    deleteNames(1, &shader);
+}
+
+void SGL_RecordingGLBackend::deleteTextures(GLsizei n, const GLuint *textures)
+{
+    record(SGL_GL_CALL::deleteTextures, "glDeleteTextures", n, textures);
+    deleteNames(n, textures);
+}
+
+void SGL_RecordingGLBackend::deleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+    record(SGL_GL_CALL::deleteVertexArrays, "glDeleteVertexArrays", n, arrays);
+    deleteNames(n, arrays);
+}
+
+// UPLOAD
+void SGL_RecordingGLBackend::bufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    record(SGL_GL_CALL::bufferData, "glBufferData", target, size, data, usage);
+    if (data != nullptr)
+        pStats.bytesUploaded += size;
+    else
+        pStats.bytesAllocated += size;
+}
+
+void SGL_RecordingGLBackend::bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    record(SGL_GL_CALL::bufferSubData, "glBufferSubData", target, offset, size, data);
+    pStats.bytesUploaded += size;
+}
+
+void SGL_RecordingGLBackend::namedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    record(SGL_GL_CALL::namedBufferSubData, "glNamedBufferSubData", buffer, offset, size, data);
+    pStats.bytesUploaded += size;
+}
+
+void SGL_RecordingGLBackend::texImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,
+                                        GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    record(SGL_GL_CALL::texImage2D, "glTexImage2D", target, level, internalformat, width, height, border, format, type, pixels);
+    // SkeletonGL only uploads 8 bit channels
+    std::uint64_t channels = 4;
+    if (format == GL_RED)
+        channels = 1;
+    else if (format == GL_RG)
+        channels = 2;
+    else if (format == GL_RGB || format == GL_BGR)
+        channels = 3;
+    std::uint64_t size = static_cast<std::uint64_t>(width) * height * channels;
+    if (pixels != nullptr)
+        pStats.bytesUploaded += size;
+    else
+        pStats.bytesAllocated += size;
+}
+
+void *SGL_RecordingGLBackend::mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    record(SGL_GL_CALL::mapBufferRange, "glMapBufferRange", target, offset, length, access);
+    // The caller writes through the pointer, hand out real memory
+    pMappedData.resize(length);
+    pMappedWrite = (access & GL_MAP_WRITE_BIT) != 0;
+    return pMappedData.data();
+}
+
+GLboolean SGL_RecordingGLBackend::unmapBuffer(GLenum target)
+{
+    record(SGL_GL_CALL::unmapBuffer, "glUnmapBuffer", target);
+    if (pMappedWrite)
+        pStats.bytesUploaded += pMappedData.size();
+    pMappedWrite = false;
+    return GL_TRUE;
+}
+
+// QUERY
+GLenum SGL_RecordingGLBackend::checkFramebufferStatus(GLenum target)
+{
+    record(SGL_GL_CALL::checkFramebufferStatus, "glCheckFramebufferStatus", target);
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+GLenum SGL_RecordingGLBackend::getError()
+{
+    record(SGL_GL_CALL::getError, "glGetError");
+    return GL_NO_ERROR;
+}
+
+void SGL_RecordingGLBackend::getIntegerv(GLenum pname, GLint *data)
+{
+    record(SGL_GL_CALL::getIntegerv, "glGetIntegerv", pname, data);
+    // No program binary formats, the program cache stays off
+    *data = 0;
+}
+
+void SGL_RecordingGLBackend::getProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+    record(SGL_GL_CALL::getProgramBinary, "glGetProgramBinary", program, bufSize, length, binaryFormat, binary);
+    if (length != nullptr)
+        *length = 0;
+    *binaryFormat = 0;
+}
+
+void SGL_RecordingGLBackend::getProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    record(SGL_GL_CALL::getProgramInfoLog, "glGetProgramInfoLog", program, bufSize, length, infoLog);
+    emptyLog(bufSize, length, infoLog);
+}
+
+void SGL_RecordingGLBackend::getProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    record(SGL_GL_CALL::getProgramPipelineInfoLog, "glGetProgramPipelineInfoLog", pipeline, bufSize, length, infoLog);
+    emptyLog(bufSize, length, infoLog);
+}
+
+void SGL_RecordingGLBackend::getProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params)
+{
+    record(SGL_GL_CALL::getProgramPipelineiv, "glGetProgramPipelineiv", pipeline, pname, params);
+    *params = (pname == GL_VALIDATE_STATUS) ? GL_TRUE : 0;
+}
+
+void SGL_RecordingGLBackend::getProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    record(SGL_GL_CALL::getProgramiv, "glGetProgramiv", program, pname, params);
+    // Every program links instantly and without a log
+    switch (pname)
+    {
+    case GL_LINK_STATUS:
+    case GL_VALIDATE_STATUS:
+    case GL_COMPLETION_STATUS_KHR:
+        *params = GL_TRUE;
+        break;
+    default:
+        *params = 0;
+        break;
+    }
+}
+
+void SGL_RecordingGLBackend::getQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+{
+    record(SGL_GL_CALL::getQueryObjectiv, "glGetQueryObjectiv", id, pname, params);
+    // Results are available as soon as they are asked for
+    *params = (pname == GL_QUERY_RESULT_AVAILABLE) ? GL_TRUE : 0;
+}
+
+void SGL_RecordingGLBackend::getQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+{
+    record(SGL_GL_CALL::getQueryObjectui64v, "glGetQueryObjectui64v", id, pname, params);
+    // Nothing ran on a GPU
+    *params = 0;
+}
+
+void SGL_RecordingGLBackend::getShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    record(SGL_GL_CALL::getShaderInfoLog, "glGetShaderInfoLog", shader, bufSize, length, infoLog);
+    emptyLog(bufSize, length, infoLog);
+}
+
+void SGL_RecordingGLBackend::getShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    record(SGL_GL_CALL::getShaderiv, "glGetShaderiv", shader, pname, params);
+    // Every shader compiles instantly and without a log
+    switch (pname)
+    {
+    case GL_COMPILE_STATUS:
+    case GL_COMPLETION_STATUS_KHR:
+        *params = GL_TRUE;
+        break;
+    default:
+        *params = 0;
+        break;
+    }
+}
+
+GLint SGL_RecordingGLBackend::getUniformLocation(GLuint program, const GLchar *name)
+{
+    record(SGL_GL_CALL::getUniformLocation, "glGetUniformLocation", program, name);
+    return 0;
+}
+
+// SYNC
+GLenum SGL_RecordingGLBackend::clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    record(SGL_GL_CALL::clientWaitSync, "glClientWaitSync", sync, flags, timeout);
+    return GL_ALREADY_SIGNALED;
+}
+
+GLsync SGL_RecordingGLBackend::fenceSync(GLenum condition, GLbitfield flags)
+{
+    record(SGL_GL_CALL::fenceSync, "glFenceSync", condition, flags);
+    // Never dereferenced, only has to be unique and non null
+    return reinterpret_cast<GLsync>(pNextSync++);
+}
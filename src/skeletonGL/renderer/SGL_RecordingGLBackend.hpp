@@ -0,0 +1,165 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/renderer/SGL_RecordingGLBackend.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief OpenGL backend that records calls instead of executing them
+ *
+ * @section DESCRIPTION
+ *
+ * Accepts every entry point without a GL context. Object names are handed out and tracked,
+ * shaders always compile, framebuffers are always complete and fences are always signaled,
+ * so SGL_OpenGLManager and everything built on it run unmodified. Calls are counted per entry
+ * point and per category together with the bytes uploaded, the call stream can be kept and
+ * dumped. Used to measure and regression test the CPU side of the renderer on headless machines.
+ */
+
+#ifndef SRC_SKELETONGL_RENDERER_RECORDINGGLBACKEND_HPP
+#define SRC_SKELETONGL_RENDERER_RECORDINGGLBACKEND_HPP
+
+// C++
+#include <array>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <sstream>
+#include <tuple>
+#include <utility>
+#include <cstdint>
+#include <unordered_set>
+// SkeletonGL
+#include "SGL_GLBackend.hpp"
+
+/**
+ * @brief Totals gathered by SGL_RecordingGLBackend since the last reset()
+ */
+struct SGL_GLCallStats
+{
+    std::array<std::uint64_t, static_cast<std::size_t>(SGL_GL_CALL::COUNT)> calls;          ///< Per entry point
+    std::array<std::uint64_t, static_cast<std::size_t>(SGL_GL_CATEGORY::COUNT)> categories; ///< Per category
+    std::uint64_t totalCalls;                   ///< Every entry point
+    std::uint64_t bytesUploaded;                ///< Buffer and texture data handed to GL, mapped ranges included
+    std::uint64_t bytesAllocated;               ///< Buffer storage allocated without data
+    std::uint64_t objectsCreated;               ///< Names handed out
+    std::uint64_t objectsDeleted;               ///< Names released
+    SGL_GLCallStats() : totalCalls(0), bytesUploaded(0), bytesAllocated(0), objectsCreated(0), objectsDeleted(0)
+        {
+            calls.fill(0);
+            categories.fill(0);
+        }
+};
+
+/**
+ * @brief Null OpenGL backend that records every call
+ * @section DESCRIPTION
+ *
+ * Pass it to the SGL_OpenGLManager constructor. features() reports a plain GL 4.4 core context
+ * unless told otherwise, so the same code paths run as on most desktop drivers.
+ */
+class SGL_RecordingGLBackend : public SGL_GLBackend
+{
+private:
+    SGL_GLFeatures pFeatures;                   ///< Reported to the OpenGL manager
+    SGL_GLCallStats pStats;                     ///< Counters since the last reset()
+    bool pRecordStream;                         ///< Keep every formatted call?
+    std::vector<std::string> pStream;           ///< Formatted calls since the last reset()
+    GLuint pNextName;                           ///< Next object name, shared by every object type
+    std::unordered_set<GLuint> pLiveObjects;    ///< Names created and not yet deleted
+    std::uintptr_t pNextSync;                   ///< Next fake fence handle
+    std::vector<unsigned char> pMappedData;     ///< Storage handed out by mapBufferRange
+    bool pMappedWrite;                          ///< Does the current mapping count as an upload?
+
+    // Counts a call and appends it to the stream
+    template <typename... Args>
+    void record(SGL_GL_CALL call, const char *name, Args... args)
+        {
+            pStats.calls[static_cast<std::size_t>(call)]++;
+            pStats.categories[static_cast<std::size_t>(callCategory(call))]++;
+            pStats.totalCalls++;
+            if (pRecordStream)
+                pStream.push_back(formatCall(name, args...));
+        }
+    // Formats a call as name(arg, arg, ...)
+    template <typename... Args>
+    static std::string formatCall(const char *name, Args... args)
+        {
+            std::ostringstream call;
+            call << name << "(";
+            const char *separator = "";
+            int expand[] = {0, ((call << separator), formatArg(call, args), separator = ", ", 0)...};
+            (void)expand;
+            (void)separator;
+            call << ")";
+            return call.str();
+        }
+    template <typename T>
+    static void formatArg(std::ostream &out, T value) { out << value; }
+    template <typename T>
+    static void formatArg(std::ostream &out, T *value) { out << static_cast<const void *>(value); }
+    static void formatArg(std::ostream &out, GLboolean value) { out << static_cast<int>(value); }
+    static void formatArg(std::ostream &out, GLDEBUGPROC) { out << "callback"; }
+
+    // Hands out n names
+    void createNames(GLsizei n, GLuint *names);
+    // Releases n names, unknown names are ignored like GL does
+    void deleteNames(GLsizei n, const GLuint *names);
+    // Appends the created names to the last recorded call
+    void recordNames(GLsizei n, const GLuint *names);
+    // Writes an empty info log
+    static void emptyLog(GLsizei bufSize, GLsizei *length, GLchar *infoLog) noexcept;
+
+    // Disable all copy and move constructors
+    SGL_RecordingGLBackend(const SGL_RecordingGLBackend&) = delete;
+    SGL_RecordingGLBackend *operator = (const SGL_RecordingGLBackend&) = delete;
+    SGL_RecordingGLBackend(SGL_RecordingGLBackend &&) = delete;
+    SGL_RecordingGLBackend &operator = (SGL_RecordingGLBackend &&) = delete;
+
+public:
+    // Constructor
+    explicit SGL_RecordingGLBackend(const SGL_GLFeatures &features = coreFeatures());
+
+    // Features of a GL 4.4 core context without DSA, debug output or parallel compilation
+    static SGL_GLFeatures coreFeatures() noexcept;
+    // Category an entry point is counted under
+    static SGL_GL_CATEGORY callCategory(SGL_GL_CALL call) noexcept;
+    // GL function name of an entry point
+    static const char *callName(SGL_GL_CALL call) noexcept;
+    // Readable name of a category
+    static const char *categoryName(SGL_GL_CATEGORY category) noexcept;
+
+    // Keep the formatted call stream, off by default
+    void recordCallStream(bool enable) noexcept;
+    // Clear the counters and the call stream, live objects are kept
+    void reset() noexcept;
+    // Counters since the last reset()
+    const SGL_GLCallStats &stats() const noexcept;
+    std::uint64_t callCount(SGL_GL_CALL call) const noexcept;
+    std::uint64_t categoryCount(SGL_GL_CATEGORY category) const noexcept;
+    // Names created and not yet deleted
+    std::size_t liveObjects() const noexcept;
+    // Recorded calls since the last reset()
+    const std::vector<std::string> &callStream() const noexcept;
+    // Write the counters, one entry point per line
+    void dumpStats(std::ostream &out) const;
+    // Write the recorded calls, one per line
+    void dumpCalls(std::ostream &out) const;
+
+    SGL_GLFeatures features() const noexcept override;
+
+#define SGL_GL_ENTRY_RECORDING(recording, category, ret, method, glName, params, args) ret method params override;
+    SGL_GL_ENTRY_POINTS(SGL_GL_ENTRY_RECORDING)
+#undef SGL_GL_ENTRY_RECORDING
+};
+
+#endif // SRC_SKELETONGL_RENDERER_RECORDINGGLBACKEND_HPP
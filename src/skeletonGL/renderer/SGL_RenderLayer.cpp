@@ -0,0 +1,198 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/renderer/SGL_RenderLayer.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Offscreen render target that caches a slow changing part of the scene
+ *
+ * @section DESCRIPTION
+ *
+ * See SGL_RenderLayer.hpp
+ */
+
+#include "SGL_RenderLayer.hpp"
+
+/**
+ * @brief Constructor
+ *
+ * @param oglm The window's OpenGL manager
+ * @param name Layer identifier, used to name its FBO
+ * @param width Layer width in pixels
+ * @param height Layer height in pixels
+ * @param refreshRate Forced redraws per second (0 = only when marked dirty)
+ * @return nothing
+ */
+SGL_RenderLayer::SGL_RenderLayer(std::shared_ptr<SGL_OpenGLManager> oglm, const std::string &name, GLuint width, GLuint height, float refreshRate)
+    : WMOGLM(oglm), pName(name), pWidth(width), pHeight(height), pDirty(true), pRefreshInterval(0.0f)
+{
+    this->pFBO = "_SGL_RenderLayer_" + pName + "_FBO";
+    this->setRefreshRate(refreshRate);
+
+    // Transparent and pixel exact, the layer is composited 1:1 over the scene
+    pTexture.internalFormat = GL_RGBA8;
+    pTexture.imageFormat = GL_RGBA;
+    pTexture.wrapS = GL_CLAMP_TO_EDGE;
+    pTexture.wrapT = GL_CLAMP_TO_EDGE;
+    pTexture.filterMin = GL_NEAREST;
+    pTexture.filterMax = GL_NEAREST;
+
+    WMOGLM->createFBO(this->pFBO);
+    this->generate();
+}
+
+/**
+ * @brief Destructor
+ *
+ * @return nothing
+ */
+SGL_RenderLayer::~SGL_RenderLayer()
+{
+    WMOGLM->deleteTextures(1, &pTexture.ID);
+    WMOGLM->deleteFBO(this->pFBO);
+}
+
+/**
+ * @brief Allocates the color attachment and binds it to the layer FBO
+ *
+ * @return nothing
+ */
+void SGL_RenderLayer::generate()
+{
+    pTexture.generate(*WMOGLM, pWidth, pHeight, NULL);
+
+    WMOGLM->bindFBO(this->pFBO);
+    WMOGLM->frameBufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, pTexture.ID, 0);
+    if (WMOGLM->checkFrameBufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        WMOGLM->checkForGLErrors();
+        SGL_Log("ERROR::RENDER_LAYER: Failed to initialize FBO " + pFBO, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+    }
+    WMOGLM->unbindFBO();
+}
+
+/**
+ * @brief Reallocates the layer, call it after the window's internal resolution changes
+ *
+ * @param width New width
+ * @param height New height
+ * @return nothing
+ */
+void SGL_RenderLayer::resize(GLuint width, GLuint height)
+{
+    if (width == pWidth && height == pHeight)
+        return;
+
+    pWidth = width;
+    pHeight = height;
+    WMOGLM->deleteTextures(1, &pTexture.ID);
+    this->generate();
+    pDirty = true;
+}
+
+/**
+ * @brief Forces a redraw on the next beginRenderLayer()
+ *
+ * @return nothing
+ */
+void SGL_RenderLayer::markDirty() noexcept
+{
+    pDirty = true;
+}
+
+/**
+ * @brief Sets how many times per second the layer is redrawn even if it isn't dirty
+ *
+ * @param refreshRate Redraws per second, 0 disables timed redraws
+ * @return nothing
+ */
+void SGL_RenderLayer::setRefreshRate(float refreshRate) noexcept
+{
+    pRefreshInterval = (refreshRate > 0.0f) ? 1.0f / refreshRate : 0.0f;
+}
+
+/**
+ * @brief Should the layer be redrawn?
+ *
+ * @param now Current frame timestamp
+ * @return bool
+ */
+bool SGL_RenderLayer::needsRefresh(std::chrono::steady_clock::time_point now) const noexcept
+{
+    if (pDirty)
+        return true;
+    if (pRefreshInterval <= 0.0f)
+        return false;
+    return std::chrono::duration<float>(now - pLastRefresh).count() >= pRefreshInterval;
+}
+
+/**
+ * @brief Binds the layer FBO, clears it to transparent and matches the viewport
+ *
+ * @return nothing
+ */
+void SGL_RenderLayer::begin() noexcept
+{
+    SGL_Color transparent = {0.0f, 0.0f, 0.0f, 0.0f};
+    WMOGLM->bindFBO(this->pFBO);
+    WMOGLM->resizeGL(0, 0, pWidth, pHeight);
+    WMOGLM->setClearColor(transparent);
+    WMOGLM->clearColorBuffer();
+}
+
+/**
+ * @brief Marks the layer as up to date, the caller restores the previous render target
+ *
+ * @return nothing
+ */
+void SGL_RenderLayer::end() noexcept
+{
+    pDirty = false;
+    pLastRefresh = std::chrono::steady_clock::now();
+}
+
+/**
+ * @brief Color attachment, ready to be composited
+ * @return SGL_Texture
+ */
+const SGL_Texture &SGL_RenderLayer::getTexture() const noexcept
+{
+    return pTexture;
+}
+
+/**
+ * @brief Layer identifier
+ * @return std::string
+ */
+const std::string &SGL_RenderLayer::getName() const noexcept
+{
+    return pName;
+}
+
+/**
+ * @brief Layer width
+ * @return GLuint
+ */
+GLuint SGL_RenderLayer::getWidth() const noexcept
+{
+    return pWidth;
+}
+
+/**
+ * @brief Layer height
+ * @return GLuint
+ */
+GLuint SGL_RenderLayer::getHeight() const noexcept
+{
+    return pHeight;
+}
@@ -0,0 +1,96 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/renderer/SGL_RenderLayer.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Offscreen render target that caches a slow changing part of the scene
+ *
+ * @section DESCRIPTION
+ *
+ * Static backgrounds, tile maps and HUDs rarely change from frame to frame, a render layer
+ * draws them once into its own FBO texture and the window composites that texture as a
+ * single quad until the layer is marked dirty or its refresh interval expires.
+ */
+
+#ifndef SRC_SKELETONGL_RENDERER_RENDERLAYER_HPP
+#define SRC_SKELETONGL_RENDERER_RENDERLAYER_HPP
+
+// C++
+#include <string>
+#include <memory>
+#include <chrono>
+// Dependencies
+#include <GL/glew.h>
+// SkeletonGL
+#include "../utility/SGL_DataStructures.hpp"
+#include "../utility/SGL_Utility.hpp"
+#include "SGL_OpenGLManager.hpp"
+#include "SGL_Texture.hpp"
+
+/**
+ * @brief Cached render target
+ * @section DESCRIPTION
+ *
+ * Render into it between SGL_Window::beginRenderLayer() and SGL_Window::endRenderLayer(),
+ * then composite it every frame with SGL_Window::renderLayer(). A refresh rate of 0 means
+ * the layer is only redrawn when explicitly marked dirty.
+ */
+class SGL_RenderLayer
+{
+private:
+    std::shared_ptr<SGL_OpenGLManager> WMOGLM;                  ///< Window's OpenGL context
+    std::string pName, pFBO;                                    ///< Layer identifier and its FBO
+    SGL_Texture pTexture;                                       ///< Color attachment
+    GLuint pWidth, pHeight;                                     ///< Layer dimensions
+    bool pDirty;                                                ///< Redraw requested
+    float pRefreshInterval;                                     ///< Seconds between forced redraws (0 = dirty only)
+    std::chrono::steady_clock::time_point pLastRefresh;         ///< Timestamp of the last redraw
+
+    // (Re)allocates the color attachment
+    void generate();
+
+    // Disable all copy and move constructors
+    SGL_RenderLayer(const SGL_RenderLayer&) = delete;
+    SGL_RenderLayer *operator = (const SGL_RenderLayer&) = delete;
+    SGL_RenderLayer(SGL_RenderLayer &&) = delete;
+    SGL_RenderLayer &operator = (SGL_RenderLayer &&) = delete;
+
+public:
+    // Constructor
+    SGL_RenderLayer(std::shared_ptr<SGL_OpenGLManager> oglm, const std::string &name, GLuint width, GLuint height, float refreshRate = 0.0f);
+    // Destructor
+    ~SGL_RenderLayer();
+
+    // Reallocates the layer with new dimensions, marks it dirty
+    void resize(GLuint width, GLuint height);
+    // Forces a redraw on the next beginRenderLayer()
+    void markDirty() noexcept;
+    // Redraws per second regardless of the dirty flag (0 = dirty only)
+    void setRefreshRate(float refreshRate) noexcept;
+    // Should the layer be redrawn this frame?
+    bool needsRefresh(std::chrono::steady_clock::time_point now) const noexcept;
+
+    // Binds and clears the layer FBO, sets the viewport to the layer size
+    void begin() noexcept;
+    // Marks the layer as up to date
+    void end() noexcept;
+
+    // Accessors
+    const SGL_Texture &getTexture() const noexcept;
+    const std::string &getName() const noexcept;
+    GLuint getWidth() const noexcept;
+    GLuint getHeight() const noexcept;
+};
+
+#endif // SRC_SKELETONGL_RENDERER_RENDERLAYER_HPP
@@ -45,6 +45,9 @@ SGL_Renderer::SGL_Renderer(std::shared_ptr<SGL_OpenGLManager> oglm, const SGL_Te
     this->pSpriteBatchShader = spriteBatchShader;
     this->pPixelBatchShader = pixelBatchShader;
     this->pLineBatchShader = lineBatchShader;
+    this->pGPUCulling = false;
+    this->pTextBatch = false;
+    this->pAssets = nullptr;
 
 
     // Generic buffers: They hold vertex, color
@@ -81,6 +84,19 @@ SGL_Renderer::SGL_Renderer(std::shared_ptr<SGL_OpenGLManager> oglm, const SGL_Te
     this->pLineBatchInstancesVBO = "_SGL_Renderer_lineBatch_instances_VBO";
     this->pSpriteBatchInstancesVBO = "_SGL_Renderer_spriteBatch_instances_VBO";
 
+    // Indirect buffers: Shared by every queued batch until the next flush
+    this->pIndirectSpriteVAO = "_SGL_Renderer_indirectSprite_VAO";
+    this->pIndirectSpriteVBO = "_SGL_Renderer_indirectSprite_VBO";
+    this->pIndirectSpriteInstancesVBO = "_SGL_Renderer_indirectSprite_instances_VBO";
+    this->pIndirectPrimitiveVAO = "_SGL_Renderer_indirectPrimitive_VAO";
+    this->pIndirectPrimitiveVBO = "_SGL_Renderer_indirectPrimitive_VBO";
+    this->pIndirectPrimitiveInstancesVBO = "_SGL_Renderer_indirectPrimitive_instances_VBO";
+    this->pIndirectDIBO = "_SGL_Renderer_indirect_DIBO";
+
+    // Bitmap text batching: One instance per glyph
+    this->pTextBatchVAO = "_SGL_Renderer_textBatch_VAO";
+    this->pTextBatchInstancesVBO = "_SGL_Renderer_textBatch_instances_VBO";
+
 
     // VAOs
     WMOGLM->createVAO(this->pLineVAO);
@@ -90,6 +106,9 @@ SGL_Renderer::SGL_Renderer(std::shared_ptr<SGL_OpenGLManager> oglm, const SGL_Te
     WMOGLM->createVAO(this->pSpriteBatchVAO);
     WMOGLM->createVAO(this->pPixelBatchVAO);
     WMOGLM->createVAO(this->pLineBatchVAO);
+    WMOGLM->createVAO(this->pIndirectSpriteVAO);
+    WMOGLM->createVAO(this->pIndirectPrimitiveVAO);
+    WMOGLM->createVAO(this->pTextBatchVAO);
 
     // VBOs
     WMOGLM->createVBO(this->pPointVBO);
@@ -103,6 +122,12 @@ SGL_Renderer::SGL_Renderer(std::shared_ptr<SGL_OpenGLManager> oglm, const SGL_Te
     WMOGLM->createVBO(pPixelBatchInstancesVBO);
     WMOGLM->createVBO(pSpriteBatchInstancesVBO);
     WMOGLM->createVBO(pLineBatchInstancesVBO);
+    WMOGLM->createVBO(this->pIndirectSpriteVBO);
+    WMOGLM->createVBO(this->pIndirectSpriteInstancesVBO);
+    WMOGLM->createVBO(this->pIndirectPrimitiveVBO);
+    WMOGLM->createVBO(this->pIndirectPrimitiveInstancesVBO);
+    WMOGLM->createVBO(this->pIndirectDIBO);
+    WMOGLM->createVBO(this->pTextBatchInstancesVBO);
 
     this->generateFont(FOLDER_STRUCTURE::defaultFont);
 
@@ -113,6 +138,8 @@ SGL_Renderer::SGL_Renderer(std::shared_ptr<SGL_OpenGLManager> oglm, const SGL_Te
     this->loadPixelBatchBuffers(pPixelBatchShader);
     this->loadSpriteBatchBuffers(pSpriteBatchShader);
     this->loadLineBatchBuffers(pLineBatchShader);
+    this->loadIndirectBuffers();
+    this->loadTextBatchBuffers();
 
     this->generateBitmapFont();
 }
@@ -124,8 +151,6 @@ SGL_Renderer::SGL_Renderer(std::shared_ptr<SGL_OpenGLManager> oglm, const SGL_Te
  */
 SGL_Renderer::~SGL_Renderer()
 {
-    delete[] modelMatrices;
-    delete[] pLineVectors;
 
     // VAOs
     WMOGLM->deleteVAO(this->pLineVAO);
@@ -135,6 +160,9 @@ SGL_Renderer::~SGL_Renderer()
     WMOGLM->deleteVAO(this->pSpriteBatchVAO);
     WMOGLM->deleteVAO(this->pPixelBatchVAO);
     WMOGLM->deleteVAO(this->pLineBatchVAO);
+    WMOGLM->deleteVAO(this->pIndirectSpriteVAO);
+    WMOGLM->deleteVAO(this->pIndirectPrimitiveVAO);
+    WMOGLM->deleteVAO(this->pTextBatchVAO);
 
     // VBOs
     WMOGLM->deleteVBO(this->pLineVBO);
@@ -148,6 +176,12 @@ SGL_Renderer::~SGL_Renderer()
     WMOGLM->deleteVBO(this->pPixelBatchInstancesVBO);
     WMOGLM->deleteVBO(this->pLineBatchInstancesVBO);
     WMOGLM->deleteVBO(this->pSpriteBatchInstancesVBO);
+    WMOGLM->deleteVBO(this->pIndirectSpriteVBO);
+    WMOGLM->deleteVBO(this->pIndirectSpriteInstancesVBO);
+    WMOGLM->deleteVBO(this->pIndirectPrimitiveVBO);
+    WMOGLM->deleteVBO(this->pIndirectPrimitiveInstancesVBO);
+    WMOGLM->deleteVBO(this->pIndirectDIBO);
+    WMOGLM->deleteVBO(this->pTextBatchInstancesVBO);
 
 }
 
@@ -159,36 +193,60 @@ SGL_Renderer::~SGL_Renderer()
  */
 void SGL_Renderer::renderPixel(const SGL_Pixel &pixel) const
 {
-    SGL_Shader activeShader;
-    if (pixel.shader.shaderType != SHADER_TYPE::PIXEL)
-        activeShader = pPixelShader;
-    else
-        activeShader = pixel.shader;
+    const SGL_Shader &activeShader = (pixel.shader.shaderType != SHADER_TYPE::PIXEL) ? pPixelShader : pixel.shader;
+    glm::vec4 assignedColor = {pixel.color.r, pixel.color.g, pixel.color.b, pixel.color.a};
+    this->drawPixel(activeShader, pixel.position, assignedColor, pixel.size, pixel.blending);
+}
+
+/**
+ * @brief Renders a lightweight pixel
+ * @param pixel The SGL_LitePixel to render
+ *
+ * @return nothing
+ */
+void SGL_Renderer::renderPixel(const SGL_LitePixel &pixel) const
+{
+    this->drawPixel(resolveShader(pixel.shader, SHADER_TYPE::PIXEL, pPixelShader), pixel.position, pixel.color.normalized(),
+                    pixel.size, static_cast<BLENDING_TYPE>(pixel.blending));
+}
 
+/**
+ * @brief Pixel draw path shared by every pixel renderable
+ * @param shader Resolved pixel shader
+ * @param position Pixel position
+ * @param color Normalized color
+ * @param size Pixel size
+ * @param blending Blending mode, 0 for the renderer default
+ *
+ * @return nothing
+ */
+void SGL_Renderer::drawPixel(const SGL_Shader &shader, glm::vec2 position, glm::vec4 color, float size, BLENDING_TYPE blending) const
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::drawPixel");
+    SGL_TRACE_ZONE("SGL_Renderer::drawPixel");
     // NOTE, coords are normalized, gotta deal with that
     GLfloat vertices[] = {
-        pixel.position.x, pixel.position.y
+        position.x, position.y
     };
     WMOGLM->bindVAO(this->pPointVAO);
-    WMOGLM->bindVBO(this->pPointVBO);
-    activeShader.use(*WMOGLM);
+    shader.use(*WMOGLM);
 
-    WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(vertices), &vertices[0]);
-    glm::vec4 assignedColor = {pixel.color.r, pixel.color.g, pixel.color.b, pixel.color.a};
-    activeShader.setVector4f(*WMOGLM, "pointColor", assignedColor);
-    activeShader.setFloat(*WMOGLM, "deltaTime", activeShader.renderDetails.deltaTime);
+    WMOGLM->namedBufferSubData(this->pPointVBO, 0, sizeof(vertices), &vertices[0]);
+    shader.setVector4f(*WMOGLM, "pointColor", color);
+    shader.setFloat(*WMOGLM, "deltaTime", shader.renderDetails.deltaTime);
 
     // Pixel width, if AA is enabled it must be set to 1.0f!
-    if ( pixel.size > SGL_OGL_CONSTANTS::MIN_PIXEL_SIZE && pixel.size < SGL_OGL_CONSTANTS::MAX_PIXEL_SIZE )
-        WMOGLM->pixelSize(pixel.size);
+    if ( size > SGL_OGL_CONSTANTS::MIN_PIXEL_SIZE && size < SGL_OGL_CONSTANTS::MAX_PIXEL_SIZE )
+        WMOGLM->pixelSize(size);
     else
         WMOGLM->pixelSize(SGL_OGL_CONSTANTS::MIN_PIXEL_SIZE);
 
     // Set the blending mode
-    if (pixel.blending == 0)
+    if (blending == 0)
         WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
     else
-        WMOGLM->blending(true, pixel.blending);
+        WMOGLM->blending(true, blending);
 
 
     WMOGLM->drawArrays(GL_POINTS, 0, 2);
@@ -198,7 +256,7 @@ void SGL_Renderer::renderPixel(const SGL_Pixel &pixel) const
     WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
-    activeShader.unbind(*WMOGLM);
+    shader.unbind(*WMOGLM);
 
 #ifdef SGL_CHECK_FOR_ERRORS_ON_RENDER
     WMOGLM->checkForGLErrors();
@@ -216,15 +274,17 @@ void SGL_Renderer::renderPixel(const SGL_Pixel &pixel) const
  */
 void SGL_Renderer::renderPixel(float x1, float y1, SGL_Color color)
 {
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::renderPixel");
+    SGL_TRACE_ZONE("SGL_Renderer::renderPixel");
     // NOTE, coords are normalized, gotta deal with that
     GLfloat vertices[] = {
         x1, y1
     };
     WMOGLM->bindVAO(this->pPointVAO);
-    WMOGLM->bindVBO(this->pPointVBO);
     pPixelShader.use(*WMOGLM);
 
-    WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(vertices), &vertices[0]);
+    WMOGLM->namedBufferSubData(this->pPointVBO, 0, sizeof(vertices), &vertices[0]);
     glm::vec4 assignedColor = {color.r, color.g, color.b, color.a};
     pPixelShader.setVector4f(*WMOGLM, "pointColor", assignedColor);
 
@@ -252,46 +312,71 @@ void SGL_Renderer::renderPixel(float x1, float y1, SGL_Color color)
  */
 void SGL_Renderer::renderLine(const SGL_Line &line) const
 {
-    SGL_Shader activeShader;
-    if (line.shader.shaderType != SHADER_TYPE::LINE)
-        activeShader = pLineShader;
-    else
-        activeShader = line.shader;
+    const SGL_Shader &activeShader = (line.shader.shaderType != SHADER_TYPE::LINE) ? pLineShader : line.shader;
+    glm::vec4 assignedColor = {line.color.r, line.color.g, line.color.b, line.color.a};
+    this->drawLine(activeShader, line.positionA, line.positionB, assignedColor, line.width, line.blending);
+}
+
+/**
+ * @brief Renders a lightweight line
+ * @param line SGL_LiteLine to render
+ *
+ * @return nothing
+ */
+void SGL_Renderer::renderLine(const SGL_LiteLine &line) const
+{
+    this->drawLine(resolveShader(line.shader, SHADER_TYPE::LINE, pLineShader), line.positionA, line.positionB, line.color.normalized(),
+                   line.width, static_cast<BLENDING_TYPE>(line.blending));
+}
 
+/**
+ * @brief Line draw path shared by every line renderable
+ * @param shader Resolved line shader
+ * @param positionA First vertex
+ * @param positionB Second vertex
+ * @param color Normalized color
+ * @param width Line width
+ * @param blending Blending mode, 0 for the renderer default
+ *
+ * @return nothing
+ */
+void SGL_Renderer::drawLine(const SGL_Shader &shader, glm::vec2 positionA, glm::vec2 positionB, glm::vec4 color, float width, BLENDING_TYPE blending) const
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::drawLine");
+    SGL_TRACE_ZONE("SGL_Renderer::drawLine");
     //NOTE, coords are normalized, gotta deal with that
     GLfloat vertices[] = {
-        line.positionA.x, line.positionA.y, line.positionB.x, line.positionB.y
+        positionA.x, positionA.y, positionB.x, positionB.y
     };
     WMOGLM->bindVAO(this->pLineVAO);
-    WMOGLM->bindVBO(this->pLineVBO);
-    activeShader.use(*WMOGLM);
+    shader.use(*WMOGLM);
 
-    WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(vertices), &vertices[0]);
-    glm::vec4 assignedColor = {line.color.r, line.color.g, line.color.b, line.color.a};
-    activeShader.setVector4f(*WMOGLM, "lineColor", assignedColor);
-    activeShader.setFloat(*WMOGLM, "deltaTime", activeShader.renderDetails.deltaTime);
+    WMOGLM->namedBufferSubData(this->pLineVBO, 0, sizeof(vertices), &vertices[0]);
+    shader.setVector4f(*WMOGLM, "lineColor", color);
+    shader.setFloat(*WMOGLM, "deltaTime", shader.renderDetails.deltaTime);
 
     // Line width, if AA is enabled it must be set to 1.0f!
-    if ( line.width > SGL_OGL_CONSTANTS::MIN_LINE_WIDTH && line.width < SGL_OGL_CONSTANTS::MAX_LINE_WIDTH )
-        glLineWidth(line.width);
+    if ( width > SGL_OGL_CONSTANTS::MIN_LINE_WIDTH && width < SGL_OGL_CONSTANTS::MAX_LINE_WIDTH )
+        WMOGLM->lineWidth(width);
     else
-        glLineWidth(SGL_OGL_CONSTANTS::MIN_LINE_WIDTH);
+        WMOGLM->lineWidth(SGL_OGL_CONSTANTS::MIN_LINE_WIDTH);
 
     // Set the blending mode
-    if (line.blending == 0)
+    if (blending == 0)
         WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
     else
-        WMOGLM->blending(true, line.blending);
+        WMOGLM->blending(true, blending);
 
 
     WMOGLM->drawArrays(GL_LINES, 0, 2);
 
     // Reset line width
-    glLineWidth(SGL_OGL_CONSTANTS::MIN_LINE_WIDTH);
+    WMOGLM->lineWidth(SGL_OGL_CONSTANTS::MIN_LINE_WIDTH);
     WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
-    activeShader.unbind(*WMOGLM);
+    shader.unbind(*WMOGLM);
 
 #ifdef SGL_CHECK_FOR_ERRORS_ON_RENDER
     WMOGLM->checkForGLErrors();
@@ -311,23 +396,25 @@ void SGL_Renderer::renderLine(const SGL_Line &line) const
  */
 void SGL_Renderer::renderLine(float x1, float y1, float x2, float y2, float width, SGL_Color color)
 {
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::renderLine");
+    SGL_TRACE_ZONE("SGL_Renderer::renderLine");
     // NOTE, coords are normalized, gotta deal with that
     GLfloat vertices[] = {
         x1, y1, x2, y2
     };
     WMOGLM->bindVAO(this->pLineVAO);
-    WMOGLM->bindVBO(this->pLineVBO);
     pLineShader.use(*WMOGLM);
 
-    WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(vertices), &vertices[0]);
+    WMOGLM->namedBufferSubData(this->pLineVBO, 0, sizeof(vertices), &vertices[0]);
     glm::vec4 assignedColor = {color.r, color.g, color.b, color.a};
     pLineShader.setVector4f(*WMOGLM, "lineColor", assignedColor);
 
     // Line width, if AA is enabled it must be set to 1.0f!
     if (width > SGL_OGL_CONSTANTS::MIN_LINE_WIDTH && width < SGL_OGL_CONSTANTS::MAX_LINE_WIDTH )
-        glLineWidth(width);
+        WMOGLM->lineWidth(width);
     else
-        glLineWidth(SGL_OGL_CONSTANTS::MIN_LINE_WIDTH);
+        WMOGLM->lineWidth(SGL_OGL_CONSTANTS::MIN_LINE_WIDTH);
 
     WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
 
@@ -352,11 +439,10 @@ void SGL_Renderer::renderLine(float x1, float y1, float x2, float y2, float widt
  */
 void SGL_Renderer::renderText(SGL_Text &text)
 {
-    SGL_Shader activeShader;
-    if (text.shader.shaderType != SHADER_TYPE::TEXT)
-        activeShader = pTextShader;
-    else
-        activeShader = text.shader;
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::renderText");
+    SGL_TRACE_ZONE("SGL_Renderer::renderText");
+    const SGL_Shader &activeShader = (text.shader.shaderType != SHADER_TYPE::TEXT) ? pTextShader : text.shader;
 
     WMOGLM->faceCulling(true);
     // RESUME render state
@@ -395,9 +481,7 @@ void SGL_Renderer::renderText(SGL_Text &text)
         // Render glyph texture over the quad
         WMOGLM->bindTexture(GL_TEXTURE_2D, ch.textureID);
         // Update content of VBO memory
-        WMOGLM->bindVBO(pTextVBO);
-        WMOGLM->bufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-        WMOGLM->unbindVBO();
+        WMOGLM->namedBufferSubData(pTextVBO, 0, sizeof(vertices), vertices);
         // Render the quad
         WMOGLM->drawArrays(GL_TRIANGLES, 0, 6);
         // Advance cursor for the next glyph (note that advance is number of 1/64 pixels)
@@ -427,6 +511,9 @@ void SGL_Renderer::renderText(SGL_Text &text)
  */
 void SGL_Renderer::renderText(std::string text, GLfloat x, GLfloat y, GLfloat scale, SGL_Color color)
 {
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::renderText");
+    SGL_TRACE_ZONE("SGL_Renderer::renderText");
     WMOGLM->faceCulling(true);
     // RESUME render state
     this->pTextShader.use(*WMOGLM);
@@ -463,9 +550,7 @@ void SGL_Renderer::renderText(std::string text, GLfloat x, GLfloat y, GLfloat sc
         // Render glyph texture over the quad
         WMOGLM->bindTexture(GL_TEXTURE_2D, ch.textureID);
         // Update content of VBO memory
-        WMOGLM->bindVBO(pTextVBO);
-        WMOGLM->bufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-        WMOGLM->unbindVBO();
+        WMOGLM->namedBufferSubData(pTextVBO, 0, sizeof(vertices), vertices);
         // Render the quad
         WMOGLM->drawArrays(GL_TRIANGLES, 0, 6);
         // Advance cursor for the next glyph (note that advance is number of 1/64 pixels)
@@ -493,37 +578,108 @@ void SGL_Renderer::renderText(std::string text, GLfloat x, GLfloat y, GLfloat sc
 
 void SGL_Renderer::renderBitmapText(SGL_Bitmap_Text &text) const
 {
-    // Get the UV positioning for the character to rener
-    SGL_Sprite s;
-    s.position.x = text.position.x;
-    s.position.y = text.position.y;
-    s.size.x = text.scale;
-    s.size.y = text.scale;
-    s.texture = text.texture;
+    SGL_TRACE_ZONE("SGL_Renderer::renderBitmapText");
+    // Every character is a lightweight sprite sharing the text's texture
+    SGL_LiteSprite s;
+    s.position = text.position;
+    s.size = glm::vec2(text.scale);
     s.color = text.color;
-    // s.rotationOrigin.x = 5;
-    // s.rotationOrigin.y = 5;
-    // s.rotation = 2.0;
+    const SGL_Texture &activeTexture = (text.texture.width == 0) ? pDefaultTexture : text.texture;
 
-    // SGL_Log("Total chars in text to render: " + std::to_string(text.text.size()));
-    std::string str = "";
     // Iterate through all the characters in the string to render
     for (const char &c : text.text)
     {
         // Get UV coords
         glm::vec4 uvC = pBitmapCharacters.find(c)->second;
-        s.changeUVCoords(uvC.x, uvC.y, uvC.w, uvC.z);
-        // SGL_Log("X: " + std::to_string(uvC.x) + " Y: " + std::to_string(uvC.y) + " W: " + std::to_string(uvC.w) + " H: " + std::to_string(uvC.z));
-        this->renderSprite(s);
-
-        str.push_back(c);
-        // SGL_Log("CHAR: " + str);
+        s.changeUVCoords(text.texture, uvC.x, uvC.y, uvC.w, uvC.z);
+        this->drawLiteSprite(s, pSpriteShader, activeTexture);
 
         // Move the X position by the width of the last rendered character
         s.position.x += s.size.x;
     }
 }
 
+/**
+ * @brief Renders a string of text as a bitmap font in a single instanced draw call
+ * @param text SGL_Bitmap_Text object to render, its shader is ignored
+ *
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * Every glyph becomes an instance holding its screen rectangle and its UV rectangle, so the
+ * whole string costs one upload and one draw no matter its length. Characters missing from
+ * the bitmap font leave a blank space. Falls back to renderBitmapText() without a batch shader.
+ */
+void SGL_Renderer::renderBitmapTextBatch(const SGL_Bitmap_Text &text)
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::renderBitmapTextBatch");
+    SGL_TRACE_ZONE("SGL_Renderer::renderBitmapTextBatch");
+    if (!pTextBatch)
+    {
+        SGL_Bitmap_Text fallback = text;
+        this->renderBitmapText(fallback);
+        return;
+    }
+
+    std::size_t maxGlyphs = this->clampBatch(text.text.size(), SGL_OGL_CONSTANTS::MAX_TEXT_BATCH_GLYPHS, "renderBitmapTextBatch");
+    if (maxGlyphs == 0)
+        return;
+
+    const SGL_Texture &activeTexture = (text.texture.width == 0) ? pDefaultTexture : text.texture;
+    const float w = activeTexture.width, h = activeTexture.height;
+    const float scale = text.scale;
+
+    SGL_GlyphInstance *glyphs = static_cast<SGL_GlyphInstance*>(this->mapInstances(pTextBatchInstancesVBO, sizeof(SGL_GlyphInstance) * maxGlyphs));
+    if (glyphs == nullptr)
+        return;
+
+    std::size_t count = 0;
+    glm::vec2 pen = text.position;
+    for (std::size_t i = 0; i < maxGlyphs; ++i)
+    {
+        const char c = text.text[i];
+        if (c == '\n')
+        {
+            pen.x = text.position.x;
+            pen.y += scale;
+            continue;
+        }
+        auto glyph = pBitmapCharacters.find(c);
+        if (glyph != pBitmapCharacters.end())
+        {
+            // Same convention as SGL_LiteSprite::changeUVCoords, the texture is flipped vertically
+            const glm::vec4 &src = glyph->second;
+            glyphs[count].rect = glm::vec4(pen, scale, scale);
+            glyphs[count].uvRect = glm::vec4(src.x / w, (h - (src.y + src.w)) / h, (src.x + src.z) / w, (h - src.y) / h);
+            count++;
+        }
+        pen.x += scale;
+    }
+    this->unmapInstances();
+    if (count == 0)
+        return;
+
+    WMOGLM->bindVAO(this->pTextBatchVAO);
+    pTextBatchShader.use(*WMOGLM);
+    WMOGLM->blending(true, BLENDING_TYPE::TEXT_RENDERING);
+    pTextBatchShader.setVector4f(*WMOGLM, "spriteColor", text.color.r, text.color.g, text.color.b, text.color.a);
+
+    WMOGLM->activeTexture(GL_TEXTURE0);
+    activeTexture.bind(*WMOGLM);
+
+    WMOGLM->drawArraysInstanced(GL_TRIANGLES, 0, 6, count);
+
+    // Cleanup
+    pTextBatchShader.unbind(*WMOGLM);
+    WMOGLM->unbindVAO();
+    WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
+
+#ifdef SGL_CHECK_FOR_ERRORS_ON_RENDER
+    WMOGLM->checkForGLErrors();
+#endif
+}
+
 /**
  * @brief Renders a sprite
  * @param sprite SGL_Sprite to be rendered
@@ -532,17 +688,10 @@ void SGL_Renderer::renderBitmapText(SGL_Bitmap_Text &text) const
  */
 void SGL_Renderer::renderSprite(const SGL_Sprite &sprite) const
 {
-    SGL_Shader activeShader;
-    if (sprite.shader.shaderType != SHADER_TYPE::SPRITE)
-        activeShader = pSpriteShader;
-    else
-        activeShader = sprite.shader;
+    const SGL_Shader &activeShader = (sprite.shader.shaderType != SHADER_TYPE::SPRITE) ? pSpriteShader : sprite.shader;
 
-    SGL_Texture activeTexture;
-    if (sprite.texture.width == 0) // Uninitialized texture
-        activeTexture = pDefaultTexture;
-    else
-        activeTexture = sprite.texture;
+    // Uninitialized texture
+    const SGL_Texture &activeTexture = (sprite.texture.width == 0) ? pDefaultTexture : sprite.texture;
 
     GLfloat UV[] = {
         sprite.uvCoords.UV_topLeft.x / sprite.texture.width, sprite.uvCoords.UV_topLeft.y / sprite.texture.height,
@@ -554,19 +703,6 @@ void SGL_Renderer::renderSprite(const SGL_Sprite &sprite) const
         sprite.uvCoords.UV_botRight.x / sprite.texture.width, sprite.uvCoords.UV_botRight.y / sprite.texture.height,
     };
 
-    WMOGLM->bindVAO(this->pSpriteVAO);
-    activeShader.use(*WMOGLM);
-
-    // Replace current texture coordinates
-    WMOGLM->bindVBO(this->pTextureUVVBO);
-    WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(UV), &UV[0]);
-
-    // If the user didn't specify a blending mode use the renderers default
-    if (sprite.blending == 0)
-        WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
-    else
-        WMOGLM->blending(true, sprite.blending);
-
     // Prepare transformations
     glm::mat4 model(1.0f);
     model = glm::translate(model, glm::vec3(sprite.position, 0.0f)); //move
@@ -576,21 +712,92 @@ void SGL_Renderer::renderSprite(const SGL_Sprite &sprite) const
     model = glm::translate(model, glm::vec3(-sprite.rotationOrigin.x, -sprite.rotationOrigin.y, 0.0f)); //set the rotation origin back to origin
     model = glm::scale(model, glm::vec3(sprite.size, 1.0f)); //scale
 
+    glm::vec4 assignedColor = {sprite.color.r, sprite.color.g, sprite.color.b, sprite.color.a};
+    this->drawSprite(activeShader, activeTexture, UV, model, assignedColor, sprite.size, sprite.blending);
+}
+
+/**
+ * @brief Renders a lightweight sprite
+ * @param sprite SGL_LiteSprite to be rendered
+ *
+ * @return nothing
+ */
+void SGL_Renderer::renderSprite(const SGL_LiteSprite &sprite) const
+{
+    this->drawLiteSprite(sprite, resolveShader(sprite.shader, SHADER_TYPE::SPRITE, pSpriteShader), resolveTexture(sprite.texture));
+}
+
+/**
+ * @brief Builds the UVs and model matrix of a lightweight sprite and draws it
+ * @param sprite SGL_LiteSprite to be rendered
+ * @param shader Resolved sprite shader
+ * @param texture Resolved texture
+ *
+ * @return nothing
+ */
+void SGL_Renderer::drawLiteSprite(const SGL_LiteSprite &sprite, const SGL_Shader &shader, const SGL_Texture &texture) const
+{
+    SGL_TRACE_ZONE("SGL_Renderer::drawLiteSprite");
+    const glm::vec4 &uv = sprite.uvRect;
+    GLfloat UV[] = {
+        uv.x, uv.y, // top left
+        uv.z, uv.w, // bot right
+        uv.x, uv.w, // bot left
+
+        uv.x, uv.y, // top left
+        uv.z, uv.y, // top right
+        uv.z, uv.w, // bot right
+    };
+
+    glm::mat4 model = SGL_SpriteLayer::modelMatrix(sprite.position, sprite.size, sprite.rotation, sprite.size * 0.5f);
+    this->drawSprite(shader, texture, UV, model, sprite.color.normalized(), sprite.size, static_cast<BLENDING_TYPE>(sprite.blending));
+}
+
+/**
+ * @brief Sprite draw path shared by every sprite renderable
+ * @param shader Resolved sprite shader
+ * @param texture Resolved texture
+ * @param UV Normalized texture coordinates of both quad triangles
+ * @param model Model matrix
+ * @param color Normalized color
+ * @param size Sprite dimensions
+ * @param blending Blending mode, 0 for the renderer default
+ *
+ * @return nothing
+ */
+void SGL_Renderer::drawSprite(const SGL_Shader &shader, const SGL_Texture &texture, const GLfloat (&UV)[12], const glm::mat4 &model,
+                              glm::vec4 color, glm::vec2 size, BLENDING_TYPE blending) const
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::drawSprite");
+    SGL_TRACE_ZONE("SGL_Renderer::drawSprite");
+    WMOGLM->bindVAO(this->pSpriteVAO);
+    shader.use(*WMOGLM);
+
+    // Replace current texture coordinates
+    WMOGLM->namedBufferSubData(this->pTextureUVVBO, 0, sizeof(UV), &UV[0]);
+
+    // If the user didn't specify a blending mode use the renderers default
+    if (blending == 0)
+        WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
+    else
+        WMOGLM->blending(true, blending);
+
     // Parse uniforms
-    activeShader.setMatrix4(*WMOGLM, "model", model);
+    shader.setMatrix4(*WMOGLM, "model", model);
     // Render texture quad
-    activeShader.setVector4f(*WMOGLM, "spriteColor", sprite.color.r, sprite.color.g, sprite.color.b, sprite.color.a);
-    activeShader.setFloat(*WMOGLM, "deltaTime", activeShader.renderDetails.deltaTime);
-    activeShader.setVector2f(*WMOGLM, "spriteDimensions", sprite.size.x, sprite.size.y);
+    shader.setVector4f(*WMOGLM, "spriteColor", color);
+    shader.setFloat(*WMOGLM, "deltaTime", shader.renderDetails.deltaTime);
+    shader.setVector2f(*WMOGLM, "spriteDimensions", size);
 
     // Activate the texture
     WMOGLM->activeTexture(GL_TEXTURE0);
-    activeTexture.bind(*WMOGLM);
+    texture.bind(*WMOGLM);
 
     WMOGLM->drawArrays(GL_TRIANGLES, 0, 6);
 
     // Cleanup
-    activeShader.unbind(*WMOGLM);
+    shader.unbind(*WMOGLM);
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
     WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
@@ -600,22 +807,131 @@ void SGL_Renderer::renderSprite(const SGL_Sprite &sprite) const
 #endif
 }
 
+/**
+ * @brief Sets the asset manager that resolves the lightweight renderables' handles
+ * @param assets The window's asset manager
+ *
+ * @return nothing
+ */
+void SGL_Renderer::setAssetManager(const SGL_AssetManager *assets) noexcept
+{
+    this->pAssets = assets;
+}
+
+/**
+ * @brief Resolves a shader handle
+ * @param handle Shader handle
+ * @param type Shader type expected by the caller
+ * @param fallback Shader used if the handle is invalid or of another type
+ *
+ * @return const SGL_Shader&
+ */
+const SGL_Shader &SGL_Renderer::resolveShader(SGL_ShaderHandle handle, SHADER_TYPE type, const SGL_Shader &fallback) const noexcept
+{
+    if (pAssets == nullptr || !handle.valid() || handle.shaderType != type)
+        return fallback;
+    return pAssets->resolve(handle);
+}
+
+/**
+ * @brief Resolves a texture handle
+ * @param handle Texture handle
+ *
+ * @return const SGL_Texture& The texture or the renderer's default one if the handle is invalid
+ */
+const SGL_Texture &SGL_Renderer::resolveTexture(SGL_TextureHandle handle) const noexcept
+{
+    if (pAssets == nullptr || !handle.valid())
+        return pDefaultTexture;
+    return pAssets->resolve(handle);
+}
+
 /**
  * @brief Renders a sprite batch using instanced rendering
  * @param sprite SGL_Sprite to be rendered
- * @param sprite SGL_Sprite to be rendered
+ * @param matrices Instance model matrices
  *
  * @return nothing
  */
 void SGL_Renderer::renderSpriteBatch(const SGL_Sprite &sprite, const std::vector<glm::mat4> *matrices)
 {
-    SGL_Shader activeShader;
-    if (sprite.shader.shaderType != SHADER_TYPE::SPRITE)
-        activeShader = pSpriteBatchShader;
+    this->renderSpriteBatch(sprite, matrices->data(), matrices->size());
+}
+
+/**
+ * @brief Renders a sprite batch gathering the model matrices from strided storage
+ * @param sprite SGL_Sprite to be rendered
+ * @param matrices First model matrix
+ * @param count Amount of instances
+ * @param stride Bytes between consecutive matrices, 0 if tightly packed
+ *
+ * @return nothing
+ */
+void SGL_Renderer::renderSpriteBatch(const SGL_Sprite &sprite, const glm::mat4 *matrices, std::size_t count, std::size_t stride)
+{
+    count = this->clampBatch(count, SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES, "renderSpriteBatch");
+    if (count == 0)
+        return;
+
+    glm::mat4 *instances = static_cast<glm::mat4*>(this->mapInstances(pSpriteBatchInstancesVBO, sizeof(glm::mat4) * count));
+    if (instances == nullptr)
+        return;
+
+    if (stride == 0 || stride == sizeof(glm::mat4))
+        std::memcpy(instances, matrices, sizeof(glm::mat4) * count);
     else
-        activeShader = sprite.shader;
+    {
+        const char *src = reinterpret_cast<const char*>(matrices);
+        for (std::size_t i = 0; i < count; ++i)
+            std::memcpy(&instances[i], src + i * stride, sizeof(glm::mat4));
+    }
+    this->unmapInstances();
+
+    this->drawSpriteBatch(sprite, count);
+}
+
+/**
+ * @brief Renders a sprite batch building the model matrices from separate attribute arrays
+ * @param sprite SGL_Sprite to be rendered, its rotation origin applies to every instance
+ * @param positions Instance positions
+ * @param sizes Instance sizes, nullptr to use sprite.size
+ * @param rotations Instance rotations in radians, nullptr for none
+ * @param count Amount of instances
+ *
+ * @return nothing
+ */
+void SGL_Renderer::renderSpriteBatch(const SGL_Sprite &sprite, const glm::vec2 *positions, const glm::vec2 *sizes, const float *rotations, std::size_t count)
+{
+    count = this->clampBatch(count, SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES, "renderSpriteBatch");
+    if (count == 0)
+        return;
+
+    glm::mat4 *instances = static_cast<glm::mat4*>(this->mapInstances(pSpriteBatchInstancesVBO, sizeof(glm::mat4) * count));
+    if (instances == nullptr)
+        return;
+
+    for (std::size_t i = 0; i < count; ++i)
+        instances[i] = SGL_SpriteLayer::modelMatrix(positions[i], (sizes != nullptr) ? sizes[i] : sprite.size,
+                                                    (rotations != nullptr) ? rotations[i] : 0.0f, sprite.rotationOrigin);
+    this->unmapInstances();
 
-    activeShader = pSpriteBatchShader;
+    this->drawSpriteBatch(sprite, count);
+}
+
+/**
+ * @brief Draws the sprite batch instances already in the instance VBO
+ * @param sprite SGL_Sprite to be rendered
+ * @param count Amount of instances
+ *
+ * @return nothing
+ */
+void SGL_Renderer::drawSpriteBatch(const SGL_Sprite &sprite, std::size_t count)
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::drawSpriteBatch");
+    SGL_TRACE_ZONE("SGL_Renderer::drawSpriteBatch");
+    // Sprite shaders lack the instance attributes, batches always use the batch shader
+    const SGL_Shader &activeShader = pSpriteBatchShader;
 
     GLfloat UV[] = {
         sprite.uvCoords.UV_topLeft.x / sprite.texture.width, sprite.uvCoords.UV_topLeft.y / sprite.texture.height,
@@ -632,8 +948,7 @@ void SGL_Renderer::renderSpriteBatch(const SGL_Sprite &sprite, const std::vector
     activeShader.use(*WMOGLM);
 
     // Replace current texture coordinates
-    WMOGLM->bindVBO(this->pTextureUVVBO);
-    WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(UV), &UV[0]);
+    WMOGLM->namedBufferSubData(this->pTextureUVVBO, 0, sizeof(UV), &UV[0]);
 
     // If the user didn't specify a blending mode use the renderers default
     if (sprite.blending == 0)
@@ -641,11 +956,6 @@ void SGL_Renderer::renderSpriteBatch(const SGL_Sprite &sprite, const std::vector
     else
         WMOGLM->blending(true, sprite.blending);
 
-    // Update the batch data buffer
-    WMOGLM->bindVBO(pSpriteBatchInstancesVBO);
-    WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(glm::mat4) * matrices->size(), matrices->data());
-    WMOGLM->unbindVBO();
-
     // Render texture quad
     activeShader.setVector4f(*WMOGLM, "spriteColor", sprite.color.r, sprite.color.g, sprite.color.b, sprite.color.a);
     activeShader.setFloat(*WMOGLM, "deltaTime", activeShader.renderDetails.deltaTime);
@@ -655,7 +965,7 @@ void SGL_Renderer::renderSpriteBatch(const SGL_Sprite &sprite, const std::vector
     WMOGLM->activeTexture(GL_TEXTURE0);
     sprite.texture.bind(*WMOGLM);
 
-    WMOGLM->drawArraysInstanced(GL_TRIANGLES, 0, 6, matrices->size());
+    WMOGLM->drawArraysInstanced(GL_TRIANGLES, 0, 6, count);
 
     // Cleanup
     activeShader.unbind(*WMOGLM);
@@ -670,27 +980,96 @@ void SGL_Renderer::renderSpriteBatch(const SGL_Sprite &sprite, const std::vector
 }
 
 
-
+/**
+ * @brief Renders a line batch using instanced rendering
+ * @param line Base SGL_Line, every instance is offset from it
+ * @param vectors Instance offsets
+ *
+ * @return nothing
+ */
 void SGL_Renderer::renderLineBatch(const SGL_Line &line, const std::vector<glm::vec2> *vectors)
 {
-    SGL_Shader activeShader;
-    if (line.shader.shaderType != SHADER_TYPE::LINE)
-    activeShader = pLineBatchShader;
+    this->renderLineBatch(line, vectors->data(), vectors->size());
+}
+
+/**
+ * @brief Renders a line batch gathering the offsets from strided storage
+ * @param line Base SGL_Line, every instance is offset from it
+ * @param offsets First instance offset
+ * @param count Amount of instances
+ * @param stride Bytes between consecutive offsets, 0 if tightly packed
+ *
+ * @return nothing
+ */
+void SGL_Renderer::renderLineBatch(const SGL_Line &line, const glm::vec2 *offsets, std::size_t count, std::size_t stride)
+{
+    count = this->clampBatch(count, SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES, "renderLineBatch");
+    if (count == 0)
+        return;
+
+    glm::vec2 *instances = static_cast<glm::vec2*>(this->mapInstances(pLineBatchInstancesVBO, sizeof(glm::vec2) * count));
+    if (instances == nullptr)
+        return;
+
+    if (stride == 0 || stride == sizeof(glm::vec2))
+        std::memcpy(instances, offsets, sizeof(glm::vec2) * count);
     else
-        activeShader = line.shader;
+    {
+        const char *src = reinterpret_cast<const char*>(offsets);
+        for (std::size_t i = 0; i < count; ++i)
+            std::memcpy(&instances[i], src + i * stride, sizeof(glm::vec2));
+    }
+    this->unmapInstances();
+
+    this->drawLineBatch(line, count);
+}
+
+/**
+ * @brief Renders a line batch interleaving separate X and Y offset arrays
+ * @param line Base SGL_Line, every instance is offset from it
+ * @param offsetsX Horizontal instance offsets
+ * @param offsetsY Vertical instance offsets
+ * @param count Amount of instances
+ *
+ * @return nothing
+ */
+void SGL_Renderer::renderLineBatch(const SGL_Line &line, const float *offsetsX, const float *offsetsY, std::size_t count)
+{
+    count = this->clampBatch(count, SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES, "renderLineBatch");
+    if (count == 0)
+        return;
+
+    glm::vec2 *instances = static_cast<glm::vec2*>(this->mapInstances(pLineBatchInstancesVBO, sizeof(glm::vec2) * count));
+    if (instances == nullptr)
+        return;
+
+    for (std::size_t i = 0; i < count; ++i)
+        instances[i] = glm::vec2(offsetsX[i], offsetsY[i]);
+    this->unmapInstances();
+
+    this->drawLineBatch(line, count);
+}
+
+/**
+ * @brief Draws the line batch instances already in the instance VBO
+ * @param line Base SGL_Line
+ * @param count Amount of instances
+ *
+ * @return nothing
+ */
+void SGL_Renderer::drawLineBatch(const SGL_Line &line, std::size_t count)
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::drawLineBatch");
+    SGL_TRACE_ZONE("SGL_Renderer::drawLineBatch");
+    const SGL_Shader &activeShader = (line.shader.shaderType != SHADER_TYPE::LINE) ? pLineBatchShader : line.shader;
 
     WMOGLM->bindVAO(this->pLineBatchVAO);
     activeShader.use(*WMOGLM);
 
     // Update the VBO position data
     GLfloat vertices[] = { line.positionA.x, line.positionA.y, line.positionB.x, line.positionB.y };
-    WMOGLM->bindVBO(this->pLineBatchVBO);
-    WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(vertices), &vertices[0]);
-
-    // Update the batch list
-    WMOGLM->bindVBO(pLineBatchInstancesVBO);
-    WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(glm::vec4) * vectors->size(), vectors->data());
-    WMOGLM->unbindVBO();
+    WMOGLM->namedBufferSubData(this->pLineBatchVBO, 0, sizeof(vertices), &vertices[0]);
 
     // Set shader uniforms
     glm::vec4 assignedColor = {line.color.r, line.color.g, line.color.b, line.color.a};
@@ -710,7 +1089,7 @@ void SGL_Renderer::renderLineBatch(const SGL_Line &line, const std::vector<glm::
         WMOGLM->blending(true, line.blending);
 
     // Render instanced data
-    WMOGLM->drawArraysInstanced(GL_LINES, 0, 2, vectors->size());
+    WMOGLM->drawArraysInstanced(GL_LINES, 0, 2, count);
 
     // Cleanup
     WMOGLM->lineWidth(SGL_OGL_CONSTANTS::MIN_LINE_WIDTH);
@@ -725,22 +1104,92 @@ void SGL_Renderer::renderLineBatch(const SGL_Line &line, const std::vector<glm::
 }
 
 
+/**
+ * @brief Renders a pixel batch using instanced rendering
+ * @param pixel SGL_Pixel holding the color, size and blending of the batch
+ * @param vectors Pixel positions
+ *
+ * @return nothing
+ */
 void SGL_Renderer::renderPixelBatch(const SGL_Pixel &pixel, const std::vector<glm::vec2> *vectors)
 {
-    SGL_Shader activeShader;
-    if (pixel.shader.shaderType != SHADER_TYPE::PIXEL)
-        activeShader = pPixelBatchShader;
-    else
-        activeShader = pixel.shader;
-
-    WMOGLM->bindVAO(this->pPixelBatchVAO);
-    // WMOGLM->bindVBO(this->pPixelBatchVBO);
-    activeShader.use(*WMOGLM);
+    this->renderPixelBatch(pixel, vectors->data(), vectors->size());
+}
 
-    // Update batch data
-    WMOGLM->bindVBO(pPixelBatchInstancesVBO);
-    WMOGLM->bufferSubData(GL_ARRAY_BUFFER, NULL, sizeof(glm::vec2) * vectors->size(), vectors->data());
-    WMOGLM->unbindVBO();
+/**
+ * @brief Renders a pixel batch gathering the positions from strided storage
+ * @param pixel SGL_Pixel holding the color, size and blending of the batch
+ * @param positions First pixel position
+ * @param count Amount of pixels
+ * @param stride Bytes between consecutive positions, 0 if tightly packed
+ *
+ * @return nothing
+ */
+void SGL_Renderer::renderPixelBatch(const SGL_Pixel &pixel, const glm::vec2 *positions, std::size_t count, std::size_t stride)
+{
+    count = this->clampBatch(count, SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES, "renderPixelBatch");
+    if (count == 0)
+        return;
+
+    glm::vec2 *instances = static_cast<glm::vec2*>(this->mapInstances(pPixelBatchInstancesVBO, sizeof(glm::vec2) * count));
+    if (instances == nullptr)
+        return;
+
+    if (stride == 0 || stride == sizeof(glm::vec2))
+        std::memcpy(instances, positions, sizeof(glm::vec2) * count);
+    else
+    {
+        const char *src = reinterpret_cast<const char*>(positions);
+        for (std::size_t i = 0; i < count; ++i)
+            std::memcpy(&instances[i], src + i * stride, sizeof(glm::vec2));
+    }
+    this->unmapInstances();
+
+    this->drawPixelBatch(pixel, count);
+}
+
+/**
+ * @brief Renders a pixel batch interleaving separate X and Y position arrays
+ * @param pixel SGL_Pixel holding the color, size and blending of the batch
+ * @param positionsX Horizontal pixel positions
+ * @param positionsY Vertical pixel positions
+ * @param count Amount of pixels
+ *
+ * @return nothing
+ */
+void SGL_Renderer::renderPixelBatch(const SGL_Pixel &pixel, const float *positionsX, const float *positionsY, std::size_t count)
+{
+    count = this->clampBatch(count, SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES, "renderPixelBatch");
+    if (count == 0)
+        return;
+
+    glm::vec2 *instances = static_cast<glm::vec2*>(this->mapInstances(pPixelBatchInstancesVBO, sizeof(glm::vec2) * count));
+    if (instances == nullptr)
+        return;
+
+    for (std::size_t i = 0; i < count; ++i)
+        instances[i] = glm::vec2(positionsX[i], positionsY[i]);
+    this->unmapInstances();
+
+    this->drawPixelBatch(pixel, count);
+}
+
+/**
+ * @brief Draws the pixel batch instances already in the instance VBO
+ * @param pixel SGL_Pixel holding the color, size and blending of the batch
+ * @param count Amount of pixels
+ *
+ * @return nothing
+ */
+void SGL_Renderer::drawPixelBatch(const SGL_Pixel &pixel, std::size_t count)
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::drawPixelBatch");
+    SGL_TRACE_ZONE("SGL_Renderer::drawPixelBatch");
+    const SGL_Shader &activeShader = (pixel.shader.shaderType != SHADER_TYPE::PIXEL) ? pPixelBatchShader : pixel.shader;
+
+    WMOGLM->bindVAO(this->pPixelBatchVAO);
+    activeShader.use(*WMOGLM);
 
     // Set shader uniforms
     glm::vec4 assignedColor = {pixel.color.r, pixel.color.g, pixel.color.b, pixel.color.a};
@@ -761,7 +1210,7 @@ void SGL_Renderer::renderPixelBatch(const SGL_Pixel &pixel, const std::vector<gl
 
 
     // Render instanced data
-    WMOGLM->drawArraysInstanced(GL_POINTS, 0, 2, vectors->size());
+    WMOGLM->drawArraysInstanced(GL_POINTS, 0, 2, count);
 
     // Cleanup
     WMOGLM->unbindVAO();
@@ -775,6 +1224,575 @@ void SGL_Renderer::renderPixelBatch(const SGL_Pixel &pixel, const std::vector<gl
 #endif
 }
 
+/**
+ * @brief Maps an instance VBO for writing, orphaning its previous contents so the driver doesn't
+ *        stall on draws still reading them
+ * @param vbo Instance buffer to map
+ * @param bytes Size of the range to write, starting at offset 0
+ *
+ * @return void* Mapped memory or nullptr on failure
+ */
+void *SGL_Renderer::mapInstances(const std::string &vbo, std::size_t bytes) noexcept
+{
+    WMOGLM->bindVBO(vbo);
+    void *data = WMOGLM->mapBufferRange(GL_ARRAY_BUFFER, 0, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (data == nullptr)
+    {
+        SGL_Log("SGL_Renderer::mapInstances | Failed to map " + vbo, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        WMOGLM->unbindVBO();
+    }
+    return data;
+}
+
+/**
+ * @brief Unmaps the instance VBO mapped by mapInstances
+ *
+ * @return nothing
+ */
+void SGL_Renderer::unmapInstances() noexcept
+{
+    WMOGLM->unmapBuffer(GL_ARRAY_BUFFER);
+    WMOGLM->unbindVBO();
+}
+
+/**
+ * @brief Clamps a batch to the instance buffer size
+ * @param count Requested amount of instances
+ * @param limit Capacity of the instance buffer
+ * @param caller Batch renderer name for the log
+ *
+ * @return std::size_t
+ */
+std::size_t SGL_Renderer::clampBatch(std::size_t count, std::uint32_t limit, const char *caller) const noexcept
+{
+    if (count > limit)
+    {
+        SGL_Log("SGL_Renderer::" + std::string(caller) + " | Batch exceeds the instance limit, clamping.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        return limit;
+    }
+    return count;
+}
+
+/**
+ * @brief Queues a sprite batch for multi-draw indirect submission
+ * @param sprite SGL_Sprite holding the texture, UV, color and blending of the batch
+ * @param matrices Instance model matrices, copied into the shared instance buffer
+ *
+ * @return nothing
+ */
+void SGL_Renderer::queueSpriteBatch(const SGL_Sprite &sprite, const std::vector<glm::mat4> *matrices)
+{
+    if (matrices == nullptr || matrices->empty())
+        return;
+
+    GLuint instances = matrices->size();
+    if (instances > SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES)
+    {
+        SGL_Log("SGL_Renderer::queueSpriteBatch | Batch exceeds MAX_SPRITE_BATCH_INSTANCES, clamping.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        instances = SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES;
+    }
+
+    // Out of room, submit what's queued and start over
+    if (pIndirectSprites.size() >= SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES ||
+        pIndirectSpriteInstances.size() + instances > SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES)
+        this->flushIndirectBatches();
+
+    const SGL_Texture &activeTexture = (sprite.texture.width == 0) ? pDefaultTexture : sprite.texture;
+    const float w = activeTexture.width, h = activeTexture.height;
+
+    IndirectBatch batch;
+    batch.shader = pSpriteBatchShader;
+    batch.textureID = activeTexture.ID;
+    batch.blending = (sprite.blending == 0) ? BLENDING_TYPE::DEFAULT_RENDERING : sprite.blending;
+    batch.mode = GL_TRIANGLES;
+    batch.color = {sprite.color.r, sprite.color.g, sprite.color.b, sprite.color.a};
+    batch.dimensions = sprite.size;
+    batch.size = 0.0f;
+    batch.command = {6, instances, (GLuint)pIndirectSpriteVertices.size(), (GLuint)pIndirectSpriteInstances.size()};
+
+    // Same quad and UV winding as the sprite batch renderer, interleaved as pos.xy / uv.zw
+    pIndirectSpriteVertices.push_back({0.0f, 1.0f, sprite.uvCoords.UV_topLeft.x / w, sprite.uvCoords.UV_topLeft.y / h});
+    pIndirectSpriteVertices.push_back({1.0f, 0.0f, sprite.uvCoords.UV_botRight.x / w, sprite.uvCoords.UV_botRight.y / h});
+    pIndirectSpriteVertices.push_back({0.0f, 0.0f, sprite.uvCoords.UV_botLeft.x / w, sprite.uvCoords.UV_botLeft.y / h});
+    pIndirectSpriteVertices.push_back({0.0f, 1.0f, sprite.uvCoords.UV_topLeft.x / w, sprite.uvCoords.UV_topLeft.y / h});
+    pIndirectSpriteVertices.push_back({1.0f, 1.0f, sprite.uvCoords.UV_topRight.x / w, sprite.uvCoords.UV_topRight.y / h});
+    pIndirectSpriteVertices.push_back({1.0f, 0.0f, sprite.uvCoords.UV_botRight.x / w, sprite.uvCoords.UV_botRight.y / h});
+
+    pIndirectSpriteInstances.insert(pIndirectSpriteInstances.end(), matrices->begin(), matrices->begin() + instances);
+    batch.sequence = pIndirectSprites.size() + pIndirectPrimitives.size();
+    pIndirectSprites.push_back(batch);
+}
+
+/**
+ * @brief Queues a line batch for multi-draw indirect submission
+ * @param line SGL_Line holding the base segment, color, width and blending of the batch
+ * @param vectors Per instance offsets
+ *
+ * @return nothing
+ */
+void SGL_Renderer::queueLineBatch(const SGL_Line &line, const std::vector<glm::vec2> *vectors)
+{
+    if (vectors == nullptr || vectors->empty())
+        return;
+
+    GLuint instances = vectors->size();
+    if (instances > SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES)
+    {
+        SGL_Log("SGL_Renderer::queueLineBatch | Batch exceeds MAX_LINE_BATCH_INSTANCES, clamping.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        instances = SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES;
+    }
+
+    if (pIndirectPrimitives.size() >= SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES ||
+        pIndirectPrimitiveInstances.size() + instances > SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES + SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES)
+        this->flushIndirectBatches();
+
+    IndirectBatch batch;
+    batch.shader = (line.shader.shaderType != SHADER_TYPE::LINE) ? pLineBatchShader : line.shader;
+    batch.textureID = 0;
+    batch.blending = (line.blending == 0) ? BLENDING_TYPE::DEFAULT_RENDERING : line.blending;
+    batch.mode = GL_LINES;
+    batch.color = {line.color.r, line.color.g, line.color.b, line.color.a};
+    batch.dimensions = glm::vec2(0.0f);
+    batch.size = (line.width > SGL_OGL_CONSTANTS::MIN_LINE_WIDTH && line.width < SGL_OGL_CONSTANTS::MAX_LINE_WIDTH) ? line.width : SGL_OGL_CONSTANTS::MIN_LINE_WIDTH;
+    batch.command = {2, instances, (GLuint)pIndirectPrimitiveVertices.size(), (GLuint)pIndirectPrimitiveInstances.size()};
+
+    pIndirectPrimitiveVertices.push_back(line.positionA);
+    pIndirectPrimitiveVertices.push_back(line.positionB);
+    pIndirectPrimitiveInstances.insert(pIndirectPrimitiveInstances.end(), vectors->begin(), vectors->begin() + instances);
+    batch.sequence = pIndirectSprites.size() + pIndirectPrimitives.size();
+    pIndirectPrimitives.push_back(batch);
+}
+
+/**
+ * @brief Queues a pixel batch for multi-draw indirect submission
+ * @param pixel SGL_Pixel holding the color, size and blending of the batch
+ * @param vectors Pixel positions
+ *
+ * @return nothing
+ */
+void SGL_Renderer::queuePixelBatch(const SGL_Pixel &pixel, const std::vector<glm::vec2> *vectors)
+{
+    if (vectors == nullptr || vectors->empty())
+        return;
+
+    GLuint instances = vectors->size();
+    if (instances > SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES)
+    {
+        SGL_Log("SGL_Renderer::queuePixelBatch | Batch exceeds MAX_PIXEL_BATCH_INSTANCES, clamping.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        instances = SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES;
+    }
+
+    if (pIndirectPrimitives.size() >= SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES ||
+        pIndirectPrimitiveInstances.size() + instances > SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES + SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES)
+        this->flushIndirectBatches();
+
+    IndirectBatch batch;
+    batch.shader = (pixel.shader.shaderType != SHADER_TYPE::PIXEL) ? pPixelBatchShader : pixel.shader;
+    batch.textureID = 0;
+    batch.blending = (pixel.blending == 0) ? BLENDING_TYPE::DEFAULT_RENDERING : pixel.blending;
+    batch.mode = GL_POINTS;
+    batch.color = {pixel.color.r, pixel.color.g, pixel.color.b, pixel.color.a};
+    batch.dimensions = glm::vec2(0.0f);
+    batch.size = (pixel.size > SGL_OGL_CONSTANTS::MIN_PIXEL_SIZE && pixel.size < SGL_OGL_CONSTANTS::MAX_PIXEL_SIZE) ? pixel.size : SGL_OGL_CONSTANTS::MIN_PIXEL_SIZE;
+    batch.command = {1, instances, (GLuint)pIndirectPrimitiveVertices.size(), (GLuint)pIndirectPrimitiveInstances.size()};
+
+    // The pixel batch renderer places pixels purely through the instance offsets
+    pIndirectPrimitiveVertices.push_back(glm::vec2(0.0f));
+    pIndirectPrimitiveInstances.insert(pIndirectPrimitiveInstances.end(), vectors->begin(), vectors->begin() + instances);
+    batch.sequence = pIndirectSprites.size() + pIndirectPrimitives.size();
+    pIndirectPrimitives.push_back(batch);
+}
+
+/**
+ * @brief Submits every queued batch, called by SGL_Window before the frame is composited
+ *
+ * @return nothing
+ */
+void SGL_Renderer::flushIndirectBatches()
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::flushIndirectBatches");
+    SGL_TRACE_ZONE("SGL_Renderer::flushIndirectBatches");
+    if (pIndirectSprites.empty() && pIndirectPrimitives.empty())
+        return;
+
+    // One upload per buffer for the whole queue
+    if (!pIndirectSprites.empty())
+    {
+        WMOGLM->namedBufferSubData(this->pIndirectSpriteVBO, 0, sizeof(glm::vec4) * pIndirectSpriteVertices.size(), pIndirectSpriteVertices.data());
+        WMOGLM->namedBufferSubData(this->pIndirectSpriteInstancesVBO, 0, sizeof(glm::mat4) * pIndirectSpriteInstances.size(), pIndirectSpriteInstances.data());
+    }
+    if (!pIndirectPrimitives.empty())
+    {
+        WMOGLM->namedBufferSubData(this->pIndirectPrimitiveVBO, 0, sizeof(glm::vec2) * pIndirectPrimitiveVertices.size(), pIndirectPrimitiveVertices.data());
+        WMOGLM->namedBufferSubData(this->pIndirectPrimitiveInstancesVBO, 0, sizeof(glm::vec2) * pIndirectPrimitiveInstances.size(), pIndirectPrimitiveInstances.data());
+    }
+
+    // Sprites and primitives use separate halves of the indirect buffer
+    WMOGLM->bindDIBO(this->pIndirectDIBO);
+    for (int half = 0; half < 2; ++half)
+    {
+        const std::vector<IndirectBatch> &queue = (half == 0) ? pIndirectSprites : pIndirectPrimitives;
+        if (queue.empty())
+            continue;
+        pIndirectCommands.clear();
+        for (const IndirectBatch &batch : queue)
+            pIndirectCommands.push_back(batch.command);
+        WMOGLM->namedBufferSubData(this->pIndirectDIBO, sizeof(SGL_DrawArraysIndirectCommand) * (half == 0 ? 0 : SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES),
+                                   sizeof(SGL_DrawArraysIndirectCommand) * pIndirectCommands.size(), pIndirectCommands.data());
+    }
+
+    // Walk both queues in submission order, only consecutive batches with the same state are
+    // merged so a later batch is never drawn under an earlier one
+    std::size_t sprite = 0, primitive = 0;
+    const std::string *boundVAO = nullptr;
+    const SGL_Shader *lastShader = nullptr;
+    while (sprite < pIndirectSprites.size() || primitive < pIndirectPrimitives.size())
+    {
+        const bool sprites = primitive == pIndirectPrimitives.size() ||
+            (sprite < pIndirectSprites.size() && pIndirectSprites[sprite].sequence < pIndirectPrimitives[primitive].sequence);
+        const std::vector<IndirectBatch> &queue = sprites ? pIndirectSprites : pIndirectPrimitives;
+        std::size_t &runStart = sprites ? sprite : primitive;
+        // The run stops where the other queue has something older to draw
+        const std::vector<IndirectBatch> &other = sprites ? pIndirectPrimitives : pIndirectSprites;
+        const std::size_t otherNext = sprites ? primitive : sprite;
+        const std::size_t limit = (otherNext < other.size()) ? other[otherNext].sequence : SIZE_MAX;
+
+        std::size_t runEnd = runStart + 1;
+        while (runEnd < queue.size() && queue[runEnd].sequence < limit && sameIndirectState(queue[runEnd], queue[runStart]))
+            ++runEnd;
+
+        const std::string &vao = sprites ? this->pIndirectSpriteVAO : this->pIndirectPrimitiveVAO;
+        if (boundVAO != &vao)
+        {
+            WMOGLM->bindVAO(vao);
+            boundVAO = &vao;
+        }
+        this->submitIndirectRun(queue, runStart, runEnd, sprites ? 0 : SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES);
+        lastShader = &queue[runStart].shader;
+        runStart = runEnd;
+    }
+
+    // Cleanup
+    WMOGLM->unbindDIBO();
+    WMOGLM->unbindVAO();
+    WMOGLM->lineWidth(SGL_OGL_CONSTANTS::MIN_LINE_WIDTH);
+    WMOGLM->pixelSize(SGL_OGL_CONSTANTS::MIN_PIXEL_SIZE);
+    WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
+    lastShader->unbind(*WMOGLM);
+
+    pIndirectSprites.clear();
+    pIndirectPrimitives.clear();
+    pIndirectSpriteVertices.clear();
+    pIndirectSpriteInstances.clear();
+    pIndirectPrimitiveVertices.clear();
+    pIndirectPrimitiveInstances.clear();
+
+#ifdef SGL_CHECK_FOR_ERRORS_ON_RENDER
+    WMOGLM->checkForGLErrors();
+#endif
+}
+
+/**
+ * @brief Compares everything a multi-draw shares between its commands
+ * @param a Queued batch
+ * @param b Queued batch
+ *
+ * @return bool True if both batches can be drawn by the same multi-draw
+ */
+bool SGL_Renderer::sameIndirectState(const IndirectBatch &a, const IndirectBatch &b) noexcept
+{
+    return a.shader.ID == b.shader.ID && a.shader.pipeline == b.shader.pipeline && a.textureID == b.textureID &&
+        a.blending == b.blending && a.mode == b.mode && a.color == b.color && a.dimensions == b.dimensions && a.size == b.size;
+}
+
+/**
+ * @brief Applies the render state of a run of batches and issues its multi-draw
+ * @param queue Queue holding the run, its VAO and the indirect buffer must be bound
+ * @param runStart First batch of the run
+ * @param runEnd One past the last batch of the run, every batch in between shares the state of the first
+ * @param commandOffset First command slot of the queue inside the indirect buffer
+ *
+ * @return nothing
+ */
+void SGL_Renderer::submitIndirectRun(const std::vector<IndirectBatch> &queue, std::size_t runStart, std::size_t runEnd, GLuint commandOffset) noexcept
+{
+    const IndirectBatch &batch = queue[runStart];
+    batch.shader.use(*WMOGLM);
+    batch.shader.setFloat(*WMOGLM, "deltaTime", batch.shader.renderDetails.deltaTime);
+    WMOGLM->blending(true, batch.blending);
+
+    if (batch.mode == GL_TRIANGLES)
+    {
+        batch.shader.setVector4f(*WMOGLM, "spriteColor", batch.color);
+        batch.shader.setVector2f(*WMOGLM, "spriteDimensions", batch.dimensions);
+        WMOGLM->activeTexture(GL_TEXTURE0);
+        WMOGLM->bindTexture(GL_TEXTURE_2D, batch.textureID);
+    }
+    else if (batch.mode == GL_LINES)
+    {
+        batch.shader.setVector4f(*WMOGLM, "lineColor", batch.color);
+        WMOGLM->lineWidth(batch.size);
+    }
+    else
+    {
+        batch.shader.setVector4f(*WMOGLM, "pointColor", batch.color);
+        WMOGLM->pixelSize(batch.size);
+    }
+
+    if (WMOGLM->multiDrawIndirectSupported())
+        WMOGLM->multiDrawArraysIndirect(batch.mode, (const void*)(sizeof(SGL_DrawArraysIndirectCommand) * (commandOffset + runStart)),
+                                        runEnd - runStart, 0);
+    else
+        for (std::size_t i = runStart; i < runEnd; ++i)
+            WMOGLM->drawArraysInstancedBaseInstance(batch.mode, queue[i].command.first, queue[i].command.count,
+                                                    queue[i].command.instanceCount, queue[i].command.baseInstance);
+}
+
+/**
+ * @brief Load the instanced bitmap text buffers, the glyph quad is the sprite batch's unit quad
+ *
+ * @return nothing
+ */
+void SGL_Renderer::loadTextBatchBuffers() noexcept
+{
+    SGL_Log("Configuring the bitmap text batch renderer...", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    WMOGLM->bindVAO(this->pTextBatchVAO);
+
+    // Filled on every renderBitmapTextBatch call
+    WMOGLM->bindVBO(this->pTextBatchInstancesVBO);
+    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(SGL_GlyphInstance) * SGL_OGL_CONSTANTS::MAX_TEXT_BATCH_GLYPHS, NULL, GL_DYNAMIC_DRAW);
+
+    // Instance locations MUST COINCIDE WITH THE SHADER
+    SGL_PositionLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pSpriteBatchVBO);
+    SGL_GlyphInstanceLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::INSTANCES, this->pTextBatchInstancesVBO);
+
+    WMOGLM->unbindVAO();
+    WMOGLM->unbindVBO();
+}
+
+/**
+ * @brief Load the shared multi-draw indirect buffers
+ *
+ * @return nothing
+ */
+void SGL_Renderer::loadIndirectBuffers() noexcept
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_Log("Configuring the indirect batch renderer...", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    if (!WMOGLM->multiDrawIndirectSupported())
+        SGL_Log("glMultiDrawArraysIndirect unavailable, queued batches will be drawn one by one.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_YELLOW);
+
+    const std::uint32_t primitiveInstances = SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES + SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES;
+    pIndirectSprites.reserve(SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES);
+    pIndirectPrimitives.reserve(SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES);
+    pIndirectCommands.reserve(SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES);
+    pIndirectSpriteVertices.reserve(6 * SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES);
+    pIndirectSpriteInstances.reserve(SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES);
+    pIndirectPrimitiveVertices.reserve(2 * SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES);
+    pIndirectPrimitiveInstances.reserve(primitiveInstances);
+
+    // Sprites: interleaved quad vertices plus mat4 instances, same locations as the sprite batch shader
+    WMOGLM->bindVAO(this->pIndirectSpriteVAO);
+    WMOGLM->bindVBO(this->pIndirectSpriteVBO);
+    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(SGL_SpriteVertex) * 6 * SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES, NULL, GL_DYNAMIC_DRAW);
+    SGL_SpriteVertexLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pIndirectSpriteVBO);
+
+    WMOGLM->bindVBO(this->pIndirectSpriteInstancesVBO);
+    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(SGL_SpriteInstance) * SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES, NULL, GL_DYNAMIC_DRAW);
+    SGL_SpriteInstanceLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::INSTANCES, this->pIndirectSpriteInstancesVBO);
+
+    // Lines and pixels: vec2 vertices plus vec2 instance offsets, same locations as the line / pixel batch shaders
+    WMOGLM->bindVAO(this->pIndirectPrimitiveVAO);
+    WMOGLM->bindVBO(this->pIndirectPrimitiveVBO);
+    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(SGL_PositionVertex) * 2 * SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES, NULL, GL_DYNAMIC_DRAW);
+    SGL_PositionLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pIndirectPrimitiveVBO);
+
+    WMOGLM->bindVBO(this->pIndirectPrimitiveInstancesVBO);
+    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(SGL_PrimitiveInstance) * primitiveInstances, NULL, GL_DYNAMIC_DRAW);
+    SGL_PrimitiveInstanceLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::INSTANCES, this->pIndirectPrimitiveInstancesVBO);
+
+    WMOGLM->unbindVAO();
+    WMOGLM->unbindVBO();
+
+    // Commands, the first half belongs to sprites and the second to lines and pixels
+    WMOGLM->bindDIBO(this->pIndirectDIBO);
+    WMOGLM->bufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(SGL_DrawArraysIndirectCommand) * 2 * SGL_OGL_CONSTANTS::MAX_INDIRECT_BATCHES, NULL, GL_DYNAMIC_DRAW);
+    WMOGLM->unbindDIBO();
+
+#ifdef SGL_CHECK_FOR_ERRORS_ON_RENDER
+    WMOGLM->checkForGLErrors();
+#endif
+}
+
+/**
+ * @brief Creates a retained sprite layer that shares the sprite batch geometry
+ * @param name Layer identifier
+ * @param capacity Maximum amount of instances the layer can hold
+ * @param gpuCulling Cull the layer on the GPU before drawing it
+ *
+ * @return std::unique_ptr<SGL_SpriteLayer>
+ */
+std::unique_ptr<SGL_SpriteLayer> SGL_Renderer::createSpriteLayer(const std::string &name, std::uint32_t capacity, bool gpuCulling)
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    if (gpuCulling && !pGPUCulling)
+    {
+        SGL_Log("Compute shaders unavailable, sprite layer " + name + " won't be GPU culled.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_YELLOW);
+        gpuCulling = false;
+    }
+
+    std::unique_ptr<SGL_SpriteLayer> layer(new SGL_SpriteLayer(WMOGLM, name, capacity, gpuCulling));
+
+    // The layer VAOs reuse the sprite batch quad and UV buffers, only the instance data is their own
+    std::vector<std::string> vaos = {layer->getVAO()};
+    std::vector<std::string> instances = {layer->getInstancesVBO()};
+    if (gpuCulling)
+    {
+        vaos.push_back(layer->getCulledVAO());
+        instances.push_back(layer->getVisibleVBO());
+    }
+
+    for (std::size_t v = 0; v < vaos.size(); ++v)
+    {
+        WMOGLM->bindVAO(vaos[v]);
+        SGL_PositionLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pSpriteBatchVBO);
+        SGL_UVLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::UVS, this->pTextureUVVBO);
+        // Same instance format as the sprite batch renderer
+        SGL_SpriteInstanceLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::INSTANCES, instances[v]);
+    }
+
+    WMOGLM->unbindVAO();
+
+#ifdef SGL_CHECK_FOR_ERRORS_ON_RENDER
+    WMOGLM->checkForGLErrors();
+#endif
+    return layer;
+}
+
+/**
+ * @brief Renders every instance of a sprite layer in a single instanced call
+ * @param sprite SGL_Sprite holding the texture, UV, color, shader and blending for the whole layer
+ * @param layer The SGL_SpriteLayer to render, pending changes are uploaded first
+ *
+ * @return nothing
+ */
+void SGL_Renderer::renderSpriteLayer(const SGL_Sprite &sprite, SGL_SpriteLayer &layer)
+{
+    SGL_DEBUG_SCOPE(*WMOGLM);
+    SGL_GPU_TIMER_SCOPE(*WMOGLM, "SGL_Renderer::renderSpriteLayer");
+    SGL_TRACE_ZONE("SGL_Renderer::renderSpriteLayer");
+    // Only the modified range reaches the GPU
+    layer.flush();
+
+    if (layer.drawCount() == 0)
+        return;
+
+    // Cull and compact on the GPU, the command's instance count is written by the compute pass
+    const bool culled = layer.gpuCulling() && pGPUCulling;
+    if (culled)
+    {
+        SGL_DrawArraysIndirectCommand reset = {6, 0, 0, 0};
+        WMOGLM->namedBufferSubData(layer.getCommandBuffer(), 0, sizeof(reset), &reset);
+
+        const GLuint groups = (layer.drawCount() + SGL_OGL_CONSTANTS::CULL_WORKGROUP_SIZE - 1) / SGL_OGL_CONSTANTS::CULL_WORKGROUP_SIZE;
+        pCullShader.use(*WMOGLM);
+        pCullShader.setInteger(*WMOGLM, "totalInstances", layer.drawCount());
+        WMOGLM->bindSSBO(0, layer.getInstancesVBO());
+        WMOGLM->bindSSBO(1, layer.getVisibleVBO());
+        WMOGLM->bindSSBO(2, layer.getCommandBuffer());
+        WMOGLM->bindSSBO(3, layer.getGroupCountsBuffer());
+        // Count the survivors of every workgroup, then compact them in slot order
+        pCullShader.setInteger(*WMOGLM, "cullPass", 0);
+        WMOGLM->dispatchCompute(groups, 1, 1);
+        WMOGLM->memoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+        pCullShader.setInteger(*WMOGLM, "cullPass", 1);
+        WMOGLM->dispatchCompute(groups, 1, 1);
+        // The draw sources both the compacted instances and the command written above
+        WMOGLM->memoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+        WMOGLM->unbindSSBO(0);
+        WMOGLM->unbindSSBO(1);
+        WMOGLM->unbindSSBO(2);
+        WMOGLM->unbindSSBO(3);
+    }
+
+    const SGL_Shader &activeShader = (sprite.shader.shaderType != SHADER_TYPE::SPRITE) ? pSpriteBatchShader : sprite.shader;
+
+    const SGL_Texture &activeTexture = (sprite.texture.width == 0) ? pDefaultTexture : sprite.texture;
+
+    GLfloat UV[] = {
+        sprite.uvCoords.UV_topLeft.x / activeTexture.width, sprite.uvCoords.UV_topLeft.y / activeTexture.height,
+        sprite.uvCoords.UV_botRight.x / activeTexture.width, sprite.uvCoords.UV_botRight.y / activeTexture.height,
+        sprite.uvCoords.UV_botLeft.x / activeTexture.width, sprite.uvCoords.UV_botLeft.y / activeTexture.height,
+
+        sprite.uvCoords.UV_topLeft.x / activeTexture.width, sprite.uvCoords.UV_topLeft.y / activeTexture.height,
+        sprite.uvCoords.UV_topRight.x / activeTexture.width, sprite.uvCoords.UV_topRight.y / activeTexture.height,
+        sprite.uvCoords.UV_botRight.x / activeTexture.width, sprite.uvCoords.UV_botRight.y / activeTexture.height,
+    };
+
+    WMOGLM->bindVAO(culled ? layer.getCulledVAO() : layer.getVAO());
+    activeShader.use(*WMOGLM);
+
+    // Replace current texture coordinates
+    WMOGLM->namedBufferSubData(this->pTextureUVVBO, 0, sizeof(UV), &UV[0]);
+
+    // If the user didn't specify a blending mode use the renderers default
+    if (sprite.blending == 0)
+        WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
+    else
+        WMOGLM->blending(true, sprite.blending);
+
+    activeShader.setVector4f(*WMOGLM, "spriteColor", sprite.color.r, sprite.color.g, sprite.color.b, sprite.color.a);
+    activeShader.setFloat(*WMOGLM, "deltaTime", activeShader.renderDetails.deltaTime);
+    activeShader.setVector2f(*WMOGLM, "spriteDimensions", sprite.size.x, sprite.size.y);
+
+    WMOGLM->activeTexture(GL_TEXTURE0);
+    activeTexture.bind(*WMOGLM);
+
+    if (culled)
+    {
+        WMOGLM->bindDIBO(layer.getCommandBuffer());
+        WMOGLM->drawArraysIndirect(GL_TRIANGLES, 0);
+        WMOGLM->unbindDIBO();
+    }
+    else
+        WMOGLM->drawArraysInstanced(GL_TRIANGLES, 0, 6, layer.drawCount());
+
+    // Cleanup
+    activeShader.unbind(*WMOGLM);
+    WMOGLM->unbindVAO();
+    WMOGLM->unbindVBO();
+    WMOGLM->blending(true, BLENDING_TYPE::DEFAULT_RENDERING);
+
+#ifdef SGL_CHECK_FOR_ERRORS_ON_RENDER
+    WMOGLM->checkForGLErrors();
+#endif
+}
+
+/**
+ * @brief Sets the compute program that culls sprite layers created with gpuCulling
+ * @param shader Compute shader, must keep the binding points of cullInstancesC.c
+ *
+ * @return nothing
+ */
+void SGL_Renderer::setCullingShader(SGL_Shader shader) noexcept
+{
+    this->pCullShader = shader;
+    this->pGPUCulling = (shader.shaderType == SHADER_TYPE::COMPUTE);
+}
+
+/**
+ * @brief Sets the instanced shader used by renderBitmapTextBatch
+ * @param shader Shader built from bitmapTextBatchV.c / bitmapTextBatchF.c
+ *
+ * @return nothing
+ */
+void SGL_Renderer::setBitmapTextBatchShader(SGL_Shader shader) noexcept
+{
+    this->pTextBatchShader = shader;
+    this->pTextBatch = (shader.shaderType == SHADER_TYPE::SPRITE);
+}
+
 /**
  * @brief Load the line buffers
  * @param shader SGL_Shader to set as the line renderer default
@@ -792,8 +1810,7 @@ void SGL_Renderer::loadLineBuffers(SGL_Shader shader) noexcept
     WMOGLM->bindVAO(this->pLineVAO);
     WMOGLM->bindVBO(this->pLineVBO);
     WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-    WMOGLM->enableVertexAttribArray(0);
-    WMOGLM->vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), (GLvoid *)0);
+    SGL_PositionLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pLineVBO);
 
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
@@ -817,25 +1834,13 @@ void SGL_Renderer::loadLineBatchBuffers(SGL_Shader shader) noexcept
     WMOGLM->bindVAO(this->pLineBatchVAO);
     WMOGLM->bindVBO(this->pLineBatchVBO);
     WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-    WMOGLM->enableVertexAttribArray(0);
-    WMOGLM->vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), (GLvoid *)0);
+    SGL_PositionLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pLineBatchVBO);
 
-    WMOGLM->checkForGLErrors();
-    // Reserve the line batch memory
-    glm::vec4 memRes[SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES];
-    pLineVectors = new glm::vec4(SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES);
-
-    // Line batching
+    // Line batching, one vec2 offset per instance
     WMOGLM->bindVBO(pLineBatchInstancesVBO);
-    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(glm::vec4) * SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES, &memRes[0], GL_STATIC_DRAW);
-
-    // Line batching
-    SGL_Log("Configuring line batch shader attrib pointer 3.");
-    WMOGLM->enableVertexAttribArray(3);
+    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(SGL_PrimitiveInstance) * SGL_OGL_CONSTANTS::MAX_LINE_BATCH_INSTANCES, NULL, GL_DYNAMIC_DRAW);
+    SGL_PrimitiveInstanceLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::INSTANCES, this->pLineBatchInstancesVBO);
     WMOGLM->checkForGLErrors();
-    WMOGLM->vertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, (void*)0);
-    WMOGLM->checkForGLErrors();
-    WMOGLM->vertexAttribDivisor(3, 1);
 
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
@@ -859,8 +1864,7 @@ void SGL_Renderer::loadPointBuffers(SGL_Shader shader) noexcept
     WMOGLM->bindVAO(this->pPointVAO);
     WMOGLM->bindVBO(this->pPointVBO);
     WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-    WMOGLM->enableVertexAttribArray(0);
-    WMOGLM->vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (GLvoid *)0);
+    SGL_PositionLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pPointVBO);
 
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
@@ -882,30 +1886,18 @@ void SGL_Renderer::loadPixelBatchBuffers(SGL_Shader shader) noexcept
         0.0f, 0.0f
     };
 
-    // Reserve the pixel batch memory
-    glm::vec2 memRes[SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES];
-
     WMOGLM->bindVAO(this->pPixelBatchVAO);
 
-    // Pixel batching
+    // Pixel batching, one vec2 offset per instance
     WMOGLM->bindVBO(pPixelBatchInstancesVBO);
-    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(glm::vec2) * SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES, &memRes[0], GL_STATIC_DRAW);
-    WMOGLM->unbindVBO();
+    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(SGL_PrimitiveInstance) * SGL_OGL_CONSTANTS::MAX_PIXEL_BATCH_INSTANCES, NULL, GL_DYNAMIC_DRAW);
+    SGL_PrimitiveInstanceLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::INSTANCES, this->pPixelBatchInstancesVBO);
 
     // Model coords
     WMOGLM->bindVBO(this->pPixelBatchVBO);
     WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-    WMOGLM->enableVertexAttribArray(0);
-    WMOGLM->vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (GLvoid *)0);
-
-    // Pixel batching
-    SGL_Log("Configuring pixel batch shader attrib pointer 3.");
-    WMOGLM->bindVBO(pPixelBatchInstancesVBO);
-    WMOGLM->enableVertexAttribArray(3);
-    WMOGLM->checkForGLErrors();
-    WMOGLM->vertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, (void*)0);
+    SGL_PositionLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pPixelBatchVBO);
     WMOGLM->checkForGLErrors();
-    WMOGLM->vertexAttribDivisor(3, 1);
 
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
@@ -950,13 +1942,8 @@ void SGL_Renderer::loadSpriteBuffers(SGL_Shader shader) noexcept
     WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
 
     // Bind vertex data
-    WMOGLM->bindVBO(this->pSpriteVBO);
-    WMOGLM->enableVertexAttribArray(0);
-    WMOGLM->vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), (GLvoid*)0);
-
-    WMOGLM->bindVBO(this->pTextureUVVBO);
-    WMOGLM->enableVertexAttribArray(1);
-    WMOGLM->vertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), (GLvoid*)0);
+    SGL_PositionLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pSpriteVBO);
+    SGL_UVLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::UVS, this->pTextureUVVBO);
 
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
@@ -992,22 +1979,14 @@ void SGL_Renderer::loadSpriteBatchBuffers(SGL_Shader shader) noexcept
         1.0f, 0.0f, // bot right
     };
 
-    // Reserve the memory required to store the sprite batch
-    modelMatrices = new glm::mat4[SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES];
-
-    WMOGLM->checkForGLErrors();
-
     WMOGLM->bindVAO(this->pSpriteBatchVAO);
     shader.use(*WMOGLM);
 
-    WMOGLM->checkForGLErrors();
-
     // Parse buffers to VBOs
 
-    // Sprite batch
+    // Sprite batch, filled on every renderSpriteBatch call
     WMOGLM->bindVBO(pSpriteBatchInstancesVBO);
-    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(glm::mat4) * SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES, &modelMatrices[0], GL_STATIC_DRAW);
-    WMOGLM->unbindVBO();
+    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(SGL_SpriteInstance) * SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES, NULL, GL_DYNAMIC_DRAW);
 
     // UV Coords
     WMOGLM->bindVBO(this->pTextureUVVBO);
@@ -1017,44 +1996,11 @@ void SGL_Renderer::loadSpriteBatchBuffers(SGL_Shader shader) noexcept
     WMOGLM->bindVBO(this->pSpriteBatchVBO);
     WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
 
-    // Bind to shaders
-
-    // Bind vertex data
-    WMOGLM->bindVBO(this->pSpriteBatchVBO);
-    WMOGLM->enableVertexAttribArray(0);
-    WMOGLM->vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), (GLvoid*)0);
-
-    // Bind texture data
-    WMOGLM->bindVBO(this->pTextureUVVBO);
-    WMOGLM->enableVertexAttribArray(1);
-    WMOGLM->vertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), (GLvoid*)0);
-
-    // Set instancing data
-    GLsizei vec4Size = sizeof(glm::vec4);
-    // SGL_Log("Configuring shader attrib pointer 3.");
-    WMOGLM->bindVBO(pSpriteBatchInstancesVBO);
-    WMOGLM->enableVertexAttribArray(3);
+    // Bind to shaders, instance locations MUST COINCIDE WITH THE SHADER
+    SGL_PositionLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pSpriteBatchVBO);
+    SGL_UVLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::UVS, this->pTextureUVVBO);
+    SGL_SpriteInstanceLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::INSTANCES, this->pSpriteBatchInstancesVBO);
     WMOGLM->checkForGLErrors();
-    WMOGLM->vertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, vec4Size * 4, (void*)0);
-    WMOGLM->checkForGLErrors();
-
-    // SGL_Log("Configuring shader attrib pointer 4.");
-    WMOGLM->enableVertexAttribArray(4);
-    WMOGLM->vertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, vec4Size * 4, (void*)(vec4Size));
-    WMOGLM->checkForGLErrors();
-
-    WMOGLM->enableVertexAttribArray(5);
-    WMOGLM->vertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, vec4Size * 4, (void*)(2 * vec4Size));
-    WMOGLM->checkForGLErrors();
-
-    WMOGLM->enableVertexAttribArray(6);
-    WMOGLM->vertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, vec4Size * 4, (void*)(3 * vec4Size));
-
-    WMOGLM->vertexAttribDivisor(3, 1);
-    WMOGLM->vertexAttribDivisor(4, 1);
-    WMOGLM->vertexAttribDivisor(5, 1);
-    WMOGLM->vertexAttribDivisor(6, 1);
-    WMOGLM->unbindVBO();
 
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
@@ -1080,8 +2026,13 @@ void SGL_Renderer::generateFont(const std::string fontPath)
         throw SGL_Exception("SGL_Renderer::generateFont | Could not open the FreeType library.");
     }
 
+    // The default font is embedded in the library, the data outlives the face
     FT_Face face;
-    if(FT_New_Face(ft, fontPath.c_str(), 0, &face))
+    const SGL_EmbeddedAsset *embedded = sglEmbeddedAsset(fontPath);
+    FT_Error error = (embedded != nullptr) ?
+        FT_New_Memory_Face(ft, embedded->data, static_cast<FT_Long>(embedded->size), 0, &face) :
+        FT_New_Face(ft, fontPath.c_str(), 0, &face);
+    if(error)
     {
         SGL_Log("ERROR::FREETYPE: Failed to load font" + fontPath, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
         throw SGL_Exception("SGL_Renderer::generateFont | Error generating font: ");
@@ -1109,10 +2060,10 @@ void SGL_Renderer::generateFont(const std::string fontPath)
         WMOGLM->texImage2D(GL_TEXTURE_2D, 0, GL_RED, face->glyph->bitmap.width, face->glyph->bitmap.rows,
                           0, GL_RED, GL_UNSIGNED_BYTE, face->glyph->bitmap.buffer);
         // Texture options
-        WMOGLM->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        WMOGLM->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        WMOGLM->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        WMOGLM->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        WMOGLM->textureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        WMOGLM->textureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        WMOGLM->textureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        WMOGLM->textureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
         // Store it in the map
         Character character = {
@@ -1132,9 +2083,8 @@ void SGL_Renderer::generateFont(const std::string fontPath)
     // VBO will be filled with glSubData during render
     WMOGLM->bindVAO(this->pTextVAO);
     WMOGLM->bindVBO(this->pTextVBO);
-    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
-    WMOGLM->enableVertexAttribArray(0);
-    WMOGLM->vertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), 0);
+    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(SGL_GlyphVertex) * 6, NULL, GL_DYNAMIC_DRAW);
+    SGL_GlyphLayout::apply(*WMOGLM, SGL_VERTEX_BINDING::VERTICES, this->pTextVBO);
 
     WMOGLM->unbindVAO();
     WMOGLM->unbindVBO();
@@ -28,6 +28,9 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
+#include <cstdint>
+#include <cstring>
 
 // GLM
 #include "../deps/glm/glm.hpp"
@@ -42,7 +45,11 @@
 #include "SGL_Shader.hpp"
 #include "../utility/SGL_DataStructures.hpp"
 #include "../utility/SGL_Utility.hpp"
+#include "../utility/SGL_Trace.hpp"
 #include "SGL_Texture.hpp"
+#include "SGL_SpriteLayer.hpp"
+#include "SGL_VertexLayout.hpp"
+#include "../utility/SGL_AssetManager.hpp"
 
 /**
  * @brief Defnies a sprite to be rendered
@@ -132,6 +139,66 @@ struct SGL_Line
 };
 
 
+/**
+ * @brief Lightweight sprite
+ * @section DESCRIPTION
+ *
+ * Plain data that references its shader and texture through SGL_AssetManager handles,
+ * rendering it never copies a shader, a texture or a string. Rotates around its center
+ * and keeps its UVs normalized.
+ */
+struct SGL_LiteSprite
+{
+    glm::vec2 position, size;                    ///< Positioning and scaling
+    glm::vec4 uvRect;                            ///< Normalized UVs, top left (x, y) and bottom right (z, w)
+    GLfloat rotation;                            ///< Rotation in radians around the sprite's center
+    SGL_Color8 color;                            ///< Sprite color
+    SGL_TextureHandle texture;                   ///< Sprite texture, invalid = renderer default
+    SGL_ShaderHandle shader;                     ///< Sprite shader, invalid = renderer default
+    std::uint8_t blending;                       ///< BLENDING_TYPE
+
+    // Specify a custom quad as UV coordinates, same convention as SGL_Sprite::changeUVCoords
+    void changeUVCoords(const SGL_Texture &texture, int x, int y, int w, int h) noexcept
+        {
+            if (texture.width <= 0)
+                return;
+            const float width = texture.width, height = texture.height;
+            uvRect = glm::vec4(x / width, (height - (y + h)) / height, (x + w) / width, (height - y) / height);
+        }
+
+    SGL_LiteSprite() : position(0.0f), size(0.0f), uvRect(0.0f, 0.0f, 1.0f, 1.0f), rotation(0.0f), blending(DEFAULT_RENDERING) {}
+};
+static_assert(sizeof(SGL_LiteSprite) <= 48, "SGL_LiteSprite must fit in 48 bytes");
+
+/**
+ * @brief Lightweight pixel, see SGL_LiteSprite
+ */
+struct SGL_LitePixel
+{
+    glm::vec2 position;                          ///< Pixel position
+    SGL_Color8 color;                            ///< Pixel color
+    float size;                                  ///< Pixel size
+    SGL_ShaderHandle shader;                     ///< Pixel shader, invalid = renderer default
+    std::uint8_t blending;                       ///< BLENDING_TYPE
+
+    SGL_LitePixel() : position(0.0f), size(SGL_OGL_CONSTANTS::MIN_PIXEL_SIZE), blending(DEFAULT_RENDERING) {}
+};
+
+/**
+ * @brief Lightweight line, see SGL_LiteSprite
+ */
+struct SGL_LiteLine
+{
+    glm::vec2 positionA, positionB;              ///< Vertices for both ends of the line
+    SGL_Color8 color;                            ///< Line color
+    float width;                                 ///< Line width
+    SGL_ShaderHandle shader;                     ///< Line shader, invalid = renderer default
+    std::uint8_t blending;                       ///< BLENDING_TYPE
+
+    SGL_LiteLine() : positionA(0.0f), positionB(0.0f), width(SGL_OGL_CONSTANTS::MIN_LINE_WIDTH), blending(DEFAULT_RENDERING) {}
+};
+
+
 /**
  * @brief Encapsulates a string to be rendered by a TTF generated font
  * @section DESCRIPTION
@@ -183,6 +250,9 @@ private:
     SGL_Shader pSpriteBatchShader;               ///< Sprite batch shader
     SGL_Shader pPixelBatchShader;                ///< Pixel batch shader
     SGL_Shader pLineBatchShader;                 ///< Pixel batch shader
+    SGL_Shader pCullShader;                      ///< Sprite layer culling compute program
+    const SGL_AssetManager *pAssets;             ///< Resolves the lightweight renderables' handles
+    bool pGPUCulling;                            ///< Was a culling program provided?
     UV_Wrapper pDefaultUV;                       ///< Default UV values
     // Default texture in case a render is requested without a valid SGL_texture
     SGL_Texture pDefaultTexture;
@@ -193,17 +263,45 @@ private:
     // the AssetManager resource counter, gotta fix that later
     std::string pSpriteBatchVBO, pSpriteBatchVAO, pSpriteBatchInstancesVBO;
     std::uint32_t pSpriteBatchAmount;            ///< Maximum amount of sprites to render at once (CASUES SEGFAULT IF EXCEEDED!)
-    glm::mat4 *modelMatrices;
 
     // PIXEL BATCHING
     std::string pPixelBatchVBO, pPixelBatchVAO, pPixelBatchInstancesVBO;
     std::uint32_t pPixelBatchAmount;             ///< Maximum amount of pixels to render at once (CASUES SEGFAULT IF EXCEEDED!)
-    glm::vec2 *posVectors;
 
     // Line BATCHING
     std::string pLineBatchVBO, pLineBatchVAO, pLineBatchInstancesVBO;
     std::uint32_t pLineBatchAmount;              ///< Maximum amount of linex to render at once (CASUES SEGFAULT IF EXCEEDED!)
-    glm::vec4 *pLineVectors;                     ///< Pointer to the data to be batched
+
+    // BITMAP TEXT BATCHING
+    std::string pTextBatchVAO, pTextBatchInstancesVBO;
+    SGL_Shader pTextBatchShader;                 ///< Instanced bitmap text shader
+    bool pTextBatch;                             ///< Was a text batch shader provided?
+
+    // INDIRECT (MULTI-DRAW) BATCHING
+    // Queued batches are appended to shared vertex / instance buffers and submitted at
+    // flushIndirectBatches() in the order they were queued, consecutive batches sharing the
+    // same render state go out in a single glMultiDrawArraysIndirect call
+    struct IndirectBatch
+    {
+        SGL_Shader shader;                       ///< Resolved shader
+        GLuint textureID;                        ///< Bound texture (0 for lines and pixels)
+        BLENDING_TYPE blending;                  ///< Blending mode
+        GLenum mode;                             ///< GL_TRIANGLES, GL_LINES or GL_POINTS
+        glm::vec4 color;                         ///< Batch color uniform
+        glm::vec2 dimensions;                    ///< Sprite dimensions uniform
+        float size;                              ///< Line width or pixel size
+        SGL_DrawArraysIndirectCommand command;   ///< Ranges inside the shared buffers
+        std::size_t sequence;                    ///< Submission order across both queues
+    };
+    std::string pIndirectSpriteVAO, pIndirectSpriteVBO, pIndirectSpriteInstancesVBO;
+    std::string pIndirectPrimitiveVAO, pIndirectPrimitiveVBO, pIndirectPrimitiveInstancesVBO;
+    std::string pIndirectDIBO;                   ///< Draw indirect buffer shared by both queues
+    std::vector<IndirectBatch> pIndirectSprites, pIndirectPrimitives;
+    std::vector<glm::vec4> pIndirectSpriteVertices;      ///< Interleaved position (xy) and UV (zw)
+    std::vector<glm::mat4> pIndirectSpriteInstances;     ///< Sprite model matrices
+    std::vector<glm::vec2> pIndirectPrimitiveVertices;   ///< Line ends and pixel origins
+    std::vector<glm::vec2> pIndirectPrimitiveInstances;  ///< Line and pixel offsets
+    std::vector<SGL_DrawArraysIndirectCommand> pIndirectCommands; ///< Flush scratch buffer
 
 
     // Its important to point out that the individual pixel, line and sprite renderers
@@ -221,6 +319,36 @@ private:
     void loadSpriteBuffers(SGL_Shader shader) noexcept;
     void loadSpriteBatchBuffers(SGL_Shader shader) noexcept;
 
+    // Shared draw paths of the full and lightweight renderables
+    void drawPixel(const SGL_Shader &shader, glm::vec2 position, glm::vec4 color, float size, BLENDING_TYPE blending) const;
+    void drawLine(const SGL_Shader &shader, glm::vec2 positionA, glm::vec2 positionB, glm::vec4 color, float width, BLENDING_TYPE blending) const;
+    void drawSprite(const SGL_Shader &shader, const SGL_Texture &texture, const GLfloat (&UV)[12], const glm::mat4 &model,
+                    glm::vec4 color, glm::vec2 size, BLENDING_TYPE blending) const;
+    void drawLiteSprite(const SGL_LiteSprite &sprite, const SGL_Shader &shader, const SGL_Texture &texture) const;
+    // Handle resolution, invalid or mismatched handles fall back to the renderer defaults
+    const SGL_Shader &resolveShader(SGL_ShaderHandle handle, SHADER_TYPE type, const SGL_Shader &fallback) const noexcept;
+    const SGL_Texture &resolveTexture(SGL_TextureHandle handle) const noexcept;
+
+    // Map the first bytes of an instance VBO for writing, the previous contents are discarded
+    void *mapInstances(const std::string &vbo, std::size_t bytes) noexcept;
+    // Unmap the instance VBO mapped by mapInstances
+    void unmapInstances() noexcept;
+    // Clamp a batch to the instance limit of its renderer
+    std::size_t clampBatch(std::size_t count, std::uint32_t limit, const char *caller) const noexcept;
+    // Draw the first count instances already written to the batch instance VBOs
+    void drawSpriteBatch(const SGL_Sprite &sprite, std::size_t count);
+    void drawLineBatch(const SGL_Line &line, std::size_t count);
+    void drawPixelBatch(const SGL_Pixel &pixel, std::size_t count);
+
+    // Load the shared indirect draw buffers
+    void loadIndirectBuffers() noexcept;
+    // Load the instanced bitmap text buffers
+    void loadTextBatchBuffers() noexcept;
+    // Can both batches go out in the same multi-draw?
+    static bool sameIndirectState(const IndirectBatch &a, const IndirectBatch &b) noexcept;
+    // Sets the render state of queue[runStart] and draws queue[runStart, runEnd) with one multi-draw
+    void submitIndirectRun(const std::vector<IndirectBatch> &queue, std::size_t runStart, std::size_t runEnd, GLuint commandOffset) noexcept;
+
     // Load and generate the ttf font
     void generateFont(const std::string fontPath);
 
@@ -250,13 +378,53 @@ public:
     void renderText(SGL_Text &text);
 
     void renderBitmapText(SGL_Bitmap_Text &text) const;
+    // Every glyph in a single instanced draw, '\n' starts a new line
+    void renderBitmapTextBatch(const SGL_Bitmap_Text &text);
 
     void renderSprite(const SGL_Sprite &sprite) const;
 
+    // LIGHTWEIGHT RENDERABLES
+    // Handles are resolved through the asset manager set with setAssetManager()
+    void renderPixel(const SGL_LitePixel &pixel) const;
+    void renderLine(const SGL_LiteLine &line) const;
+    void renderSprite(const SGL_LiteSprite &sprite) const;
+    void setAssetManager(const SGL_AssetManager *assets) noexcept;
+
     // BATCH / INSTANCE RENDERING
     void renderSpriteBatch(const SGL_Sprite &sprite, const std::vector<glm::mat4> *matrices);
     void renderLineBatch(const SGL_Line &line, const std::vector<glm::vec2> *vectors);
     void renderPixelBatch(const SGL_Pixel &pixel, const std::vector<glm::vec2> *vectors);
+
+    // ZERO COPY BATCH RENDERING
+    // Instances are gathered straight from the caller's storage into the mapped GPU buffer. Stride is the
+    // byte distance between consecutive elements (0 = tightly packed) so a member of an AoS array can be
+    // passed directly, the SoA overloads take one array per attribute (nullptr sizes / rotations fall back
+    // to the sprite's own values)
+    void renderSpriteBatch(const SGL_Sprite &sprite, const glm::mat4 *matrices, std::size_t count, std::size_t stride = 0);
+    void renderSpriteBatch(const SGL_Sprite &sprite, const glm::vec2 *positions, const glm::vec2 *sizes, const float *rotations, std::size_t count);
+    void renderLineBatch(const SGL_Line &line, const glm::vec2 *offsets, std::size_t count, std::size_t stride = 0);
+    void renderLineBatch(const SGL_Line &line, const float *offsetsX, const float *offsetsY, std::size_t count);
+    void renderPixelBatch(const SGL_Pixel &pixel, const glm::vec2 *positions, std::size_t count, std::size_t stride = 0);
+    void renderPixelBatch(const SGL_Pixel &pixel, const float *positionsX, const float *positionsY, std::size_t count);
+
+    // MULTI-DRAW INDIRECT BATCHING
+    // Same arguments as the batch renderers, the batch is deferred until flushIndirectBatches() (called by
+    // SGL_Window::endFrame and before camera mode / render layer changes). Batches are drawn in the order they
+    // were queued, only consecutive batches sharing shader, texture, color, size and blending are merged
+    void queueSpriteBatch(const SGL_Sprite &sprite, const std::vector<glm::mat4> *matrices);
+    void queueLineBatch(const SGL_Line &line, const std::vector<glm::vec2> *vectors);
+    void queuePixelBatch(const SGL_Pixel &pixel, const std::vector<glm::vec2> *vectors);
+    void flushIndirectBatches();
+
+    // RETAINED SPRITE LAYERS
+    // Layers created with gpuCulling are culled against the camera by a compute pass before every draw,
+    // the visible instance count never leaves the GPU (requires OpenGL 4.3, ignored otherwise)
+    std::unique_ptr<SGL_SpriteLayer> createSpriteLayer(const std::string &name, std::uint32_t capacity = SGL_OGL_CONSTANTS::MAX_SPRITE_BATCH_INSTANCES, bool gpuCulling = false);
+    void renderSpriteLayer(const SGL_Sprite &sprite, SGL_SpriteLayer &layer);
+    // Compute program used to cull sprite layers, set by SGL_Window when compute shaders are available
+    void setCullingShader(SGL_Shader shader) noexcept;
+    // Instanced shader used by renderBitmapTextBatch, set by SGL_Window
+    void setBitmapTextBatchShader(SGL_Shader shader) noexcept;
 };
 
 #endif //SRC_SKELETONGL_RENDERER_RENDERER_HPP
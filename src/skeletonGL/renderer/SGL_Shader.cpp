@@ -31,7 +31,7 @@
  *
  * @return nothing
  */
-SGL_Shader::SGL_Shader()
+SGL_Shader::SGL_Shader() : ID(0), shaderType(SHADER_TYPE::NO_SHADER), pipeline(0), vertexStage(0), fragmentStage(0)
 {
 
 }
@@ -54,7 +54,26 @@ SGL_Shader::~SGL_Shader()
  */
 SGL_Shader &SGL_Shader::use(SGL_OpenGLManager &oglm) noexcept
 {
-    oglm.useProgram(this->ID);
+    static_cast<const SGL_Shader&>(*this).use(oglm);
+    return *this;
+}
+
+/**
+ * @brief Enable the shader, const overload so shared shaders can be used without copying them
+ * @param oglm The windows OpenGL context
+ *
+ * @return nothing
+ */
+const SGL_Shader &SGL_Shader::use(SGL_OpenGLManager &oglm) const noexcept
+{
+    if (this->pipeline != 0)
+    {
+        // An active program takes precedence over the bound pipeline
+        oglm.useProgram(0);
+        oglm.bindProgramPipeline(this->pipeline);
+    }
+    else
+        oglm.useProgram(this->ID);
     return *this;
 }
 
@@ -68,6 +87,8 @@ SGL_Shader &SGL_Shader::use(SGL_OpenGLManager &oglm) noexcept
 void SGL_Shader::unbind(SGL_OpenGLManager &oglm) const noexcept
 {
     oglm.useProgram(0);
+    if (this->pipeline != 0)
+        oglm.bindProgramPipeline(0);
 }
 
 
@@ -84,44 +105,214 @@ void SGL_Shader::unbind(SGL_OpenGLManager &oglm) const noexcept
 void SGL_Shader::compileShaders(SGL_OpenGLManager &oglm, SHADER_TYPE shaderType, const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource) noexcept
 
 {
-    GLuint sVertex, sFragment, sGeometry;
-
-    sVertex = oglm.createShader(GL_VERTEX_SHADER);
-    oglm.shaderSource(sVertex, 1, &vertexSource, NULL);
-    oglm.compileShader(sVertex);
-    checkForErrors(oglm, sVertex, "VERTEX");
-
-    sFragment = oglm.createShader(GL_FRAGMENT_SHADER);
-    oglm.shaderSource(sFragment, 1, &fragmentSource, NULL);
-    oglm.compileShader(sFragment);
-    checkForErrors(oglm, sFragment, "FRAGMENT");
+    std::vector<GLuint> stages = this->submitShaders(oglm, shaderType, vertexSource, fragmentSource, geometrySource);
+    this->finishShaders(oglm, stages);
+}
 
+/**
+ * @brief Compiles every stage and starts linking the program without querying any status
+ * @param oglm The windows OpenGL context
+ * @param shadetType Shader category
+ * @param vertexSource C string to the vertex shader file
+ * @param fragmentSource C string to the fragment shader file
+ * @param geometrySource C string to the geometry shader file (optional)
+ *
+ * @return std::vector<GLuint> The stage shaders, pass them to finishShaders()
+ *
+ * Querying a compile or link status forces the driver to finish that job, submitting every
+ * program before checking any of them lets the driver compile them in parallel.
+ */
+std::vector<GLuint> SGL_Shader::submitShaders(SGL_OpenGLManager &oglm, SHADER_TYPE shaderType, const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource) noexcept
+{
+    std::vector<GLuint> stages;
+    auto compileStage = [&](GLenum type, const GLchar *source) {
+        GLuint stage = oglm.createShader(type);
+        oglm.shaderSource(stage, 1, &source, NULL);
+        oglm.compileShader(stage);
+        stages.push_back(stage);
+    };
+    compileStage(GL_VERTEX_SHADER, vertexSource);
+    compileStage(GL_FRAGMENT_SHADER, fragmentSource);
     if(geometrySource != nullptr)
+        compileStage(GL_GEOMETRY_SHADER, geometrySource);
+
+    this->ID = oglm.createProgram();
+    // Lets the program cache retrieve the binary after linking
+    if (oglm.programBinarySupported())
+        oglm.programParameteri(this->ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    for (GLuint stage : stages)
+        oglm.attachShader(this->ID, stage);
+    oglm.linkProgram(this->ID);
+    this->shaderType = shaderType;
+    return stages;
+}
+
+/**
+ * @brief Checks the result of submitShaders(), blocks until the driver is done
+ * @param oglm The windows OpenGL context
+ * @param stages Stage shaders returned by submitShaders(), deleted once checked
+ *
+ * @return nothing
+ */
+void SGL_Shader::finishShaders(SGL_OpenGLManager &oglm, const std::vector<GLuint> &stages)
+{
+    for (GLuint stage : stages)
     {
-        sGeometry = oglm.createShader(GL_GEOMETRY_SHADER);
-        oglm.shaderSource(sGeometry, 1, &geometrySource, NULL);
-        oglm.compileShader(sGeometry);
-        checkForErrors(oglm, sGeometry, "GEOMETRY");
+        GLint type;
+        oglm.getShaderiv(stage, GL_SHADER_TYPE, &type);
+        checkForErrors(oglm, stage, (type == GL_VERTEX_SHADER) ? "VERTEX" : (type == GL_FRAGMENT_SHADER) ? "FRAGMENT" : "GEOMETRY");
     }
+    checkForErrors(oglm, this->ID, "PROGRAM");
 
-    this->ID = glCreateProgram();
-    oglm.attachShader(this->ID, sVertex);
-    oglm.attachShader(this->ID, sFragment);
-    if(geometrySource != nullptr)
+    for (GLuint stage : stages)
+        oglm.deleteShader(stage);
+}
+
+/**
+ * @brief Has the driver finished linking the program? Never blocks
+ * @param oglm The windows OpenGL context
+ *
+ * @return bool Always true without KHR_parallel_shader_compile, finishShaders() blocks instead
+ */
+bool SGL_Shader::linkCompleted(SGL_OpenGLManager &oglm) const noexcept
+{
+    if (!oglm.parallelShaderCompileSupported())
+        return true;
+    GLint completed = GL_FALSE;
+    oglm.getProgramiv(this->ID, GL_COMPLETION_STATUS_KHR, &completed);
+    return completed == GL_TRUE;
+}
+
+/**
+ * @brief Compiles and links a compute shader, requires OpenGL 4.3 or ARB_compute_shader
+ * @param oglm The windows OpenGL context
+ * @param computeSource C string to the compute shader source
+ *
+ * @return nothing
+ */
+void SGL_Shader::compileComputeShader(SGL_OpenGLManager &oglm, const GLchar *computeSource) noexcept
+{
+    GLuint sCompute = oglm.createShader(GL_COMPUTE_SHADER);
+    oglm.shaderSource(sCompute, 1, &computeSource, NULL);
+    oglm.compileShader(sCompute);
+    checkForErrors(oglm, sCompute, "COMPUTE");
+
+    this->ID = oglm.createProgram();
+    if (oglm.programBinarySupported())
+        oglm.programParameteri(this->ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    oglm.attachShader(this->ID, sCompute);
+    oglm.linkProgram(this->ID);
+    this->shaderType = SHADER_TYPE::COMPUTE;
+
+    checkForErrors(oglm, this->ID, "PROGRAM");
+
+    oglm.deleteShader(sCompute);
+}
+
+/**
+ * @brief Creates the program from a binary retrieved with glGetProgramBinary, nothing is compiled
+ * @param oglm The windows OpenGL context
+ * @param shaderType Shader category
+ * @param binaryFormat Driver format the binary was retrieved with
+ * @param binary Program binary
+ * @param length Binary size in bytes
+ *
+ * @return bool False if the driver rejected the binary, the program is deleted and ID reset to 0
+ */
+bool SGL_Shader::loadBinary(SGL_OpenGLManager &oglm, SHADER_TYPE shaderType, GLenum binaryFormat, const void *binary, GLsizei length) noexcept
+{
+    GLint success = GL_FALSE;
+    this->ID = oglm.createProgram();
+    oglm.programParameteri(this->ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    oglm.programBinary(this->ID, binaryFormat, binary, length);
+    oglm.getProgramiv(this->ID, GL_LINK_STATUS, &success);
+    if (!success)
     {
-        oglm.attachShader(this->ID, sGeometry);
+        oglm.deleteProgram(this->ID);
+        this->ID = 0;
+        this->shaderType = SHADER_TYPE::NO_SHADER;
+        return false;
     }
-    oglm.linkProgram(this->ID);
     this->shaderType = shaderType;
+    return true;
+}
+
 
+/**
+ * @brief Compiles and links a single stage separable program, requires OpenGL 4.1 or ARB_separate_shader_objects
+ * @param oglm The windows OpenGL context
+ * @param stage GL_VERTEX_SHADER or GL_FRAGMENT_SHADER
+ * @param source C string to the stage source
+ *
+ * @return nothing
+ *
+ * Stage programs can't be rendered with on their own (shaderType is NO_SHADER), combine
+ * them with compilePipeline(). Vertex stages must redeclare gl_PerVertex.
+ */
+void SGL_Shader::compileStage(SGL_OpenGLManager &oglm, GLenum stage, const GLchar *source) noexcept
+{
+    this->ID = oglm.createShaderProgramv(stage, 1, &source);
+    this->shaderType = SHADER_TYPE::NO_SHADER;
     checkForErrors(oglm, this->ID, "PROGRAM");
+}
 
-    oglm.deleteShader(sVertex);
-    oglm.deleteShader(sFragment);
-    if(geometrySource != nullptr)
-        oglm.deleteShader(sGeometry);
+/**
+ * @brief Combines two stage programs into a program pipeline, no linking involved
+ * @param oglm The windows OpenGL context
+ * @param shaderType Shader category
+ * @param vertex Vertex stage compiled with compileStage()
+ * @param fragment Fragment stage compiled with compileStage()
+ *
+ * @return nothing
+ */
+void SGL_Shader::compilePipeline(SGL_OpenGLManager &oglm, SHADER_TYPE shaderType, const SGL_Shader &vertex, const SGL_Shader &fragment)
+{
+    if (vertex.ID == 0 || fragment.ID == 0 || vertex.pipeline != 0 || fragment.pipeline != 0)
+        throw SGL_Exception("SGL_Shader::compilePipeline | Pipelines must be built from stage programs.");
+
+    this->ID = 0;
+    this->vertexStage = vertex.ID;
+    this->fragmentStage = fragment.ID;
+    this->shaderType = shaderType;
+    this->pStageLocations = std::make_shared<std::map<std::string, std::pair<GLint, GLint>, std::less<>>>();
+    oglm.genProgramPipelines(1, &this->pipeline);
+    oglm.useProgramStages(this->pipeline, GL_VERTEX_SHADER_BIT, this->vertexStage);
+    oglm.useProgramStages(this->pipeline, GL_FRAGMENT_SHADER_BIT, this->fragmentStage);
+
+    // Mismatched stage interfaces show up here
+    GLint success;
+    oglm.validateProgramPipeline(this->pipeline);
+    oglm.getProgramPipelineiv(this->pipeline, GL_VALIDATE_STATUS, &success);
+    if (!success)
+    {
+        GLchar infoLog[1024];
+        oglm.getProgramPipelineInfoLog(this->pipeline, 1024, NULL, infoLog);
+        SGL_Log("SGL_Shader::compilePipeline | Pipeline validation failed: " + std::string(infoLog), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_YELLOW);
+    }
 }
 
+/**
+ * @brief Deletes the OpenGL objects of the shader and resets it
+ * @param oglm The windows OpenGL context
+ *
+ * @return nothing
+ *
+ * Pipelines only delete the pipeline object, their stages are deleted through their own
+ * shaders. Copies made before this call are left with dead names.
+ */
+void SGL_Shader::deleteProgram(SGL_OpenGLManager &oglm) noexcept
+{
+    if (this->pipeline != 0)
+        oglm.deleteProgramPipelines(1, &this->pipeline);
+    else if (this->ID != 0)
+        oglm.deleteProgram(this->ID);
+    this->ID = 0;
+    this->pipeline = 0;
+    this->vertexStage = 0;
+    this->fragmentStage = 0;
+    this->pStageLocations.reset();
+    this->shaderType = SHADER_TYPE::NO_SHADER;
+}
 
 /**
  * @brief Sets a single float value
@@ -132,11 +323,11 @@ void SGL_Shader::compileShaders(SGL_OpenGLManager &oglm, SHADER_TYPE shaderType,
  *
  * @return nothing
  */
-void SGL_Shader::setFloat(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat value, GLboolean useShader) noexcept
+void SGL_Shader::setFloat(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat value, GLboolean useShader) const noexcept
 {
     if (useShader)
         this->use(oglm);
-    oglm.uniform1f(glGetUniformLocation(this->ID, name), value);
+    forEachUniform(oglm, name, [=, &oglm](GLuint program, GLint location) { oglm.programUniform1f(program, location, value); });
 }
 
 /**
@@ -148,11 +339,11 @@ void SGL_Shader::setFloat(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat v
  *
  * @return nothing
  */
-void SGL_Shader::setInteger(SGL_OpenGLManager &oglm, const GLchar *name, GLint value, GLboolean useShader) noexcept
+void SGL_Shader::setInteger(SGL_OpenGLManager &oglm, const GLchar *name, GLint value, GLboolean useShader) const noexcept
 {
     if (useShader)
         this->use(oglm);
-    oglm.uniform1i(glGetUniformLocation(this->ID, name), value);
+    forEachUniform(oglm, name, [=, &oglm](GLuint program, GLint location) { oglm.programUniform1i(program, location, value); });
 }
 
 /**
@@ -165,11 +356,11 @@ void SGL_Shader::setInteger(SGL_OpenGLManager &oglm, const GLchar *name, GLint v
  *
  * @return nothing
  */
-void SGL_Shader::setVector2f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLboolean useShader) noexcept
+void SGL_Shader::setVector2f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLboolean useShader) const noexcept
 {
     if (useShader)
         this->use(oglm);
-    oglm.uniform2f(glGetUniformLocation(this->ID, name), x, y);
+    forEachUniform(oglm, name, [=, &oglm](GLuint program, GLint location) { oglm.programUniform2f(program, location, x, y); });
 }
 
 
@@ -182,11 +373,11 @@ void SGL_Shader::setVector2f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloa
  *
  * @return nothing
  */
-void SGL_Shader::setVector2f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec2 value, GLboolean useShader) noexcept
+void SGL_Shader::setVector2f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec2 value, GLboolean useShader) const noexcept
 {
     if (useShader)
         this->use(oglm);
-    oglm.uniform2f(glGetUniformLocation(this->ID, name), value.x, value.y);
+    forEachUniform(oglm, name, [=, &oglm](GLuint program, GLint location) { oglm.programUniform2f(program, location, value.x, value.y); });
 }
 
 
@@ -201,11 +392,11 @@ void SGL_Shader::setVector2f(SGL_OpenGLManager &oglm, const GLchar *name, glm::v
  *
  * @return nothing
  */
-void SGL_Shader::setVector3f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLfloat z, GLboolean useShader) noexcept
+void SGL_Shader::setVector3f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLfloat z, GLboolean useShader) const noexcept
 {
     if (useShader)
         this->use(oglm);
-    oglm.uniform3f(glGetUniformLocation(this->ID, name), x, y, z);
+    forEachUniform(oglm, name, [=, &oglm](GLuint program, GLint location) { oglm.programUniform3f(program, location, x, y, z); });
 }
 
 
@@ -218,11 +409,11 @@ void SGL_Shader::setVector3f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloa
  *
  * @return nothing
  */
-void SGL_Shader::setVector3f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec3 value, GLboolean useShader) noexcept
+void SGL_Shader::setVector3f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec3 value, GLboolean useShader) const noexcept
 {
     if (useShader)
         this->use(oglm);
-    oglm.uniform3f(glGetUniformLocation(this->ID, name), value.x, value.y, value.z);
+    forEachUniform(oglm, name, [=, &oglm](GLuint program, GLint location) { oglm.programUniform3f(program, location, value.x, value.y, value.z); });
 }
 
 
@@ -238,11 +429,11 @@ void SGL_Shader::setVector3f(SGL_OpenGLManager &oglm, const GLchar *name, glm::v
  *
  * @return nothing
  */
-void SGL_Shader::setVector4f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w, GLboolean useShader) noexcept
+void SGL_Shader::setVector4f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w, GLboolean useShader) const noexcept
 {
     if (useShader)
         this->use(oglm);
-    oglm.uniform4f(glGetUniformLocation(this->ID, name), x, y, z, w);
+    forEachUniform(oglm, name, [=, &oglm](GLuint program, GLint location) { oglm.programUniform4f(program, location, x, y, z, w); });
 }
 
 
@@ -255,11 +446,11 @@ void SGL_Shader::setVector4f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloa
  *
  * @return nothing
  */
-void SGL_Shader::setVector4f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec4 value, GLboolean useShader) noexcept
+void SGL_Shader::setVector4f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec4 value, GLboolean useShader) const noexcept
 {
     if (useShader)
         this->use(oglm);
-    oglm.uniform4f(glGetUniformLocation(this->ID, name), value.x, value.y, value.z, value.w);
+    forEachUniform(oglm, name, [=, &oglm](GLuint program, GLint location) { oglm.programUniform4f(program, location, value.x, value.y, value.z, value.w); });
 
 }
 
@@ -273,11 +464,11 @@ void SGL_Shader::setVector4f(SGL_OpenGLManager &oglm, const GLchar *name, glm::v
  *
  * @return nothing
  */
-void SGL_Shader::setMatrix4(SGL_OpenGLManager &oglm, const GLchar *name, glm::mat4 matrix, GLboolean useShader) noexcept
+void SGL_Shader::setMatrix4(SGL_OpenGLManager &oglm, const GLchar *name, glm::mat4 matrix, GLboolean useShader) const noexcept
 {
     if(useShader)
         this->use(oglm);
-    oglm.uniformMatrix4fv(glGetUniformLocation(this->ID, name), 1, GL_FALSE, glm::value_ptr(matrix));
+    forEachUniform(oglm, name, [=, &oglm](GLuint program, GLint location) { oglm.programUniformMatrix4fv(program, location, 1, GL_FALSE, glm::value_ptr(matrix)); });
 }
 
 
@@ -28,6 +28,11 @@
 
 // C++
 #include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <cstdint>
+#include <initializer_list>
 // Dependencies
 #include <GL/glew.h>
 #include "../deps/glm/glm.hpp"
@@ -41,7 +46,25 @@
 /**
  * @brief What the shader will be used to render
  */
-enum class SHADER_TYPE : std::int8_t { NO_SHADER = 0, SPRITE = 1, TEXT = 2, PIXEL = 3, LINE = 4, QUAD = 5, POST_PROCESSOR = 6, END_ENUM = 7};
+enum class SHADER_TYPE : std::int8_t { NO_SHADER = 0, SPRITE = 1, TEXT = 2, PIXEL = 3, LINE = 4, QUAD = 5, POST_PROCESSOR = 6, COMPUTE = 7, END_ENUM = 8};
+
+/**
+ * @brief Lightweight reference to a shader owned by the SGL_AssetManager
+ * @section DESCRIPTION
+ *
+ * Trivially copyable, resolved by SGL_AssetManager::resolve() without any string lookups.
+ * Default constructed handles are invalid and make the renderer fall back to its own shaders.
+ */
+struct SGL_ShaderHandle
+{
+    static const std::uint16_t INVALID = 0xFFFF;
+
+    std::uint16_t index;         ///< Slot in the asset manager shader table
+    SHADER_TYPE shaderType;      ///< Cached so the renderer can validate it without resolving
+
+    SGL_ShaderHandle() : index(INVALID), shaderType(SHADER_TYPE::NO_SHADER) {}
+    bool valid() const noexcept { return index != INVALID; }
+};
 
 
 /**
@@ -63,11 +86,54 @@ class SGL_Shader
 {
 private:
     void checkForErrors(SGL_OpenGLManager &oglm, GLuint object, std::string type);
+
+    // Vertex and fragment stage locations of every uniform set on a pipeline, -1 where the stage
+    // doesn't declare it. Shared between copies, the stages of a pipeline never change
+    std::shared_ptr<std::map<std::string, std::pair<GLint, GLint>, std::less<>>> pStageLocations;
+
+    // Calls setter with the owning program and the uniform location, pipelines route it to every
+    // stage that declares the uniform. Setters may be stored until a pending program links, so
+    // they must capture by value
+    template <typename Setter>
+    void forEachUniform(SGL_OpenGLManager &oglm, const GLchar *name, Setter setter) const noexcept
+        {
+            if (this->pipeline == 0)
+            {
+                // Querying a program that's still linking blocks, the write is replayed once it links
+                if (oglm.programPending(this->ID))
+                {
+                    GLuint program = this->ID;
+                    oglm.deferProgramUniform(program, name, [=](GLint location) { setter(program, location); });
+                    return;
+                }
+                setter(this->ID, oglm.getUniformLocation(this->ID, name));
+                return;
+            }
+            auto cached = this->pStageLocations->find(name);
+            if (cached == this->pStageLocations->end())
+                cached = this->pStageLocations->emplace(name, std::make_pair(oglm.getUniformLocation(this->vertexStage, name),
+                                                                             oglm.getUniformLocation(this->fragmentStage, name))).first;
+            const GLuint stages[] = {this->vertexStage, this->fragmentStage};
+            const GLint locations[] = {cached->second.first, cached->second.second};
+            for (int i = 0; i < 2; ++i)
+            {
+                if (locations[i] < 0)
+                    continue;
+                // DSA writes straight to the stage program
+                if (!oglm.directStateAccessSupported())
+                    oglm.activeShaderProgram(this->pipeline, stages[i]);
+                setter(stages[i], locations[i]);
+            }
+        }
+
 public:
-    GLuint ID;                   ///< The shaders internal (OpenGL defined) ID
+    GLuint ID;                   ///< The shaders internal (OpenGL defined) ID, 0 for pipelines
     SHADER_TYPE shaderType;      ///< What the shader will be used to render
     RenderDetails renderDetails; ///< Extra rendering details
     std::string name;            ///< Shader's identifying (unique) name
+    GLuint pipeline;             ///< Program pipeline combining separable stages, 0 for monolithic programs
+    GLuint vertexStage;          ///< Pipeline vertex stage program
+    GLuint fragmentStage;        ///< Pipeline fragment stage program
 
     // Constructor
     SGL_Shader();
@@ -76,29 +142,46 @@ public:
 
     // Activates the shader
     SGL_Shader &use(SGL_OpenGLManager &oglm) noexcept;
+    const SGL_Shader &use(SGL_OpenGLManager &oglm) const noexcept;
     // Deactivates the shader
     void unbind(SGL_OpenGLManager &oglm) const noexcept;
     // Compiles, links, and enables the shader
     void compileShaders(SGL_OpenGLManager &oglm, SHADER_TYPE shaderType, const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource = nullptr) noexcept;
+    // Compiles the stages and starts linking without waiting on the driver, returns the stage shaders
+    std::vector<GLuint> submitShaders(SGL_OpenGLManager &oglm, SHADER_TYPE shaderType, const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource = nullptr) noexcept;
+    // Checks the compile and link status of submitShaders(), throws on error
+    void finishShaders(SGL_OpenGLManager &oglm, const std::vector<GLuint> &stages);
+    // Is the program done linking? Non blocking with KHR_parallel_shader_compile
+    bool linkCompleted(SGL_OpenGLManager &oglm) const noexcept;
+    // Compiles and links a compute program
+    void compileComputeShader(SGL_OpenGLManager &oglm, const GLchar *computeSource) noexcept;
+    // Creates the program from a driver binary, returns false if it was rejected
+    bool loadBinary(SGL_OpenGLManager &oglm, SHADER_TYPE shaderType, GLenum binaryFormat, const void *binary, GLsizei length) noexcept;
+    // Compiles a single stage separable program
+    void compileStage(SGL_OpenGLManager &oglm, GLenum stage, const GLchar *source) noexcept;
+    // Combines a vertex and a fragment stage into a program pipeline
+    void compilePipeline(SGL_OpenGLManager &oglm, SHADER_TYPE shaderType, const SGL_Shader &vertex, const SGL_Shader &fragment);
+    // Deletes the program, pipelines only delete the pipeline object since their stages are shaders of their own
+    void deleteProgram(SGL_OpenGLManager &oglm) noexcept;
 
     // Set a single float value
-    void setFloat(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat value, GLboolean useShader = false) noexcept;
+    void setFloat(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat value, GLboolean useShader = false) const noexcept;
     // Set a single integer value
-    void setInteger(SGL_OpenGLManager &oglm, const GLchar *name, GLint value, GLboolean useShader = false) noexcept;
+    void setInteger(SGL_OpenGLManager &oglm, const GLchar *name, GLint value, GLboolean useShader = false) const noexcept;
     // Set a 2D vector of floats
-    void setVector2f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLboolean useShader = false) noexcept;
+    void setVector2f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLboolean useShader = false) const noexcept;
     // Set a 2D vector of floats
-    void setVector2f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec2 value, GLboolean useShader = false) noexcept;
+    void setVector2f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec2 value, GLboolean useShader = false) const noexcept;
     // Set a 3D vector of floats
-    void setVector3f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLfloat z, GLboolean useShader = false) noexcept;
+    void setVector3f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLfloat z, GLboolean useShader = false) const noexcept;
     // Set a 3D vector of floats
-    void setVector3f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec3 value, GLboolean useShader = false) noexcept;
+    void setVector3f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec3 value, GLboolean useShader = false) const noexcept;
     // Set a 4D vector of floats
-    void setVector4f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w, GLboolean useShader = false) noexcept;
+    void setVector4f(SGL_OpenGLManager &oglm, const GLchar *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w, GLboolean useShader = false) const noexcept;
     // Set a 4D vector of floats
-    void setVector4f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec4 value, GLboolean useShader = false) noexcept;
+    void setVector4f(SGL_OpenGLManager &oglm, const GLchar *name, glm::vec4 value, GLboolean useShader = false) const noexcept;
     // Set a 4x4 matrix of floats
-    void setMatrix4(SGL_OpenGLManager &oglm, const GLchar *name, glm::mat4 matrix, GLboolean useShader = false) noexcept;
+    void setMatrix4(SGL_OpenGLManager &oglm, const GLchar *name, glm::mat4 matrix, GLboolean useShader = false) const noexcept;
 };
 
 
@@ -0,0 +1,354 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/renderer/SGL_SpriteLayer.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Retained sprite instance storage that lives on the GPU
+ *
+ * @section DESCRIPTION
+ *
+ * See SGL_SpriteLayer.hpp
+ */
+
+#include "SGL_SpriteLayer.hpp"
+
+/**
+ * @brief Constructor, allocates the GPU instance buffer
+ *
+ * @param oglm The window's OpenGL manager
+ * @param name Layer identifier, used to name its buffers
+ * @param capacity Maximum amount of instances the layer can hold
+ * @param gpuCulling Allocate the buffers used by the compute culling pass
+ * @return nothing
+ */
+SGL_SpriteLayer::SGL_SpriteLayer(std::shared_ptr<SGL_OpenGLManager> oglm, const std::string &name, std::uint32_t capacity, bool gpuCulling)
+    : WMOGLM(oglm), pName(name), pCapacity(capacity), pDrawCount(0), pActiveCount(0), pDirtyBegin(0), pDirtyEnd(0), pGPUCulling(gpuCulling)
+{
+    if (pCapacity == 0)
+        throw SGL_Exception("SGL_SpriteLayer::SGL_SpriteLayer | Layer capacity must be greater than 0.");
+
+    this->pVAO = "_SGL_SpriteLayer_" + pName + "_VAO";
+    this->pInstancesVBO = "_SGL_SpriteLayer_" + pName + "_instances_VBO";
+
+    pInstances.assign(pCapacity, glm::mat4(0.0f));
+    pActiveSlots.assign(pCapacity, false);
+    pFreeSlots.reserve(pCapacity);
+
+    WMOGLM->createVAO(this->pVAO);
+    WMOGLM->createVBO(this->pInstancesVBO);
+
+    // Allocate the whole layer once, it's only ever updated with bufferSubData afterwards
+    WMOGLM->bindVBO(this->pInstancesVBO);
+    WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(glm::mat4) * pCapacity, pInstances.data(), GL_DYNAMIC_DRAW);
+    WMOGLM->unbindVBO();
+
+    if (pGPUCulling)
+    {
+        this->pCulledVAO = "_SGL_SpriteLayer_" + pName + "_culled_VAO";
+        this->pVisibleVBO = "_SGL_SpriteLayer_" + pName + "_visible_VBO";
+        this->pCommandDIBO = "_SGL_SpriteLayer_" + pName + "_command_DIBO";
+        this->pGroupCountsSSBO = "_SGL_SpriteLayer_" + pName + "_group_counts_SSBO";
+        WMOGLM->createVAO(this->pCulledVAO);
+        WMOGLM->createVBO(this->pVisibleVBO);
+        WMOGLM->createVBO(this->pCommandDIBO);
+        WMOGLM->createVBO(this->pGroupCountsSSBO);
+
+        // Only ever written by the GPU
+        WMOGLM->bindVBO(this->pVisibleVBO);
+        WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(glm::mat4) * pCapacity, NULL, GL_DYNAMIC_COPY);
+        WMOGLM->bindVBO(this->pGroupCountsSSBO);
+        WMOGLM->bufferData(GL_ARRAY_BUFFER, sizeof(GLuint) * ((pCapacity + SGL_OGL_CONSTANTS::CULL_WORKGROUP_SIZE - 1) / SGL_OGL_CONSTANTS::CULL_WORKGROUP_SIZE),
+                           NULL, GL_DYNAMIC_COPY);
+        WMOGLM->unbindVBO();
+
+        SGL_DrawArraysIndirectCommand command = {6, 0, 0, 0};
+        WMOGLM->bindDIBO(this->pCommandDIBO);
+        WMOGLM->bufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(command), &command, GL_DYNAMIC_COPY);
+        WMOGLM->unbindDIBO();
+    }
+}
+
+/**
+ * @brief Destructor
+ *
+ * @return nothing
+ */
+SGL_SpriteLayer::~SGL_SpriteLayer()
+{
+    WMOGLM->deleteVAO(this->pVAO);
+    WMOGLM->deleteVBO(this->pInstancesVBO);
+    if (pGPUCulling)
+    {
+        WMOGLM->deleteVAO(this->pCulledVAO);
+        WMOGLM->deleteVBO(this->pVisibleVBO);
+        WMOGLM->deleteVBO(this->pCommandDIBO);
+        WMOGLM->deleteVBO(this->pGroupCountsSSBO);
+    }
+}
+
+/**
+ * @brief Extends the pending upload range
+ *
+ * @param slot Modified slot
+ * @return nothing
+ */
+void SGL_SpriteLayer::markDirty(std::uint32_t slot) noexcept
+{
+    if (pDirtyBegin == pDirtyEnd)
+    {
+        pDirtyBegin = slot;
+        pDirtyEnd = slot + 1;
+    }
+    else
+    {
+        pDirtyBegin = std::min(pDirtyBegin, slot);
+        pDirtyEnd = std::max(pDirtyEnd, slot + 1);
+    }
+}
+
+/**
+ * @brief Stores a new instance
+ *
+ * @param model The instance's model matrix
+ * @return std::uint32_t The slot assigned to the instance, stable until removed
+ */
+std::uint32_t SGL_SpriteLayer::add(const glm::mat4 &model)
+{
+    std::uint32_t slot;
+    if (!pFreeSlots.empty())
+    {
+        slot = pFreeSlots.back();
+        pFreeSlots.pop_back();
+    }
+    else if (pDrawCount < pCapacity)
+        slot = pDrawCount;
+    else
+        throw SGL_Exception(("SGL_SpriteLayer::add | Layer " + pName + " is full.").c_str());
+
+    pInstances[slot] = model;
+    pActiveSlots[slot] = true;
+    pActiveCount++;
+    pDrawCount = std::max(pDrawCount, slot + 1);
+    markDirty(slot);
+    return slot;
+}
+
+/**
+ * @brief Replaces the model matrix of an active slot
+ *
+ * @param slot Slot returned by add()
+ * @param model The new model matrix
+ * @return nothing
+ */
+void SGL_SpriteLayer::update(std::uint32_t slot, const glm::mat4 &model) noexcept
+{
+    if (slot >= pCapacity || !pActiveSlots[slot])
+    {
+        SGL_Log("SGL_SpriteLayer::update | Invalid slot: " + std::to_string(slot), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        return;
+    }
+    pInstances[slot] = model;
+    markDirty(slot);
+}
+
+/**
+ * @brief Frees a slot, the instance stops rendering after the next flush
+ *
+ * @param slot Slot returned by add()
+ * @return nothing
+ */
+void SGL_SpriteLayer::remove(std::uint32_t slot) noexcept
+{
+    if (slot >= pCapacity || !pActiveSlots[slot])
+        return;
+
+    // A zero matrix collapses the quad into a point, nothing gets rasterized
+    pInstances[slot] = glm::mat4(0.0f);
+    pActiveSlots[slot] = false;
+    pActiveCount--;
+    markDirty(slot);
+
+    // Shrink the draw range past any trailing free slots
+    while (pDrawCount > 0 && !pActiveSlots[pDrawCount - 1])
+        pDrawCount--;
+
+    // Keep the free list limited to slots inside the draw range, the rest are implicitly free
+    pFreeSlots.erase(std::remove_if(pFreeSlots.begin(), pFreeSlots.end(),
+                                    [this](std::uint32_t s) { return s >= pDrawCount; }), pFreeSlots.end());
+    if (slot < pDrawCount)
+        pFreeSlots.push_back(slot);
+}
+
+/**
+ * @brief Frees every slot
+ *
+ * @return nothing
+ */
+void SGL_SpriteLayer::clear() noexcept
+{
+    if (pDrawCount > 0)
+    {
+        std::fill(pInstances.begin(), pInstances.begin() + pDrawCount, glm::mat4(0.0f));
+        markDirty(0);
+        markDirty(pDrawCount - 1);
+    }
+    std::fill(pActiveSlots.begin(), pActiveSlots.end(), false);
+    pFreeSlots.clear();
+    pDrawCount = 0;
+    pActiveCount = 0;
+}
+
+/**
+ * @brief Uploads the modified range to the GPU, does nothing if the layer is clean
+ *
+ * @return nothing
+ */
+void SGL_SpriteLayer::flush() noexcept
+{
+    if (pDirtyBegin == pDirtyEnd)
+        return;
+
+    WMOGLM->namedBufferSubData(this->pInstancesVBO, sizeof(glm::mat4) * pDirtyBegin,
+                               sizeof(glm::mat4) * (pDirtyEnd - pDirtyBegin), &pInstances[pDirtyBegin]);
+
+    pDirtyBegin = pDirtyEnd = 0;
+}
+
+/**
+ * @brief Builds a model matrix the same way renderSprite() does
+ *
+ * @param position Sprite position
+ * @param size Sprite size
+ * @param rotation Rotation in radians
+ * @param rotationOrigin Rotation origin relative to the sprite position
+ * @return glm::mat4
+ */
+glm::mat4 SGL_SpriteLayer::modelMatrix(glm::vec2 position, glm::vec2 size, float rotation, glm::vec2 rotationOrigin) noexcept
+{
+    glm::mat4 model(1.0f);
+    model = glm::translate(model, glm::vec3(position, 0.0f));
+    model = glm::translate(model, glm::vec3(rotationOrigin.x, rotationOrigin.y, 0.0f));
+    model = glm::rotate(model, rotation, glm::vec3(0.0f, 0.0f, 1.0f));
+    model = glm::translate(model, glm::vec3(-rotationOrigin.x, -rotationOrigin.y, 0.0f));
+    model = glm::scale(model, glm::vec3(size, 1.0f));
+    return model;
+}
+
+/**
+ * @brief Are there changes pending upload?
+ * @return bool
+ */
+bool SGL_SpriteLayer::isDirty() const noexcept
+{
+    return pDirtyBegin != pDirtyEnd;
+}
+
+/**
+ * @brief Amount of instances to draw (highest active slot + 1)
+ * @return std::uint32_t
+ */
+std::uint32_t SGL_SpriteLayer::drawCount() const noexcept
+{
+    return pDrawCount;
+}
+
+/**
+ * @brief Amount of active instances
+ * @return std::uint32_t
+ */
+std::uint32_t SGL_SpriteLayer::size() const noexcept
+{
+    return pActiveCount;
+}
+
+/**
+ * @brief Maximum amount of instances
+ * @return std::uint32_t
+ */
+std::uint32_t SGL_SpriteLayer::capacity() const noexcept
+{
+    return pCapacity;
+}
+
+/**
+ * @brief Layer identifier
+ * @return std::string
+ */
+const std::string &SGL_SpriteLayer::getName() const noexcept
+{
+    return pName;
+}
+
+/**
+ * @brief Name of the layer's VAO
+ * @return std::string
+ */
+const std::string &SGL_SpriteLayer::getVAO() const noexcept
+{
+    return pVAO;
+}
+
+/**
+ * @brief Name of the layer's instance VBO
+ * @return std::string
+ */
+const std::string &SGL_SpriteLayer::getInstancesVBO() const noexcept
+{
+    return pInstancesVBO;
+}
+
+/**
+ * @brief Was the layer created with GPU culling?
+ * @return bool
+ */
+bool SGL_SpriteLayer::gpuCulling() const noexcept
+{
+    return pGPUCulling;
+}
+
+/**
+ * @brief Name of the VAO that sources the culled instances
+ * @return std::string
+ */
+const std::string &SGL_SpriteLayer::getCulledVAO() const noexcept
+{
+    return pCulledVAO;
+}
+
+/**
+ * @brief Name of the buffer the culling pass compacts visible instances into
+ * @return std::string
+ */
+const std::string &SGL_SpriteLayer::getVisibleVBO() const noexcept
+{
+    return pVisibleVBO;
+}
+
+/**
+ * @brief Name of the draw indirect buffer holding the culled instance count
+ * @return std::string
+ */
+const std::string &SGL_SpriteLayer::getCommandBuffer() const noexcept
+{
+    return pCommandDIBO;
+}
+
+/**
+ * @brief Name of the buffer holding the visible instances of each culling workgroup
+ * @return std::string
+ */
+const std::string &SGL_SpriteLayer::getGroupCountsBuffer() const noexcept
+{
+    return pGroupCountsSSBO;
+}
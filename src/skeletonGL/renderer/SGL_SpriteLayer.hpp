@@ -0,0 +1,117 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/renderer/SGL_SpriteLayer.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Retained sprite instance storage that lives on the GPU
+ *
+ * @section DESCRIPTION
+ *
+ * Unlike renderSpriteBatch(), which re-uploads every matrix each call, a sprite layer
+ * keeps its instances resident in a persistent VBO. Each instance owns a stable slot,
+ * changes are tracked as a dirty range and only that range is uploaded on flush().
+ */
+
+#ifndef SRC_SKELETONGL_RENDERER_SPRITELAYER_HPP
+#define SRC_SKELETONGL_RENDERER_SPRITELAYER_HPP
+
+// C++
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+// Dependencies
+#include "../deps/glm/glm.hpp"
+#include "../deps/glm/gtc/matrix_transform.hpp"
+// SkeletonGL
+#include "SGL_OpenGLManager.hpp"
+#include "../utility/SGL_Utility.hpp"
+
+/**
+ * @brief Persistent sprite instance buffer
+ * @section DESCRIPTION
+ *
+ * Slots are handed out by add() and stay valid until remove(), freed slots are
+ * recycled. Removed slots are overwritten with a zero matrix so they collapse
+ * into degenerate triangles instead of compacting the buffer. Created through
+ * SGL_Renderer::createSpriteLayer() and drawn with SGL_Renderer::renderSpriteLayer().
+ *
+ * Layers created with GPU culling also own a visible instance buffer and a draw
+ * indirect command, a compute pass fills both so culled layers never read back
+ * to the CPU. Visible instances keep their slot order.
+ */
+class SGL_SpriteLayer
+{
+private:
+    std::shared_ptr<SGL_OpenGLManager> WMOGLM;   ///< Window's OpenGL context
+    std::string pName;                           ///< Layer identifier
+    std::string pVAO, pInstancesVBO;             ///< Layer owned OpenGL buffers
+    std::uint32_t pCapacity;                     ///< Maximum amount of instances
+    std::vector<glm::mat4> pInstances;           ///< CPU mirror of the GPU instance buffer
+    std::vector<bool> pActiveSlots;              ///< Slot occupancy
+    std::vector<std::uint32_t> pFreeSlots;       ///< Recycled slots
+    std::uint32_t pDrawCount;                    ///< Highest active slot + 1
+    std::uint32_t pActiveCount;                  ///< Amount of occupied slots
+    std::uint32_t pDirtyBegin, pDirtyEnd;        ///< Pending upload range [begin, end)
+    bool pGPUCulling;                            ///< Owns the culling buffers
+    std::string pCulledVAO, pVisibleVBO;         ///< Compacted instances written by the culling pass
+    std::string pCommandDIBO;                    ///< Draw indirect command written by the culling pass
+    std::string pGroupCountsSSBO;                ///< Visible instances per culling workgroup, keeps the compaction in slot order
+
+    // Extend the dirty range to include the slot
+    void markDirty(std::uint32_t slot) noexcept;
+
+    // Disable all copy and move constructors
+    SGL_SpriteLayer(const SGL_SpriteLayer&) = delete;
+    SGL_SpriteLayer *operator = (const SGL_SpriteLayer&) = delete;
+    SGL_SpriteLayer(SGL_SpriteLayer &&) = delete;
+    SGL_SpriteLayer &operator = (SGL_SpriteLayer &&) = delete;
+
+public:
+    // Constructor
+    SGL_SpriteLayer(std::shared_ptr<SGL_OpenGLManager> oglm, const std::string &name, std::uint32_t capacity, bool gpuCulling = false);
+    // Destructor
+    ~SGL_SpriteLayer();
+
+    // Stores a new instance, returns its slot
+    std::uint32_t add(const glm::mat4 &model);
+    // Replaces the model matrix of an active slot
+    void update(std::uint32_t slot, const glm::mat4 &model) noexcept;
+    // Frees a slot
+    void remove(std::uint32_t slot) noexcept;
+    // Frees every slot
+    void clear() noexcept;
+    // Uploads the dirty range to the GPU
+    void flush() noexcept;
+
+    // Builds a model matrix the same way renderSprite() does
+    static glm::mat4 modelMatrix(glm::vec2 position, glm::vec2 size, float rotation = 0.0f, glm::vec2 rotationOrigin = glm::vec2(0.0f)) noexcept;
+
+    // Accessors
+    bool isDirty() const noexcept;
+    std::uint32_t drawCount() const noexcept;
+    std::uint32_t size() const noexcept;
+    std::uint32_t capacity() const noexcept;
+    const std::string &getName() const noexcept;
+    const std::string &getVAO() const noexcept;
+    const std::string &getInstancesVBO() const noexcept;
+    bool gpuCulling() const noexcept;
+    const std::string &getCulledVAO() const noexcept;
+    const std::string &getVisibleVBO() const noexcept;
+    const std::string &getCommandBuffer() const noexcept;
+    const std::string &getGroupCountsBuffer() const noexcept;
+};
+
+#endif // SRC_SKELETONGL_RENDERER_SPRITELAYER_HPP
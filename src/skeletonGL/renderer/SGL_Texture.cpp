@@ -66,10 +66,10 @@ void SGL_Texture::generate(SGL_OpenGLManager &oglm, GLuint width, GLuint height,
     oglm.bindTexture(GL_TEXTURE_2D, this->ID);
     oglm.texImage2D(GL_TEXTURE_2D, 0, this->internalFormat, width, height, 0, this->imageFormat, GL_UNSIGNED_BYTE, data);
     // Set texture wrap and filter modes
-    oglm.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, this->wrapS);
-    oglm.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, this->wrapT);
-    oglm.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, this->filterMin);
-    oglm.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, this->filterMax);
+    oglm.textureParameteri(this->ID, GL_TEXTURE_WRAP_S, this->wrapS);
+    oglm.textureParameteri(this->ID, GL_TEXTURE_WRAP_T, this->wrapT);
+    oglm.textureParameteri(this->ID, GL_TEXTURE_MIN_FILTER, this->filterMin);
+    oglm.textureParameteri(this->ID, GL_TEXTURE_MAG_FILTER, this->filterMax);
     // Unnbind it
     oglm.bindTexture(GL_TEXTURE_2D, 0);
 }
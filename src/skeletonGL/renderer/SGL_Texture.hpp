@@ -27,6 +27,7 @@
 
 // C++
 #include <string>
+#include <cstdint>
 // Dependencies
 #include <GL/glew.h>
 #include <SDL2/SDL.h>
@@ -34,6 +35,23 @@
 #include "SGL_OpenGLManager.hpp"
 
 
+/**
+ * @brief Lightweight reference to a texture owned by the SGL_AssetManager
+ * @section DESCRIPTION
+ *
+ * Trivially copyable, resolved by SGL_AssetManager::resolve(). Default constructed
+ * handles are invalid and make the renderer use its default texture.
+ */
+struct SGL_TextureHandle
+{
+    static const std::uint16_t INVALID = 0xFFFF;
+
+    std::uint16_t index;         ///< Slot in the asset manager texture table
+
+    SGL_TextureHandle() : index(INVALID) {}
+    bool valid() const noexcept { return index != INVALID; }
+};
+
 /**
  * @brief Defines an SGL_Texture to be used by a sprite
  */
@@ -0,0 +1,208 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/renderer/SGL_VertexLayout.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Compile time vertex and instance formats
+ *
+ * @section DESCRIPTION
+ *
+ * A vertex layout lists the attributes of a C++ struct in declaration order, the
+ * component counts, GL types, offsets and stride are all derived from the listed types
+ * and checked against the struct at compile time. apply() configures the current VAO
+ * with glVertexAttribFormat / glVertexAttribBinding, the buffer itself is attached to
+ * a binding point so the format never has to be repeated per buffer.
+ */
+
+#ifndef SRC_SKELETONGL_RENDERER_VERTEXLAYOUT_HPP
+#define SRC_SKELETONGL_RENDERER_VERTEXLAYOUT_HPP
+
+// C++
+#include <string>
+#include <tuple>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+// Dependencies
+#include <GL/glew.h>
+#include "../deps/glm/glm.hpp"
+// SkeletonGL
+#include "../utility/SGL_DataStructures.hpp"
+#include "SGL_OpenGLManager.hpp"
+
+/**
+ * @brief How a C++ type maps to a vertex attribute
+ * @section DESCRIPTION
+ *
+ * Matrices occupy one attribute location per column.
+ */
+template <typename T> struct SGL_AttribFormat;
+
+template <> struct SGL_AttribFormat<GLfloat>
+{
+    static constexpr GLint components = 1;
+    static constexpr GLenum type = GL_FLOAT;
+    static constexpr GLboolean normalized = GL_FALSE;
+    static constexpr GLuint locations = 1;
+};
+
+template <> struct SGL_AttribFormat<glm::vec2>
+{
+    static constexpr GLint components = 2;
+    static constexpr GLenum type = GL_FLOAT;
+    static constexpr GLboolean normalized = GL_FALSE;
+    static constexpr GLuint locations = 1;
+};
+
+template <> struct SGL_AttribFormat<glm::vec3>
+{
+    static constexpr GLint components = 3;
+    static constexpr GLenum type = GL_FLOAT;
+    static constexpr GLboolean normalized = GL_FALSE;
+    static constexpr GLuint locations = 1;
+};
+
+template <> struct SGL_AttribFormat<glm::vec4>
+{
+    static constexpr GLint components = 4;
+    static constexpr GLenum type = GL_FLOAT;
+    static constexpr GLboolean normalized = GL_FALSE;
+    static constexpr GLuint locations = 1;
+};
+
+template <> struct SGL_AttribFormat<glm::mat4>
+{
+    static constexpr GLint components = 4;
+    static constexpr GLenum type = GL_FLOAT;
+    static constexpr GLboolean normalized = GL_FALSE;
+    static constexpr GLuint locations = 4;
+};
+
+// Packed colors reach the shader as a normalized vec4
+template <> struct SGL_AttribFormat<SGL_Color8>
+{
+    static constexpr GLint components = 4;
+    static constexpr GLenum type = GL_UNSIGNED_BYTE;
+    static constexpr GLboolean normalized = GL_TRUE;
+    static constexpr GLuint locations = 1;
+};
+
+/**
+ * @brief A single attribute of a vertex layout
+ * @section DESCRIPTION
+ *
+ * Location must match the layout qualifier used by the shader.
+ */
+template <GLuint Location, typename T>
+struct SGL_Attrib
+{
+    typedef T type;
+    static constexpr GLuint location = Location;
+    static constexpr std::size_t size = sizeof(T);
+};
+
+/**
+ * @brief Byte offset of the attribute at index, the sum of the sizes listed before it
+ */
+template <typename... Attribs>
+constexpr std::size_t sglAttribOffset(std::size_t index) noexcept
+{
+    const std::size_t sizes[] = {0, Attribs::size...};
+    std::size_t total = 0;
+    for (std::size_t i = 1; i <= index; ++i)
+        total += sizes[i];
+    return total;
+}
+
+/**
+ * @brief Vertex or instance format of a C++ struct
+ * @section DESCRIPTION
+ *
+ * Attribs must be listed in the same order as the struct members. Divisor 0 advances per
+ * vertex, 1 per instance. A struct with padding or a missing attribute fails to compile.
+ */
+template <typename Vertex, GLuint Divisor, typename... Attribs>
+struct SGL_VertexLayout
+{
+    typedef Vertex vertex;
+    static constexpr GLsizei stride = sizeof(Vertex);
+    static constexpr GLuint divisor = Divisor;
+
+    static_assert(std::is_standard_layout<Vertex>::value, "SGL_VertexLayout | Vertex types must be standard layout");
+    static_assert(sglAttribOffset<Attribs...>(sizeof...(Attribs)) == sizeof(Vertex),
+                  "SGL_VertexLayout | Attributes don't cover the vertex struct (padding or missing attribute)");
+
+    // Byte offset of the attribute at index
+    static constexpr std::size_t offset(std::size_t index) noexcept
+        {
+            return sglAttribOffset<Attribs...>(index);
+        }
+
+    // Configure the bound VAO, attributes are sourced from vbo through the given binding point
+    static void apply(const SGL_OpenGLManager &oglm, GLuint binding, const std::string &vbo) noexcept
+        {
+            applyAttribs(oglm, binding, std::index_sequence_for<Attribs...>());
+            oglm.bindVertexBuffer(binding, vbo, 0, stride);
+            oglm.vertexBindingDivisor(binding, divisor);
+        }
+
+private:
+    template <std::size_t... I>
+    static void applyAttribs(const SGL_OpenGLManager &oglm, GLuint binding, std::index_sequence<I...>) noexcept
+        {
+            int expand[] = {0, (applyAttrib<typename std::tuple_element<I, std::tuple<Attribs...>>::type>(oglm, binding, offset(I)), 0)...};
+            (void)expand;
+        }
+
+    template <typename Attrib>
+    static void applyAttrib(const SGL_OpenGLManager &oglm, GLuint binding, std::size_t attribOffset) noexcept
+        {
+            typedef SGL_AttribFormat<typename Attrib::type> format;
+            const std::size_t locationSize = Attrib::size / format::locations;
+            for (GLuint i = 0; i < format::locations; ++i)
+            {
+                oglm.enableVertexAttribArray(Attrib::location + i);
+                oglm.vertexAttribFormat(Attrib::location + i, format::components, format::type, format::normalized,
+                                        static_cast<GLuint>(attribOffset + i * locationSize));
+                oglm.vertexAttribBinding(Attrib::location + i, binding);
+            }
+        }
+};
+
+// BUILT IN FORMATS
+// Vertex buffer binding points shared by every SkeletonGL VAO
+namespace SGL_VERTEX_BINDING
+{
+    const GLuint VERTICES = 0;                   ///< Per vertex geometry
+    const GLuint UVS = 1;                        ///< Per vertex texture coordinates
+    const GLuint INSTANCES = 2;                  ///< Per instance data
+}
+
+struct SGL_PositionVertex { glm::vec2 position; };
+struct SGL_UVVertex { glm::vec2 uv; };
+struct SGL_SpriteVertex { glm::vec2 position; glm::vec2 uv; };
+struct SGL_GlyphVertex { glm::vec4 positionUV; };
+struct SGL_SpriteInstance { glm::mat4 model; };
+struct SGL_PrimitiveInstance { glm::vec2 offset; };
+struct SGL_GlyphInstance { glm::vec4 rect; glm::vec4 uvRect; };
+
+typedef SGL_VertexLayout<SGL_PositionVertex, 0, SGL_Attrib<0, glm::vec2>> SGL_PositionLayout;
+typedef SGL_VertexLayout<SGL_UVVertex, 0, SGL_Attrib<1, glm::vec2>> SGL_UVLayout;
+typedef SGL_VertexLayout<SGL_SpriteVertex, 0, SGL_Attrib<0, glm::vec2>, SGL_Attrib<1, glm::vec2>> SGL_SpriteVertexLayout;
+typedef SGL_VertexLayout<SGL_GlyphVertex, 0, SGL_Attrib<0, glm::vec4>> SGL_GlyphLayout;
+typedef SGL_VertexLayout<SGL_SpriteInstance, 1, SGL_Attrib<3, glm::mat4>> SGL_SpriteInstanceLayout;
+typedef SGL_VertexLayout<SGL_PrimitiveInstance, 1, SGL_Attrib<3, glm::vec2>> SGL_PrimitiveInstanceLayout;
+typedef SGL_VertexLayout<SGL_GlyphInstance, 1, SGL_Attrib<3, glm::vec4>, SGL_Attrib<4, glm::vec4>> SGL_GlyphInstanceLayout;
+
+#endif // SRC_SKELETONGL_RENDERER_VERTEXLAYOUT_HPP
@@ -36,6 +36,8 @@
 #include "renderer/SGL_PostProcessor.hpp"
 #include "renderer/SGL_Shader.hpp"
 #include "renderer/SGL_Renderer.hpp"
+#include "renderer/SGL_SpriteLayer.hpp"
+#include "renderer/SGL_RenderLayer.hpp"
 #include "renderer/SGL_Texture.hpp"
 // Window management
 #include "window/SGL_Window.hpp"
@@ -27,12 +27,24 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <future>
 // SkeletonGL
 #include "SGL_AssetManager.hpp"
 // STB image
 #define STB_IMAGE_IMPLEMENTATION
 #include "../deps/stb_image.hpp"
 
+namespace
+{
+    // Bound while the real program links, every vertex lands outside the clip volume
+    const GLchar *PLACEHOLDER_VERTEX_SHADER =
+        "#version 330 core\n"
+        "void main() { gl_Position = vec4(2.0, 2.0, 2.0, 1.0); }\n";
+    const GLchar *PLACEHOLDER_FRAGMENT_SHADER =
+        "#version 330 core\n"
+        "out vec4 color;\n"
+        "void main() { color = vec4(0.0); }\n";
+}
 
 /**
  * @brief Main and only constructor
@@ -55,6 +67,50 @@ SGL_AssetManager::~SGL_AssetManager()
 
 }
 
+/**
+ * @brief Enables the on disk program binary cache, programs loaded afterwards are reused across runs
+ *
+ * @param directory Cache directory, created if needed
+ * @param deviceInfo Host details, used to invalidate the cache after driver changes
+ * @return nothing
+ */
+void SGL_AssetManager::enableProgramCache(const std::string &directory, const SGL_DeviceInfo &deviceInfo)
+{
+    if (!WMOGLM->programBinarySupported())
+    {
+        SGL_Log("Program binaries not supported, shaders will be compiled on every run", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_YELLOW);
+        return;
+    }
+    pProgramCache.reset(new SGL_ProgramCache(WMOGLM, directory, deviceInfo));
+}
+
+/**
+ * @brief Restores a program from the binary cache, compiles and stores it on a miss
+ *
+ * @param shader Receives the program
+ * @param shaderType What kind of shader is this?
+ * @param vertexCode Vertex shader source
+ * @param fragmentCode Fragment shader source
+ * @param geometryCode Geometry shader source, empty if the program has none
+ * @return nothing
+ */
+void SGL_AssetManager::compileProgram(SGL_Shader &shader, SHADER_TYPE shaderType, const std::string &vertexCode, const std::string &fragmentCode, const std::string &geometryCode)
+{
+    std::uint64_t key = 0;
+    if (pProgramCache)
+    {
+        key = pProgramCache->key({vertexCode, fragmentCode, geometryCode});
+        if (pProgramCache->load(key, shaderType, shader))
+            return;
+    }
+
+    shader.compileShaders(*WMOGLM, shaderType, vertexCode.c_str(), fragmentCode.c_str(),
+                          geometryCode.empty() ? nullptr : geometryCode.c_str());
+
+    if (pProgramCache)
+        pProgramCache->store(key, shader);
+}
+
 /**
  * @brief Compiles and links a shader program from the provided shader files
  *
@@ -65,7 +121,8 @@ SGL_AssetManager::~SGL_AssetManager()
  * @param shaderType What kind of shader is this?
  * @return SGL_Shader requested, if found
  */
-SGL_Shader SGL_AssetManager::loadShaders(const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource, std::string name, SHADER_TYPE shaderType)
+SGL_Shader SGL_AssetManager::loadShaders(const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource, std::string name, SHADER_TYPE shaderType,
+                                         const std::vector<std::string> &variantDefines)
 {
     if (shaders.count(name) > 0)
     {
@@ -76,9 +133,412 @@ SGL_Shader SGL_AssetManager::loadShaders(const GLchar *vertexSource, const GLcha
     {
         shaders[name] = loadShaderFromFile(shaderType, vertexSource, fragmentSource, geometrySource);
         shaders[name].name = name;
+        WMOGLM->objectLabel(GL_PROGRAM, shaders[name].ID, name);
         shaderTypes[name] = shaderType;
+
+        // Keep the sources, permutations are only compiled once requested
+        if (!variantDefines.empty())
+        {
+            if (variantDefines.size() > sizeof(SGL_VariantKey) * 8)
+                throw SGL_Exception(("SGL_AssetManager::loadShaders | Too many variant defines: " + name).c_str());
+
+            ShaderVariantSource &variants = pShaderVariants[name];
+            variants.vertex = readShaderFile(vertexSource);
+            variants.fragment = readShaderFile(fragmentSource);
+            if (geometrySource != nullptr)
+                variants.geometry = readShaderFile(geometrySource);
+            variants.shaderType = shaderType;
+            variants.defines = variantDefines;
+            variants.compiled[0] = name;
+        }
+        return shaders[name];
+    }
+}
+
+/**
+ * @brief Queues a shader program, nothing is read or compiled until compileQueuedShaders()
+ *
+ * @param vertexSource C string to the vertex shader file
+ * @param fragmentSource C string to the fragment shader file
+ * @param geometrySource C string to the geometry shader file (optional)
+ * @param name The shader program name as string
+ * @param shaderType What kind of shader is this?
+ * @param variantDefines Defines getShaderVariant() can compile in, see loadShaders()
+ * @return nothing
+ */
+void SGL_AssetManager::queueShaders(const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource, std::string name, SHADER_TYPE shaderType,
+                                    const std::vector<std::string> &variantDefines)
+{
+    if (variantDefines.size() > sizeof(SGL_VariantKey) * 8)
+        throw SGL_Exception(("SGL_AssetManager::queueShaders | Too many variant defines: " + name).c_str());
+
+    QueuedShader queued;
+    queued.vertex = vertexSource;
+    queued.fragment = fragmentSource;
+    queued.geometry = (geometrySource != nullptr) ? geometrySource : "";
+    queued.name = name;
+    queued.shaderType = shaderType;
+    queued.variantDefines = variantDefines;
+    pShaderQueue.push_back(queued);
+}
+
+/**
+ * @brief Reads a whole shader file, built-in shaders are read from the library itself
+ *
+ * @param path Shader file, empty paths are skipped
+ * @return std::string The file contents, empty if it couldn't be read
+ */
+std::string SGL_AssetManager::readShaderFile(const std::string &path)
+{
+    std::string contents;
+    if (!path.empty())
+        sglReadAsset(path, contents);
+    return contents;
+}
+
+/**
+ * @brief Loads every queued shader, the shaders are registered and usable once this returns
+ *
+ * @return nothing
+ *
+ * Source files are read concurrently, then every program is submitted before any status is
+ * queried so the driver never has to finish one program before starting the next. Without
+ * KHR_parallel_shader_compile the programs are checked right away, with it they keep compiling
+ * in the background: the OpenGL manager binds a placeholder program that renders nothing in
+ * their place and uniforms set on them are held back until pollPendingShaders() reports them ready.
+ */
+void SGL_AssetManager::compileQueuedShaders()
+{
+    std::vector<QueuedShader> queue;
+    queue.swap(pShaderQueue);
+
+    // File IO is the only part that can run off the GL thread
+    std::vector<std::future<std::string>> reads;
+    for (const QueuedShader &queued : queue)
+    {
+        reads.push_back(std::async(std::launch::async, readShaderFile, queued.vertex));
+        reads.push_back(std::async(std::launch::async, readShaderFile, queued.fragment));
+        reads.push_back(std::async(std::launch::async, readShaderFile, queued.geometry));
+    }
+
+    for (std::size_t i = 0; i < queue.size(); ++i)
+    {
+        const QueuedShader &queued = queue[i];
+        std::string vertexCode = reads[i * 3].get();
+        std::string fragmentCode = reads[i * 3 + 1].get();
+        std::string geometryCode = reads[i * 3 + 2].get();
+
+        if (shaders.count(queued.name) > 0)
+        {
+            SGL_Log("Shader already exists: " + queued.name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+            continue;
+        }
+        if (vertexCode.empty() || fragmentCode.empty() || (!queued.geometry.empty() && geometryCode.empty()))
+            throw SGL_Exception(("SGL_AssetManager::compileQueuedShaders | Failed to read shader files: " + queued.name).c_str());
+
+        SGL_Shader &shader = shaders[queued.name];
+        shader.name = queued.name;
+        shaderTypes[queued.name] = queued.shaderType;
+
+        if (!queued.variantDefines.empty())
+        {
+            ShaderVariantSource &variants = pShaderVariants[queued.name];
+            variants.vertex = vertexCode;
+            variants.fragment = fragmentCode;
+            variants.geometry = geometryCode;
+            variants.shaderType = queued.shaderType;
+            variants.defines = queued.variantDefines;
+            variants.compiled[0] = queued.name;
+        }
+
+        PendingShader pending;
+        pending.cacheKey = 0;
+        if (pProgramCache)
+        {
+            pending.cacheKey = pProgramCache->key({vertexCode, fragmentCode, geometryCode});
+            if (pProgramCache->load(pending.cacheKey, queued.shaderType, shader))
+            {
+                WMOGLM->objectLabel(GL_PROGRAM, shader.ID, queued.name);
+                continue;
+            }
+        }
+
+        SGL_Log("Submitting shader: " + queued.name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+        pending.stages = shader.submitShaders(*WMOGLM, queued.shaderType, vertexCode.c_str(), fragmentCode.c_str(),
+                                              geometryCode.empty() ? nullptr : geometryCode.c_str());
+        WMOGLM->objectLabel(GL_PROGRAM, shader.ID, queued.name);
+        pPendingShaders[queued.name] = pending;
+    }
+
+    if (!WMOGLM->parallelShaderCompileSupported())
+    {
+        // Everything is already submitted, the checks below only wait on the slowest program
+        this->finishPendingShaders();
+        return;
+    }
+
+    if (!pPendingShaders.empty() && pPlaceholderShader.ID == 0)
+        pPlaceholderShader.compileShaders(*WMOGLM, SHADER_TYPE::NO_SHADER, PLACEHOLDER_VERTEX_SHADER, PLACEHOLDER_FRAGMENT_SHADER);
+    for (auto &pending : pPendingShaders)
+        WMOGLM->setProgramPlaceholder(shaders.at(pending.first).ID, pPlaceholderShader.ID);
+    this->pollPendingShaders();
+}
+
+/**
+ * @brief Checks a pending shader, stores it in the program cache and stops replacing it
+ *
+ * @param name Shader name
+ * @param pending Its pending record
+ * @return nothing
+ */
+void SGL_AssetManager::finishPendingShader(const std::string &name, PendingShader &pending)
+{
+    SGL_Shader &shader = shaders.at(name);
+    try
+    {
+        shader.finishShaders(*WMOGLM, pending.stages);
+    }
+    catch (SGL_Exception &e)
+    {
+        WMOGLM->clearProgramPlaceholder(shader.ID, false);
+        SGL_Log(e.what());
+        throw SGL_Exception(("SGL_AssetManager::finishPendingShader | Error processing shader: " + name).c_str());
+    }
+    // Uniforms set while it was linking (projection included) are written now
+    WMOGLM->clearProgramPlaceholder(shader.ID, true);
+    if (pProgramCache)
+        pProgramCache->store(pending.cacheKey, shader);
+}
+
+/**
+ * @brief Checks the background compiles without blocking
+ *
+ * @return std::size_t Amount of shaders that became ready, the uniforms set on them while pending are already applied
+ */
+std::size_t SGL_AssetManager::pollPendingShaders()
+{
+    std::size_t ready = 0;
+    for (auto iter = pPendingShaders.begin(); iter != pPendingShaders.end();)
+    {
+        if (!shaders.at(iter->first).linkCompleted(*WMOGLM))
+        {
+            ++iter;
+            continue;
+        }
+        this->finishPendingShader(iter->first, iter->second);
+        iter = pPendingShaders.erase(iter);
+        ready++;
+    }
+    return ready;
+}
+
+/**
+ * @brief Deletes every shader program and program pipeline, variants and handles included
+ *
+ * @return nothing
+ *
+ * Pipelines go first, then every program including the stages they were built from. Shader
+ * handles and copies obtained before this call are no longer valid.
+ */
+void SGL_AssetManager::clearShaders()
+{
+    for (auto &pending : pPendingShaders)
+    {
+        WMOGLM->clearProgramPlaceholder(shaders.at(pending.first).ID, false);
+        for (GLuint stage : pending.second.stages)
+            WMOGLM->deleteShader(stage);
+    }
+    pPendingShaders.clear();
+
+    for (auto &shader : shaders)
+        if (shader.second.pipeline != 0)
+            shader.second.deleteProgram(*WMOGLM);
+    for (auto &shader : shaders)
+        shader.second.deleteProgram(*WMOGLM);
+    pPlaceholderShader.deleteProgram(*WMOGLM);
+
+    shaders.clear();
+    shaderTypes.clear();
+    pShaderVariants.clear();
+    pShaderTable.clear();
+    pShaderHandles.clear();
+    SGL_Log("Shader programs and pipelines deleted.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+}
+
+/**
+ * @brief Blocks until every pending shader is ready
+ *
+ * @return nothing
+ */
+void SGL_AssetManager::finishPendingShaders()
+{
+    for (auto &pending : pPendingShaders)
+        this->finishPendingShader(pending.first, pending.second);
+    pPendingShaders.clear();
+}
+
+/**
+ * @brief Are there shaders still compiling in the background?
+ * @return bool
+ */
+bool SGL_AssetManager::shadersPending() const noexcept
+{
+    return !pPendingShaders.empty();
+}
+
+/**
+ * @brief Inserts the defines selected by key right after the #version directive
+ *
+ * @param source Shader source
+ * @param key Variant bitmask
+ * @param defines Define enabled by each key bit
+ * @return std::string The specialized source
+ */
+std::string SGL_AssetManager::injectDefines(const std::string &source, SGL_VariantKey key, const std::vector<std::string> &defines)
+{
+    std::string block;
+    for (std::size_t i = 0; i < defines.size(); ++i)
+        if (key & (SGL_VariantKey(1) << i))
+            block += "#define " + defines[i] + "\n";
+
+    // #version must remain the first directive
+    std::size_t version = source.find("#version");
+    if (version == std::string::npos)
+        return block + source;
+    std::size_t lineEnd = source.find('\n', version);
+    if (lineEnd == std::string::npos)
+        return source + "\n" + block;
+    return source.substr(0, lineEnd + 1) + block + source.substr(lineEnd + 1);
+}
+
+/**
+ * @brief Returns a shader permutation, compiling and caching it the first time it's requested
+ *
+ * @param name Name of a shader loaded with variant defines
+ * @param key Bitmask of the defines to enable, 0 returns the base shader
+ * @return SGL_Shader The permutation, registered like any other shader so the camera updates it
+ *
+ * Permutations compiled after the camera mode was set receive the projection on the next
+ * SGL_Window::setCameraMode() call, request them during setup when possible.
+ */
+const SGL_Shader &SGL_AssetManager::getShaderVariant(const std::string &name, SGL_VariantKey key)
+{
+    auto variants = pShaderVariants.find(name);
+    if (variants == pShaderVariants.end())
+        throw SGL_Exception(("SGL_AssetManager::getShaderVariant | Shader has no variants: " + name).c_str());
+
+    ShaderVariantSource &source = variants->second;
+    auto cached = source.compiled.find(key);
+    if (cached != source.compiled.end())
+        return shaders.at(cached->second);
+
+    if (source.defines.size() < sizeof(SGL_VariantKey) * 8 && (key >> source.defines.size()) != 0)
+        throw SGL_Exception(("SGL_AssetManager::getShaderVariant | Invalid variant key for shader: " + name).c_str());
+
+    std::string variantName = name + "#" + std::to_string(key);
+    std::string vertexCode = injectDefines(source.vertex, key, source.defines);
+    std::string fragmentCode = injectDefines(source.fragment, key, source.defines);
+    std::string geometryCode = injectDefines(source.geometry, key, source.defines);
+
+    SGL_Log("Compiling shader variant: " + variantName, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    SGL_Shader &shader = shaders[variantName];
+    this->compileProgram(shader, source.shaderType, vertexCode, fragmentCode, source.geometry.empty() ? std::string() : geometryCode);
+    shader.name = variantName;
+    WMOGLM->objectLabel(GL_PROGRAM, shader.ID, variantName);
+    shaderTypes[variantName] = source.shaderType;
+    source.compiled[key] = variantName;
+    return shader;
+}
+
+/**
+ * @brief Load, compile and link a compute shader from its source file
+ *
+ * @param computeSource C string to the compute shader file
+ * @param name Name of the final shader program
+ * @return SGL_Shader The generated shader program
+ */
+SGL_Shader SGL_AssetManager::loadComputeShader(const GLchar *computeSource, std::string name)
+{
+    if (shaders.count(name) > 0)
+    {
+        SGL_Log("Shader already exists: " + name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
         return shaders[name];
     }
+
+    std::string computeCode;
+    if (!sglReadAsset(computeSource, computeCode))
+        throw SGL_Exception(("SGL_AssetManager::loadComputeShader | Failed to read shader file: " + std::string(computeSource)).c_str());
+
+    std::uint64_t key = 0;
+    if (pProgramCache)
+        key = pProgramCache->key({computeCode});
+    if (!pProgramCache || !pProgramCache->load(key, SHADER_TYPE::COMPUTE, shaders[name]))
+    {
+        SGL_Log("Compiling compute shader: " + std::string(computeSource), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+        shaders[name].compileComputeShader(*WMOGLM, computeCode.c_str());
+        if (pProgramCache)
+            pProgramCache->store(key, shaders[name]);
+    }
+    shaders[name].name = name;
+    WMOGLM->objectLabel(GL_PROGRAM, shaders[name].ID, name);
+    shaderTypes[name] = SHADER_TYPE::COMPUTE;
+    return shaders[name];
+}
+
+/**
+ * @brief Load and compile a single separable shader stage, requires OpenGL 4.1
+ *
+ * @param source C string to the stage shader file
+ * @param stage GL_VERTEX_SHADER or GL_FRAGMENT_SHADER
+ * @param name Name of the stage program
+ * @return SGL_Shader The stage program, not renderable until combined with loadShaderPipeline()
+ */
+SGL_Shader SGL_AssetManager::loadShaderStage(const GLchar *source, GLenum stage, std::string name)
+{
+    if (shaders.count(name) > 0)
+    {
+        SGL_Log("Shader already exists: " + name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+        return shaders[name];
+    }
+    if (!WMOGLM->separableProgramsSupported())
+        throw SGL_Exception("SGL_AssetManager::loadShaderStage | Separable shader programs are not supported.");
+
+    std::string stageCode;
+    if (!sglReadAsset(source, stageCode))
+        throw SGL_Exception(("SGL_AssetManager::loadShaderStage | Failed to read shader file: " + std::string(source)).c_str());
+
+    SGL_Log("Compiling shader stage: " + std::string(source), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    shaders[name].compileStage(*WMOGLM, stage, stageCode.c_str());
+    shaders[name].name = name;
+    WMOGLM->objectLabel(GL_PROGRAM, shaders[name].ID, name);
+    // Stages receive the camera projection directly, pipelines built from them don't need to
+    shaderTypes[name] = SHADER_TYPE::NO_SHADER;
+    return shaders[name];
+}
+
+/**
+ * @brief Combine two loaded shader stages into a program pipeline
+ *
+ * @param vertexStage Name of a vertex stage loaded with loadShaderStage()
+ * @param fragmentStage Name of a fragment stage loaded with loadShaderStage()
+ * @param name Name of the pipeline
+ * @param shaderType What kind of shader is this?
+ * @return SGL_Shader The pipeline, used like any other shader
+ */
+SGL_Shader SGL_AssetManager::loadShaderPipeline(const std::string &vertexStage, const std::string &fragmentStage, std::string name, SHADER_TYPE shaderType)
+{
+    if (shaders.count(name) > 0)
+    {
+        SGL_Log("Shader already exists: " + name, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+        return shaders[name];
+    }
+
+    SGL_Shader pipeline;
+    pipeline.compilePipeline(*WMOGLM, shaderType, this->getShader(vertexStage), this->getShader(fragmentStage));
+    pipeline.name = name;
+    shaders[name] = pipeline;
+    shaderTypes[name] = shaderType;
+    return shaders[name];
 }
 
 /**
@@ -97,6 +557,73 @@ SGL_Shader SGL_AssetManager::getShader(std::string name) const
 }
 
 
+/**
+ * @brief Returns a handle to a loaded shader, the handle stays valid for the asset manager's lifetime
+ *
+ * @param name Name of the shader
+ * @return SGL_ShaderHandle
+ */
+SGL_ShaderHandle SGL_AssetManager::getShaderHandle(const std::string &name)
+{
+    SGL_ShaderHandle handle;
+    auto slot = pShaderHandles.find(name);
+    if (slot != pShaderHandles.end())
+        handle.index = slot->second;
+    else
+    {
+        if (pShaderTable.size() >= SGL_ShaderHandle::INVALID)
+            throw SGL_Exception("SGL_AssetManager::getShaderHandle | Shader table is full");
+        pShaderTable.push_back(this->getShader(name));
+        handle.index = pShaderTable.size() - 1;
+        pShaderHandles[name] = handle.index;
+    }
+    handle.shaderType = pShaderTable[handle.index].shaderType;
+    return handle;
+}
+
+/**
+ * @brief Returns a handle to a loaded texture, the handle stays valid for the asset manager's lifetime
+ *
+ * @param name Name of the texture
+ * @return SGL_TextureHandle Invalid if the texture doesn't exist, renderers replace it with their default texture
+ */
+SGL_TextureHandle SGL_AssetManager::getTextureHandle(const std::string &name)
+{
+    SGL_TextureHandle handle;
+    auto slot = pTextureHandles.find(name);
+    if (slot != pTextureHandles.end())
+        handle.index = slot->second;
+    else if (textures.count(name) > 0 && pTextureTable.size() < SGL_TextureHandle::INVALID)
+    {
+        pTextureTable.push_back(textures.at(name));
+        handle.index = pTextureTable.size() - 1;
+        pTextureHandles[name] = handle.index;
+    }
+    return handle;
+}
+
+/**
+ * @brief Resolves a shader handle
+ *
+ * @param handle Valid handle returned by getShaderHandle()
+ * @return SGL_Shader
+ */
+const SGL_Shader &SGL_AssetManager::resolve(SGL_ShaderHandle handle) const
+{
+    return pShaderTable.at(handle.index);
+}
+
+/**
+ * @brief Resolves a texture handle
+ *
+ * @param handle Valid handle returned by getTextureHandle()
+ * @return SGL_Texture
+ */
+const SGL_Texture &SGL_AssetManager::resolve(SGL_TextureHandle handle) const
+{
+    return pTextureTable.at(handle.index);
+}
+
 /**
  * @brief Load a texture from a supported iamge file and generate an OpenGL texture
  *
@@ -151,32 +678,12 @@ SGL_Shader SGL_AssetManager::loadShaderFromFile(SHADER_TYPE shaderType, const GL
     std::string geometryCode;
 
 
-    try
-    {
-        // Open that shit up
-        std::ifstream vertexShaderFile(vertexSource);
-        std::ifstream fragmentShaderFile(fragmentSource);
-        std::stringstream vertexStream, fragmentStream;
-        // Read file buffer contents into the streams
-        vertexStream << vertexShaderFile.rdbuf();
-        fragmentStream << fragmentShaderFile.rdbuf();
-        // Close file handlers
-        vertexShaderFile.close();
-        fragmentShaderFile.close();
-        // Convert stream into string
-        vertexCode = vertexStream.str();
-        fragmentCode = fragmentStream.str();
-        // If geometry shader is present, load it
-        if(geometrySource != nullptr)
-        {
-            std::ifstream geometryShaderFile(geometrySource);
-            std::stringstream geometryStream;
-            geometryStream << geometryShaderFile.rdbuf();
-            geometryShaderFile.close();
-            geometryCode = geometryStream.str();
-        }
-    }
-    catch(std::exception e)
+    // Built-in shaders come from the library, everything else from disk
+    bool read = sglReadAsset(vertexSource, vertexCode) && sglReadAsset(fragmentSource, fragmentCode);
+    // If geometry shader is present, load it
+    if (read && geometrySource != nullptr)
+        read = sglReadAsset(geometrySource, geometryCode);
+    if (!read)
     {
         SGL_Log("ERROR::SHADER: Failed to read shader files:\n", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
         SGL_Log("Vertex: " + std::string(vertexSource), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
@@ -184,25 +691,16 @@ SGL_Shader SGL_AssetManager::loadShaderFromFile(SHADER_TYPE shaderType, const GL
         if (geometrySource != nullptr)
             SGL_Log("Geometry: " + std::string(geometrySource), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
     }
-    const GLchar *vShaderSource = vertexCode.c_str();
-    const GLchar *fShaderSource = fragmentCode.c_str();
-    const GLchar *gShaderSource = geometryCode.c_str();
-    // Create shader object from source code
+    // Create shader object from source code, or from the cached binary
     SGL_Shader shader;
-    SGL_Log("Compiling vertex shader: " + std::string(vertexSource), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
-    SGL_Log("Compiling fragment shader: " + std::string(fragmentSource), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    SGL_Log("Loading vertex shader: " + std::string(vertexSource), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    SGL_Log("Loading fragment shader: " + std::string(fragmentSource), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    if (geometrySource != nullptr)
+        SGL_Log("Loading geometry shader: " + std::string(geometrySource), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
 
     try
     {
-        if (geometrySource != nullptr)
-        {
-            SGL_Log("Compiling geometry shader: " + std::string(geometrySource), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
-            shader.compileShaders(*WMOGLM, shaderType, vShaderSource, fShaderSource, gShaderSource);
-        }
-        else
-        {
-            shader.compileShaders(*WMOGLM, shaderType, vShaderSource, fShaderSource, nullptr);
-        }
+        this->compileProgram(shader, shaderType, vertexCode, fragmentCode, geometryCode);
     }
     catch (SGL_Exception &e)
     {
@@ -238,7 +736,11 @@ SGL_Texture SGL_AssetManager::loadTextureFromFile(const GLchar *file, GLboolean
     //load image
     int width, height, channels;
     stbi_set_flip_vertically_on_load(true); // tell stb_image.h to flip loaded texture's on the y-axis.
-    unsigned char *image = stbi_load(file, &width, &height, &channels, 0);
+    // The default textures are embedded in the library
+    const SGL_EmbeddedAsset *embedded = sglEmbeddedAsset(file);
+    unsigned char *image = (embedded != nullptr) ?
+        stbi_load_from_memory(embedded->data, static_cast<int>(embedded->size), &width, &height, &channels, 0) :
+        stbi_load(file, &width, &height, &channels, 0);
     if (image == NULL)
     {
         SGL_Log("Texture not found: " + std::string(file));
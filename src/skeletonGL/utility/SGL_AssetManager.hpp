@@ -28,6 +28,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <cstdint>
 #include <memory>
 // SkeletonGL
 #include "../renderer/SGL_OpenGLManager.hpp"
@@ -35,6 +36,13 @@
 #include "../renderer/SGL_Shader.hpp"
 #include "SGL_DataStructures.hpp"
 #include "SGL_Utility.hpp"
+#include "SGL_ProgramCache.hpp"
+#include "SGL_EmbeddedAssets.hpp"
+
+/**
+ * @brief Bitmask that selects a shader permutation, bit i enables the i-th define the shader was loaded with
+ */
+typedef std::uint32_t SGL_VariantKey;
 
 /**
  *  @brief Manages all rendering resources
@@ -46,6 +54,56 @@ private:
     std::map<std::string, SGL_Shader> shaders;                    ///< Map of all available shaders
     std::map<std::string, SGL_Texture> textures;                  ///< Map of all available textures
     std::uint64_t pTextureGPUMemory;                              ///< How much GPU memory the program is using
+    std::vector<SGL_Shader> pShaderTable;                         ///< Shaders addressed by SGL_ShaderHandle
+    std::vector<SGL_Texture> pTextureTable;                       ///< Textures addressed by SGL_TextureHandle
+    std::map<std::string, std::uint16_t> pShaderHandles;          ///< Name to shader table slot
+    std::map<std::string, std::uint16_t> pTextureHandles;         ///< Name to texture table slot
+
+    /**
+     * @brief Sources kept around to compile permutations on demand
+     */
+    struct ShaderVariantSource
+    {
+        std::string vertex, fragment, geometry;                   ///< Unmodified sources
+        SHADER_TYPE shaderType;                                   ///< Type shared by every permutation
+        std::vector<std::string> defines;                         ///< Define enabled by each key bit
+        std::map<SGL_VariantKey, std::string> compiled;           ///< Key to cached permutation name
+    };
+    std::map<std::string, ShaderVariantSource> pShaderVariants;   ///< Base shader name to its permutations
+    std::unique_ptr<SGL_ProgramCache> pProgramCache;              ///< Program binary cache, null when disabled
+
+    /**
+     * @brief Shader program waiting in the compile queue
+     */
+    struct QueuedShader
+    {
+        std::string vertex, fragment, geometry;                   ///< Source file paths, geometry is optional
+        std::string name;                                         ///< Shader's identifying name
+        SHADER_TYPE shaderType;                                   ///< What the shader will be used to render
+        std::vector<std::string> variantDefines;                  ///< Forwarded to the variant sources
+    };
+    /**
+     * @brief Program submitted to the driver that hasn't been checked yet
+     */
+    struct PendingShader
+    {
+        std::vector<GLuint> stages;                               ///< Stage shaders, deleted once the program is checked
+        std::uint64_t cacheKey;                                   ///< Program cache key, stored once linked
+    };
+    std::vector<QueuedShader> pShaderQueue;                       ///< Shaders loaded by compileQueuedShaders()
+    std::map<std::string, PendingShader> pPendingShaders;         ///< Shaders still compiling in the background
+    SGL_Shader pPlaceholderShader;                                ///< Bound in place of pending shaders, renders nothing
+
+    // Reads a whole shader file, an unreadable file yields an empty string
+    static std::string readShaderFile(const std::string &path);
+    // Checks a pending shader, stores it in the program cache and stops replacing it
+    void finishPendingShader(const std::string &name, PendingShader &pending);
+
+    // Inserts the defines selected by key right after the #version directive
+    static std::string injectDefines(const std::string &source, SGL_VariantKey key, const std::vector<std::string> &defines);
+
+    // Restores the program from the binary cache or compiles it from source, an empty geometry source is skipped
+    void compileProgram(SGL_Shader &shader, SHADER_TYPE shaderType, const std::string &vertexCode, const std::string &fragmentCode, const std::string &geometryCode);
 
     // Parses, compiles and links a shader, geometry shader is optional
     SGL_Shader loadShaderFromFile(SHADER_TYPE shaderType, const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource = nullptr);
@@ -58,8 +116,33 @@ public:
     // Destructor
     ~SGL_AssetManager();
 
-    //loads and generates a shader program from a source file
-    SGL_Shader loadShaders(const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource, std::string name, SHADER_TYPE shaderType);
+    // Reuse linked program binaries across runs, requires OpenGL 4.1 or ARB_get_program_binary
+    void enableProgramCache(const std::string &directory, const SGL_DeviceInfo &deviceInfo);
+
+    //loads and generates a shader program from a source file, variantDefines lists the
+    //defines getShaderVariant() can compile in, in key bit order
+    SGL_Shader loadShaders(const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource, std::string name, SHADER_TYPE shaderType,
+                           const std::vector<std::string> &variantDefines = std::vector<std::string>());
+    // Queues a shader program, nothing is read or compiled until compileQueuedShaders()
+    void queueShaders(const GLchar *vertexSource, const GLchar *fragmentSource, const GLchar *geometrySource, std::string name, SHADER_TYPE shaderType,
+                      const std::vector<std::string> &variantDefines = std::vector<std::string>());
+    // Reads the queued sources concurrently and submits every program before checking any of them,
+    // with KHR_parallel_shader_compile the programs finish in the background behind a placeholder
+    void compileQueuedShaders();
+    // Checks the background compiles without blocking, returns how many shaders became ready
+    std::size_t pollPendingShaders();
+    // Blocks until every pending shader is ready
+    void finishPendingShaders();
+    // Are there shaders still compiling in the background?
+    bool shadersPending() const noexcept;
+    // Deletes every shader program and pipeline, must run while the OpenGL context is alive
+    void clearShaders();
+    //loads and generates a compute program from a source file
+    SGL_Shader loadComputeShader(const GLchar *computeSource, std::string name);
+    //loads and compiles a single separable shader stage (GL_VERTEX_SHADER / GL_FRAGMENT_SHADER)
+    SGL_Shader loadShaderStage(const GLchar *source, GLenum stage, std::string name);
+    //combines two previously loaded stages into a program pipeline, no new compilation
+    SGL_Shader loadShaderPipeline(const std::string &vertexStage, const std::string &fragmentStage, std::string name, SHADER_TYPE shaderType);
     //loads and generates a texture from a file, throws SGL_Exception if shit happens
     SGL_Texture loadTexture(const GLchar *file, GLboolean alpha, std::string name);
 
@@ -69,6 +152,16 @@ public:
     SGL_Shader getShader(std::string name) const;
     //finds and retrieves a stored texture
     SGL_Texture getTexture(std::string name) const;
+    // Finds or compiles the permutation of a shader loaded with variant defines, key 0 is the base shader
+    const SGL_Shader &getShaderVariant(const std::string &name, SGL_VariantKey key);
+
+    // Handles: resolve a name once, then render with the handle, resolve() is a plain table index
+    // Throws if the shader doesn't exist
+    SGL_ShaderHandle getShaderHandle(const std::string &name);
+    // Returns an invalid handle (renderer default texture) if the texture doesn't exist
+    SGL_TextureHandle getTextureHandle(const std::string &name);
+    const SGL_Shader &resolve(SGL_ShaderHandle handle) const;
+    const SGL_Texture &resolve(SGL_TextureHandle handle) const;
 
     // This map contains an accessible container
     // with all the loaded shaders and their respective
@@ -26,6 +26,7 @@
 
 // C++
 #include <string>
+#include <cstdint>
 // SDL2
 #include <SDL2/SDL.h>
 // GLEW
@@ -70,6 +71,16 @@ namespace SGL_OGL_CONSTANTS
     const std::uint32_t MAX_SPRITE_BATCH_INSTANCES = 10000;
     const std::uint32_t MAX_PIXEL_BATCH_INSTANCES = 10000;
     const std::uint32_t MAX_LINE_BATCH_INSTANCES = 10000;
+    const std::uint32_t MAX_TEXT_BATCH_GLYPHS = 4096;
+
+    // Maximum amount of batches queued for multi-draw indirect submission before an automatic flush
+    const std::uint32_t MAX_INDIRECT_BATCHES = 1024;
+
+    // Instances tested by each workgroup of the culling pass, MUST MATCH local_size_x in cullInstancesC.c
+    const std::uint32_t CULL_WORKGROUP_SIZE = 64;
+
+    // GPU timer queries are read this many frames after they were issued so reading them never stalls
+    const std::uint32_t GPU_TIMER_LATENCY = 4;
 };
 
 
@@ -89,6 +100,8 @@ namespace FOLDER_STRUCTURE
     const std::string defaultFont = fontsDir + "defaultFont.ttf";
     const std::string defaultTexture = imagesDir + "defaultTexture.png";
     const std::string defaultDebugLog = rootDir + ".debugLog.txt";
+    const std::string shaderCacheDir = rootDir + ".shaderCache/";
+    const std::string hitchDir = rootDir + "hitches/";
 }
 
 /**
@@ -123,7 +136,20 @@ struct WindowCreationSpecs
 {
     bool fullScreen, enableVSYNC;               ///< Enable fullscreen, VSYNC at startup
     bool activeVSYNC;                           ///< Actual VSYNC status
-    bool showFPS;                               ///< Honored by the user, stored here for ez .ini file access
+    bool showFPS;                               ///< Append the frame statistics to the window title
+    double frameBudgetMs;                       ///< Frames longer than this count as over budget, 0 allows 1.5 refresh periods
+    bool idleFrameSkip;                         ///< Skip presenting frames identical to the previous one
+    int framesInFlight;                         ///< Maximum frames the CPU may queue ahead of the GPU
+    bool glDebug;                               ///< Create a debug context and report KHR_debug messages
+    GLenum glDebugSeverity;                     ///< Least severe debug message reported
+    bool gpuTimers;                             ///< Time render passes with GPU timer queries
+    bool statsOverlay;                          ///< Draw the frame counters over the scene
+    bool cpuTrace;                              ///< Record SGL_TRACE_ZONE scopes
+    double hitchThresholdMs;                    ///< Frames longer than this dump the flight recorder, 0 disables it
+    double hitchHistory;                        ///< Seconds of history the flight recorder keeps
+    std::string hitchDir;                       ///< Where the flight recorder writes its dumps
+    bool overdraw;                              ///< Render the overdraw heatmap instead of the scene
+    int refreshRate;                            ///< Refresh rate of the active display (Hz)
     bool cursorVisibility;                      ///< Toggles the system cursor on and off
     int displayID;                              ///< Helps when debugging on multiple displays
     std::string windowTitle;                    ///< The title of the window
@@ -136,11 +162,13 @@ struct WindowCreationSpecs
     int fullscreenW, fullscreenH;               ///< Default full screen resolution
     int gamepad1;                               ///< Available gamepad slots
     std::string iniFile;                        ///< Path to the config ini file (might want to rename the file like the executable)
-    WindowCreationSpecs() : currentX(0), currentY(0), currentW(0), currentH(0), internalW(0), internalH(0),
-                            windowPosX(SDL_WINDOWPOS_UNDEFINED), windowPosY(SDL_WINDOWPOS_UNDEFINED),
-                            enableVSYNC(true), fullScreen(false), minW(640), minH(360), maxW(1920),
-                            maxH(1080), fullscreenW(1920), fullscreenH(1080), windowTitle(""), showFPS(false),
-                            cursorVisibility(true), activeVSYNC(false), displayID(-1), iniFile("config.ini") {}
+    WindowCreationSpecs() : fullScreen(false), enableVSYNC(true), activeVSYNC(false), showFPS(false), frameBudgetMs(0.0), idleFrameSkip(false),
+                            framesInFlight(2), glDebug(false), glDebugSeverity(GL_DEBUG_SEVERITY_MEDIUM), gpuTimers(false),
+                            statsOverlay(false), cpuTrace(false), hitchThresholdMs(0.0), hitchHistory(5.0),
+                            hitchDir(FOLDER_STRUCTURE::hitchDir), overdraw(false), refreshRate(60), cursorVisibility(true),
+                            displayID(-1), windowTitle(""), windowPosX(SDL_WINDOWPOS_UNDEFINED), windowPosY(SDL_WINDOWPOS_UNDEFINED),
+                            minW(640), minH(360), maxW(1920), maxH(1080), currentX(0), currentY(0), currentW(0), currentH(0),
+                            internalW(0), internalH(0), fullscreenW(1920), fullscreenH(1080), iniFile("config.ini") {}
 };
 
 /**
@@ -170,6 +198,24 @@ struct SGL_Color
         }
 };
 
+/**
+ * @brief 8 bits per channel color, used by the lightweight renderables
+ */
+struct SGL_Color8
+{
+    std::uint8_t r, g, b, a; ///< min 0 to max 255
+    SGL_Color8() : r(255), g(255), b(255), a(255) {}
+    SGL_Color8(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a) : r(r), g(g), b(b), a(a) {}
+    SGL_Color8(const SGL_Color &color)
+        : r(glm::clamp(color.r, 0.0f, 1.0f) * 255.0f + 0.5f), g(glm::clamp(color.g, 0.0f, 1.0f) * 255.0f + 0.5f),
+          b(glm::clamp(color.b, 0.0f, 1.0f) * 255.0f + 0.5f), a(glm::clamp(color.a, 0.0f, 1.0f) * 255.0f + 0.5f) {}
+    // Normalized values as expected by the shaders
+    glm::vec4 normalized() const noexcept
+        {
+            return glm::vec4(r, g, b, a) / 255.0f;
+        }
+};
+
 /**
  * @brief Represents a single keystate
  */
@@ -247,6 +293,64 @@ struct SGL_FrameData
 };
 
 
+/**
+ * @brief SGL function whose GL calls are being issued, reported by the debug output
+ */
+struct SGL_DebugCallSite
+{
+    const char *function;
+    const char *file;
+    int line;
+};
+
+/**
+ * @brief GPU time spent inside a timed scope, averaged over the frames that entered it
+ */
+struct SGL_GPUTimerStats
+{
+    std::string name;                         ///< Scope name
+    std::uint64_t frames;                     ///< Frames that entered the scope at least once
+    std::uint64_t calls;                      ///< Times the scope was entered
+    double averageMs;                         ///< Mean GPU time per frame
+    double lastMs;                            ///< GPU time of the latest frame read back
+    double maxMs;                             ///< Worst frame
+};
+
+/**
+ * @brief Work issued through the OpenGL manager during one frame, value initialize to clear it
+ */
+struct SGL_FrameCounters
+{
+    std::uint32_t drawCalls;                  ///< Every glDraw* call, a multi-draw counts once
+    std::uint32_t instancedDraws;             ///< Draw calls that submitted instances
+    std::uint64_t instances;                  ///< Instances submitted by the instanced draws
+    std::uint32_t indirectDraws;              ///< Commands read from a draw indirect buffer
+    std::uint32_t dispatches;                 ///< Compute dispatches
+    std::uint32_t programSwitches;            ///< glUseProgram / glBindProgramPipeline
+    std::uint32_t textureBinds;               ///< glBindTexture
+    std::uint32_t fboBinds;                   ///< Framebuffer binds and unbinds
+    std::uint32_t bufferBinds;                ///< VBO, EBO, draw indirect and storage buffer binds
+    std::uint32_t vaoBinds;                   ///< glBindVertexArray
+    std::uint32_t blendChanges;               ///< Blending mode changes
+    std::uint32_t capabilityChanges;          ///< glEnable / glDisable
+    std::uint32_t uniformUpdates;             ///< glUniform* / glProgramUniform*
+    std::uint32_t viewportChanges;            ///< glViewport
+    std::uint64_t bytesUploaded;              ///< Buffer and texture data handed to GL, mapped ranges included
+};
+
+/**
+ * @brief Fragments written per pixel, measured by the post processor's overdraw view
+ */
+struct SGL_OverdrawStats
+{
+    double average;                           ///< Fragments per pixel over the whole target
+    std::uint32_t max;                        ///< Fragments written to the most covered pixel
+    std::uint64_t fragments;                  ///< Fragments written to the target
+    std::uint32_t width, height;              ///< Target dimensions
+    std::uint64_t frame;                      ///< Readbacks completed, the first few frames after enabling are empty
+    SGL_OverdrawStats() : average(0.0), max(0), fragments(0), width(0), height(0), frame(0) {}
+};
+
 /**
  * @brief Represents an OpenGL buffer
  */
@@ -257,6 +361,29 @@ struct GLBuffer
     GLBuffer() : name(""), ID(0) {}
 };
 
+/**
+ * @brief Command layout read by glMultiDrawArraysIndirect from the GL_DRAW_INDIRECT_BUFFER
+ */
+struct SGL_DrawArraysIndirectCommand
+{
+    GLuint count;                               ///< Vertices per instance
+    GLuint instanceCount;                       ///< Amount of instances
+    GLuint first;                               ///< First vertex in the shared vertex buffer
+    GLuint baseInstance;                        ///< First instance in the shared instance buffer
+};
+
+/**
+ * @brief Command layout read by glMultiDrawElementsIndirect from the GL_DRAW_INDIRECT_BUFFER
+ */
+struct SGL_DrawElementsIndirectCommand
+{
+    GLuint count;                               ///< Indices per instance
+    GLuint instanceCount;                       ///< Amount of instances
+    GLuint firstIndex;                          ///< First index in the shared element buffer
+    GLint baseVertex;                           ///< Added to every index
+    GLuint baseInstance;                        ///< First instance in the shared instance buffer
+};
+
 /**
  * @brief Represents an OpenGL setting
  */
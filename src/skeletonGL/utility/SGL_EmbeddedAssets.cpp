@@ -0,0 +1,84 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_EmbeddedAssets.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Engine assets compiled into the library
+ *
+ * @section DESCRIPTION
+ *
+ * See SGL_EmbeddedAssets.hpp
+ */
+
+// C++
+#include <fstream>
+#include <sstream>
+// SkeletonGL
+#include "SGL_EmbeddedAssets.hpp"
+
+namespace
+{
+    // "./" prefixes and repeated slashes don't change what file a path points to
+    std::string normalizeAssetPath(const std::string &path)
+    {
+        std::string normalized;
+        normalized.reserve(path.size());
+        for (char c : path)
+            if (c != '/' || normalized.empty() || normalized.back() != '/')
+                normalized += c;
+        while (normalized.compare(0, 2, "./") == 0)
+            normalized.erase(0, 2);
+        return normalized;
+    }
+}
+
+/**
+ * @brief Finds an embedded asset by path
+ *
+ * @param path Asset path, relative to the project root
+ * @return const SGL_EmbeddedAsset* nullptr if the file wasn't embedded
+ */
+const SGL_EmbeddedAsset *sglEmbeddedAsset(const std::string &path) noexcept
+{
+    const std::string normalized = normalizeAssetPath(path);
+    for (std::size_t i = 0; i < SGL_EMBEDDED_ASSET_COUNT; ++i)
+        if (normalized == SGL_EMBEDDED_ASSETS[i].path)
+            return &SGL_EMBEDDED_ASSETS[i];
+    return nullptr;
+}
+
+/**
+ * @brief Reads a whole asset, from memory if it's embedded and from disk otherwise
+ *
+ * @param path Asset path
+ * @param contents Receives the asset
+ * @return bool False if the asset isn't embedded and the file couldn't be opened
+ */
+bool sglReadAsset(const std::string &path, std::string &contents)
+{
+    const SGL_EmbeddedAsset *embedded = sglEmbeddedAsset(path);
+    if (embedded != nullptr)
+    {
+        contents.assign(reinterpret_cast<const char*>(embedded->data), embedded->size);
+        return true;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+        return false;
+    std::stringstream stream;
+    stream << file.rdbuf();
+    contents = stream.str();
+    return true;
+}
@@ -0,0 +1,53 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_EmbeddedAssets.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Engine assets compiled into the library
+ *
+ * @section DESCRIPTION
+ *
+ * The built-in shaders, the default font and the default textures are converted to
+ * constant byte arrays by tools/sgl_embed.sh at build time (SGL_EmbeddedAssetsData.cpp).
+ * Any path under FOLDER_STRUCTURE's engine asset directory is served from memory, so the
+ * engine starts without touching the filesystem and without the ./assets/skeletonGL/ layout.
+ */
+
+#ifndef SRC_SKELETONGL_UTILITY_EMBEDDED_ASSETS_HPP
+#define SRC_SKELETONGL_UTILITY_EMBEDDED_ASSETS_HPP
+
+// C++
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief A file embedded in the library
+ */
+struct SGL_EmbeddedAsset
+{
+    const char *path;                 ///< Path relative to the project root, as passed to the embed tool
+    const unsigned char *data;        ///< Contents, followed by a NUL terminator
+    std::size_t size;                 ///< Contents size in bytes, without the terminator
+};
+
+// Generated table
+extern const SGL_EmbeddedAsset SGL_EMBEDDED_ASSETS[];
+extern const std::size_t SGL_EMBEDDED_ASSET_COUNT;
+
+// Finds an embedded asset by path, "./" prefixes and repeated slashes are ignored, nullptr if not embedded
+const SGL_EmbeddedAsset *sglEmbeddedAsset(const std::string &path) noexcept;
+// Reads a whole asset, from memory if it's embedded and from disk otherwise
+bool sglReadAsset(const std::string &path, std::string &contents);
+
+#endif // SRC_SKELETONGL_UTILITY_EMBEDDED_ASSETS_HPP
@@ -0,0 +1,331 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_FlightRecorder.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Keeps the last seconds of frames in memory and writes them out when a frame hitches
+ *
+ * @section DESCRIPTION
+ *
+ * See SGL_FlightRecorder.hpp
+ */
+
+#include "SGL_FlightRecorder.hpp"
+
+// C++
+#include <ctime>
+#include <fstream>
+#include <algorithm>
+#ifdef __WIN32__
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+const std::size_t SGL_FlightRecorder::MAX_INPUT_EVENTS;
+
+// Trace track the frames and input are drawn on, far from any real thread ID
+static const std::uint32_t SGL_FLIGHT_TRACK = 1000000;
+
+/**
+ * @brief Constructor
+ *
+ * @param thresholdMs Frames longer than this are dumped, 0 disables the recorder
+ * @param directory Where the dumps are written
+ * @param historySeconds Seconds of history kept
+ * @return nothing
+ */
+SGL_FlightRecorder::SGL_FlightRecorder(double thresholdMs, const std::string &directory, double historySeconds)
+    : pFrameIndex(0), pThresholdMs(0.0), pHistorySeconds(5.0), pLastDumpNs(0), pDumps(0)
+{
+    setThreshold(thresholdMs);
+    setHistory(historySeconds);
+    setDirectory(directory);
+}
+
+/**
+ * @brief Drops everything older than the history
+ *
+ * @param nowNs Current time
+ * @return nothing
+ */
+void SGL_FlightRecorder::trim(std::uint64_t nowNs) noexcept
+{
+    const std::uint64_t historyNs = static_cast<std::uint64_t>(pHistorySeconds * 1e9);
+    const std::uint64_t oldestNs = (nowNs > historyNs) ? nowNs - historyNs : 0;
+
+    while (!pFrames.empty() && pFrames.front().endNs < oldestNs)
+        pFrames.pop_front();
+    while (!pInput.empty() && pInput.front().timeNs < oldestNs)
+        pInput.pop_front();
+}
+
+/**
+ * @brief Stores an input event polled during the current frame
+ *
+ * @param type SDL event type
+ * @param code Key, mouse button or window event
+ * @return nothing
+ */
+void SGL_FlightRecorder::recordInput(std::uint32_t type, std::int32_t code)
+{
+    if (!enabled())
+        return;
+    if (pInput.size() >= MAX_INPUT_EVENTS)
+        pInput.pop_front();
+    pInput.push_back({SGL_Tracer::now(), type, code});
+}
+
+/**
+ * @brief Stores a finished frame and dumps the history if it took too long
+ * @section DESCRIPTION
+ *
+ * The file is written synchronously, the hitch is already in the past and the next frame
+ * absorbs the cost. Further hitches are ignored until a full history length has passed.
+ *
+ * @param times The frame's timings
+ * @param counters The frame's OpenGL counters
+ * @return bool True if the history was written
+ */
+bool SGL_FlightRecorder::recordFrame(const SGL_FrameSample &times, const SGL_FrameCounters &counters)
+{
+    if (!enabled())
+        return false;
+
+    const std::uint64_t nowNs = SGL_Tracer::now();
+    pFrames.push_back({pFrameIndex++, nowNs, times, counters});
+    trim(nowNs);
+
+    const std::uint64_t historyNs = static_cast<std::uint64_t>(pHistorySeconds * 1e9);
+    if (times.frameMs <= pThresholdMs || (pLastDumpNs != 0 && nowNs - pLastDumpNs < historyNs))
+        return false;
+    pLastDumpNs = nowNs;
+
+#ifdef __WIN32__
+    _mkdir(pDirectory.c_str());
+#else
+    mkdir(pDirectory.c_str(), 0755);
+#endif
+
+    char stamp[32];
+    const std::time_t wallClock = std::time(nullptr);
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", std::localtime(&wallClock));
+    const std::string path = pDirectory + "sgl_hitch_" + stamp + "_" + std::to_string(pFrames.back().index) + ".json";
+
+    std::ofstream file(path);
+    if (!file)
+        return false;
+    write(file, &pFrames.back());
+    if (!file)
+        return false;
+
+    pDumps++;
+    pLastDump = path;
+    return true;
+}
+
+/**
+ * @brief Writes the history to a file right away
+ *
+ * @param path Output file
+ * @return bool False if the file couldn't be written
+ */
+bool SGL_FlightRecorder::dump(const std::string &path) const
+{
+    std::ofstream file(path);
+    if (!file)
+        return false;
+    write(file, nullptr);
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Writes the history as Chrome Trace Event JSON
+ *
+ * @param out Stream
+ * @param hitch The frame that triggered the dump, nullptr for manual dumps
+ * @return nothing
+ */
+void SGL_FlightRecorder::write(std::ostream &out, const SGL_FlightFrame *hitch) const
+{
+    // Everything is relative to the start of the oldest frame
+    std::uint64_t baseNs = pFrames.empty() ? SGL_Tracer::now() : pFrames.front().endNs;
+    if (!pFrames.empty())
+        baseNs -= std::min(baseNs, static_cast<std::uint64_t>(pFrames.front().times.frameMs * 1e6));
+    if (!pInput.empty())
+        baseNs = std::min(baseNs, pInput.front().timeNs);
+    auto relativeUs = [baseNs](std::uint64_t ns) { return (static_cast<double>(ns) - baseNs) / 1000.0; };
+
+    out << "{\"displayTimeUnit\":\"ms\",\n\"otherData\":{";
+    out << "\"thresholdMs\":" << pThresholdMs << ",\"historySeconds\":" << pHistorySeconds;
+    out << ",\"traceZones\":" << (SGL_Tracer::enabled() ? "true" : "false");
+    if (hitch != nullptr)
+        out << ",\"hitchFrame\":" << hitch->index << ",\"hitchMs\":" << hitch->times.frameMs;
+    out << "},\n";
+
+    out << "\"frames\":[";
+    for (std::size_t i = 0; i < pFrames.size(); ++i)
+    {
+        const SGL_FlightFrame &frame = pFrames[i];
+        const SGL_FrameCounters &c = frame.counters;
+        out << (i == 0 ? "\n" : ",\n");
+        out << "{\"frame\":" << frame.index << ",\"endUs\":" << relativeUs(frame.endNs)
+            << ",\"frameMs\":" << frame.times.frameMs << ",\"updateMs\":" << frame.times.updateMs
+            << ",\"renderMs\":" << frame.times.renderMs << ",\"swapMs\":" << frame.times.swapMs
+            << ",\"drawCalls\":" << c.drawCalls << ",\"instancedDraws\":" << c.instancedDraws
+            << ",\"instances\":" << c.instances << ",\"indirectDraws\":" << c.indirectDraws
+            << ",\"dispatches\":" << c.dispatches << ",\"programSwitches\":" << c.programSwitches
+            << ",\"textureBinds\":" << c.textureBinds << ",\"fboBinds\":" << c.fboBinds
+            << ",\"bufferBinds\":" << c.bufferBinds << ",\"vaoBinds\":" << c.vaoBinds
+            << ",\"blendChanges\":" << c.blendChanges << ",\"capabilityChanges\":" << c.capabilityChanges
+            << ",\"uniformUpdates\":" << c.uniformUpdates << ",\"viewportChanges\":" << c.viewportChanges
+            << ",\"bytesUploaded\":" << c.bytesUploaded << "}";
+    }
+    out << "],\n";
+
+    out << "\"input\":[";
+    for (std::size_t i = 0; i < pInput.size(); ++i)
+    {
+        out << (i == 0 ? "\n" : ",\n");
+        out << "{\"timeUs\":" << relativeUs(pInput[i].timeNs) << ",\"type\":" << pInput[i].type
+            << ",\"code\":" << pInput[i].code << "}";
+    }
+    out << "],\n";
+
+    // Zones still in the tracer rings, then the frames and input on their own track
+    out << "\"traceEvents\":[\n";
+    bool first = true;
+    SGL_Tracer::writeTraceEvents(out, SGL_Tracer::collect(baseNs), baseNs, first);
+
+    out << (first ? "" : ",\n");
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << SGL_FLIGHT_TRACK
+        << ",\"args\":{\"name\":\"frames\"}}";
+    for (const SGL_FlightFrame &frame : pFrames)
+    {
+        const double durationUs = frame.times.frameMs * 1000.0;
+        out << ",\n{\"name\":\"" << (&frame == hitch ? "hitch " : "frame ") << frame.index
+            << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":0,\"tid\":" << SGL_FLIGHT_TRACK
+            << ",\"ts\":" << relativeUs(frame.endNs) - durationUs << ",\"dur\":" << durationUs
+            << ",\"args\":{\"drawCalls\":" << frame.counters.drawCalls << "}}";
+    }
+    for (const SGL_FlightInput &input : pInput)
+    {
+        out << ",\n{\"name\":\"input " << input.type << "\",\"cat\":\"input\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":"
+            << SGL_FLIGHT_TRACK << ",\"ts\":" << relativeUs(input.timeNs) << ",\"args\":{\"code\":" << input.code << "}}";
+    }
+    out << "\n]}\n";
+}
+
+/**
+ * @brief Sets the hitch threshold, 0 disables the recorder and drops the history
+ *
+ * @param thresholdMs Threshold in milliseconds
+ * @return nothing
+ */
+void SGL_FlightRecorder::setThreshold(double thresholdMs) noexcept
+{
+    pThresholdMs = std::max(thresholdMs, 0.0);
+    if (!enabled())
+    {
+        pFrames.clear();
+        pInput.clear();
+    }
+}
+
+/**
+ * @brief Hitch threshold in milliseconds, 0 when disabled
+ * @return double
+ */
+double SGL_FlightRecorder::getThreshold() const noexcept
+{
+    return pThresholdMs;
+}
+
+/**
+ * @brief Is the recorder keeping history?
+ * @return bool
+ */
+bool SGL_FlightRecorder::enabled() const noexcept
+{
+    return pThresholdMs > 0.0;
+}
+
+/**
+ * @brief Sets the directory the dumps are written to, created on the first dump
+ *
+ * @param directory Output directory
+ * @return nothing
+ */
+void SGL_FlightRecorder::setDirectory(const std::string &directory)
+{
+    pDirectory = directory.empty() ? FOLDER_STRUCTURE::hitchDir : directory;
+    if (pDirectory.back() != '/')
+        pDirectory += '/';
+}
+
+/**
+ * @brief Directory the dumps are written to
+ * @return std::string
+ */
+const std::string &SGL_FlightRecorder::getDirectory() const noexcept
+{
+    return pDirectory;
+}
+
+/**
+ * @brief Sets how many seconds of history are kept
+ *
+ * @param seconds History length, at least one second
+ * @return nothing
+ */
+void SGL_FlightRecorder::setHistory(double seconds) noexcept
+{
+    pHistorySeconds = std::max(seconds, 1.0);
+}
+
+/**
+ * @brief Seconds of history kept
+ * @return double
+ */
+double SGL_FlightRecorder::getHistory() const noexcept
+{
+    return pHistorySeconds;
+}
+
+/**
+ * @brief Frames currently kept
+ * @return std::size_t
+ */
+std::size_t SGL_FlightRecorder::size() const noexcept
+{
+    return pFrames.size();
+}
+
+/**
+ * @brief Files written so far
+ * @return std::size_t
+ */
+std::size_t SGL_FlightRecorder::dumps() const noexcept
+{
+    return pDumps;
+}
+
+/**
+ * @brief Path of the last file written, empty if none
+ * @return std::string
+ */
+const std::string &SGL_FlightRecorder::lastDump() const noexcept
+{
+    return pLastDump;
+}
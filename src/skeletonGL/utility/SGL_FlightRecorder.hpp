@@ -0,0 +1,126 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_FlightRecorder.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Keeps the last seconds of frames in memory and writes them out when a frame hitches
+ *
+ * @section DESCRIPTION
+ *
+ * Every frame's timings and OpenGL counters are kept together with the input events polled
+ * during them, anything older than the history length is dropped. When a frame takes longer
+ * than the threshold the history, plus the CPU zones still in the SGL_Tracer rings, is written
+ * to a timestamped file. The file is Chrome Trace Event JSON, frames and input show up as their
+ * own tracks next to the zones, the raw samples are kept under "frames" and "input".
+ */
+
+#ifndef SRC_SKELETONGL_UTILITY_FLIGHT_RECORDER_HPP
+#define SRC_SKELETONGL_UTILITY_FLIGHT_RECORDER_HPP
+
+// C++
+#include <string>
+#include <deque>
+#include <ostream>
+#include <cstdint>
+#include <cstddef>
+// SkeletonGL
+#include "SGL_DataStructures.hpp"
+#include "SGL_FrameStats.hpp"
+#include "SGL_Trace.hpp"
+
+/**
+ * @brief A recorded frame
+ */
+struct SGL_FlightFrame
+{
+    std::uint64_t index;                      ///< Frames recorded before this one
+    std::uint64_t endNs;                      ///< SGL_Tracer::now() when the frame ended
+    SGL_FrameSample times;                    ///< Frame, update, render and swap times
+    SGL_FrameCounters counters;               ///< OpenGL work issued during the frame
+};
+
+/**
+ * @brief A recorded input event
+ */
+struct SGL_FlightInput
+{
+    std::uint64_t timeNs;                     ///< SGL_Tracer::now() when the event was polled
+    std::uint32_t type;                       ///< SDL event type
+    std::int32_t code;                        ///< Key, mouse button or window event, 0 for the rest
+};
+
+/**
+ * @brief Rolling frame history dumped on hitches, owned by SGL_Window
+ * @section DESCRIPTION
+ *
+ * A threshold of 0 disables the recorder. After a dump, hitches are ignored until a full
+ * history length has passed so a burst of slow frames produces a single file.
+ */
+class SGL_FlightRecorder
+{
+private:
+    std::deque<SGL_FlightFrame> pFrames;      ///< Frames inside the history, oldest first
+    std::deque<SGL_FlightInput> pInput;       ///< Input inside the history, oldest first
+    std::uint64_t pFrameIndex;                ///< Index of the next frame
+    double pThresholdMs;                      ///< Frames longer than this are hitches, 0 disables
+    double pHistorySeconds;                   ///< How far back the history goes
+    std::string pDirectory;                   ///< Where the dumps are written, created on first use
+    std::uint64_t pLastDumpNs;                ///< End of the last dumped frame
+    std::size_t pDumps;                       ///< Files written
+    std::string pLastDump;                    ///< Path of the last file written
+
+    // Drops everything older than the history
+    void trim(std::uint64_t nowNs) noexcept;
+    // Writes the history, the hitch frame is highlighted
+    void write(std::ostream &out, const SGL_FlightFrame *hitch) const;
+
+    // Disable all copy and move constructors
+    SGL_FlightRecorder(const SGL_FlightRecorder&) = delete;
+    SGL_FlightRecorder *operator = (const SGL_FlightRecorder&) = delete;
+    SGL_FlightRecorder(SGL_FlightRecorder &&) = delete;
+    SGL_FlightRecorder &operator = (SGL_FlightRecorder &&) = delete;
+
+public:
+    // Maximum input events kept, mouse motion can flood the history
+    static const std::size_t MAX_INPUT_EVENTS = 4096;
+
+    // Constructor
+    explicit SGL_FlightRecorder(double thresholdMs = 0.0, const std::string &directory = FOLDER_STRUCTURE::hitchDir, double historySeconds = 5.0);
+
+    // Frames longer than thresholdMs are dumped, 0 disables the recorder
+    void setThreshold(double thresholdMs) noexcept;
+    double getThreshold() const noexcept;
+    bool enabled() const noexcept;
+    // Directory the dumps are written to
+    void setDirectory(const std::string &directory);
+    const std::string &getDirectory() const noexcept;
+    // Seconds of history kept
+    void setHistory(double seconds) noexcept;
+    double getHistory() const noexcept;
+
+    // Stores an input event polled during the current frame
+    void recordInput(std::uint32_t type, std::int32_t code);
+    // Stores a finished frame, returns true if it was a hitch and the history was written
+    bool recordFrame(const SGL_FrameSample &times, const SGL_FrameCounters &counters);
+    // Writes the history to path right away
+    bool dump(const std::string &path) const;
+
+    // Frames currently kept
+    std::size_t size() const noexcept;
+    // Files written so far and the path of the last one
+    std::size_t dumps() const noexcept;
+    const std::string &lastDump() const noexcept;
+};
+
+#endif // SRC_SKELETONGL_UTILITY_FLIGHT_RECORDER_HPP
@@ -0,0 +1,182 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_FrameStats.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Rolling frame time statistics
+ *
+ * @section DESCRIPTION
+ *
+ * See SGL_FrameStats.hpp
+ */
+
+#include "SGL_FrameStats.hpp"
+
+// C++
+#include <cmath>
+#include <cstdio>
+
+/**
+ * @brief Constructor
+ *
+ * @param capacity Amount of frames kept, at least 1
+ * @param budgetMs Frame time budget in milliseconds
+ * @return nothing
+ */
+SGL_FrameStats::SGL_FrameStats(std::size_t capacity, double budgetMs)
+    : pSamples(std::max<std::size_t>(1, capacity)), pNext(0), pCount(0), pBudgetMs(budgetMs)
+{
+    pScratch.reserve(pSamples.size());
+}
+
+/**
+ * @brief Stores a frame sample
+ *
+ * @param sample The frame's phase durations
+ * @return nothing
+ */
+void SGL_FrameStats::push(const SGL_FrameSample &sample) noexcept
+{
+    pSamples[pNext] = sample;
+    pNext = (pNext + 1) % pSamples.size();
+    pCount = std::min(pCount + 1, pSamples.size());
+}
+
+/**
+ * @brief Forgets every sample
+ *
+ * @return nothing
+ */
+void SGL_FrameStats::clear() noexcept
+{
+    pNext = 0;
+    pCount = 0;
+}
+
+/**
+ * @brief Sets the frame time budget
+ *
+ * @param budgetMs Milliseconds, frames taking longer count as over budget
+ * @return nothing
+ */
+void SGL_FrameStats::setBudget(double budgetMs) noexcept
+{
+    pBudgetMs = budgetMs;
+}
+
+/**
+ * @brief Frame time budget
+ * @return double Milliseconds
+ */
+double SGL_FrameStats::getBudget() const noexcept
+{
+    return pBudgetMs;
+}
+
+/**
+ * @brief Amount of samples stored
+ * @return std::size_t
+ */
+std::size_t SGL_FrameStats::size() const noexcept
+{
+    return pCount;
+}
+
+/**
+ * @brief Maximum amount of samples stored
+ * @return std::size_t
+ */
+std::size_t SGL_FrameStats::capacity() const noexcept
+{
+    return pSamples.size();
+}
+
+/**
+ * @brief Most recent frame
+ * @return SGL_FrameSample
+ */
+SGL_FrameSample SGL_FrameStats::latest() const noexcept
+{
+    if (pCount == 0)
+        return {0.0, 0.0, 0.0, 0.0};
+    return pSamples[(pNext + pSamples.size() - 1) % pSamples.size()];
+}
+
+/**
+ * @brief Statistics of every frame in the ring
+ * @return SGL_FrameStatsReport
+ */
+SGL_FrameStatsReport SGL_FrameStats::report() const
+{
+    SGL_FrameStatsReport report;
+    report.frames = pCount;
+    report.budgetMs = pBudgetMs;
+    report.overBudget = 0;
+    for (std::size_t i = 0; i < pCount; ++i)
+        if (pSamples[i].frameMs > pBudgetMs)
+            report.overBudget++;
+    report.frame = sglSummarizeTimes(pSamples.data(), pCount, &SGL_FrameSample::frameMs, pScratch);
+    report.update = sglSummarizeTimes(pSamples.data(), pCount, &SGL_FrameSample::updateMs, pScratch);
+    report.render = sglSummarizeTimes(pSamples.data(), pCount, &SGL_FrameSample::renderMs, pScratch);
+    report.swap = sglSummarizeTimes(pSamples.data(), pCount, &SGL_FrameSample::swapMs, pScratch);
+    return report;
+}
+
+/**
+ * @brief Short human readable summary
+ * @return std::string
+ */
+std::string SGL_FrameStats::summary() const
+{
+    SGL_FrameStatsReport stats = this->report();
+    double fps = (stats.frame.meanMs > 0.0) ? 1000.0 / stats.frame.meanMs : 0.0;
+    char line[192];
+    std::snprintf(line, sizeof(line), "%.0f FPS | frame %.2f ms p99 %.2f max %.2f | cpu %.2f swap %.2f update %.2f | %zu/%zu over %.1f ms",
+                  fps, stats.frame.p50Ms, stats.frame.p99Ms, stats.frame.maxMs, stats.render.p50Ms, stats.swap.p50Ms,
+                  stats.update.p50Ms, stats.overBudget, stats.frames, stats.budgetMs);
+    return line;
+}
+
+/**
+ * @brief Distribution of a set of times
+ *
+ * @param values Times in milliseconds, sorted in place
+ * @return SGL_FrameTimeSummary Zeros if there are no values
+ * @section DESCRIPTION
+ *
+ * Percentiles use the nearest rank of the sorted values.
+ */
+SGL_FrameTimeSummary sglSummarizeTimes(std::vector<double> &values)
+{
+    SGL_FrameTimeSummary summary = {0.0, 0.0, 0.0, 0.0, 0.0};
+    if (values.empty())
+        return summary;
+
+    std::sort(values.begin(), values.end());
+    double total = 0.0;
+    for (double value : values)
+        total += value;
+
+    const std::size_t count = values.size();
+    auto rank = [&values, count](double percentile) {
+        std::size_t index = static_cast<std::size_t>(std::ceil(percentile * count));
+        return values[std::min(count, std::max<std::size_t>(1, index)) - 1];
+    };
+    summary.meanMs = total / count;
+    summary.p50Ms = rank(0.50);
+    summary.p95Ms = rank(0.95);
+    summary.p99Ms = rank(0.99);
+    summary.maxMs = values.back();
+    return summary;
+}
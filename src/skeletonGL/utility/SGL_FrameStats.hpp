@@ -0,0 +1,126 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_FrameStats.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Rolling frame time statistics
+ *
+ * @section DESCRIPTION
+ *
+ * Every frame is split into the time spent between frames (input and game update), the CPU
+ * side of rendering (startFrame() to the swap) and the swap itself, which includes vsync and
+ * the frames in flight wait. The last samples are kept in a fixed size ring, reports give the
+ * mean, median, tail percentiles and maximum of each phase and how many frames missed the budget.
+ */
+
+#ifndef SRC_SKELETONGL_UTILITY_FRAME_STATS_HPP
+#define SRC_SKELETONGL_UTILITY_FRAME_STATS_HPP
+
+// C++
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+/**
+ * @brief Duration of a single frame and its phases, in milliseconds
+ */
+struct SGL_FrameSample
+{
+    double frameMs;                           ///< Previous endFrame() to this one
+    double updateMs;                          ///< Previous endFrame() to startFrame(), input and game logic
+    double renderMs;                          ///< startFrame() to the swap
+    double swapMs;                            ///< Swap, vsync and frames in flight wait
+};
+
+/**
+ * @brief Distribution of one phase over the sampled frames, in milliseconds
+ */
+struct SGL_FrameTimeSummary
+{
+    double meanMs;
+    double p50Ms;
+    double p95Ms;
+    double p99Ms;
+    double maxMs;
+};
+
+// Distribution of values, sorted in place. Percentiles use the nearest rank
+SGL_FrameTimeSummary sglSummarizeTimes(std::vector<double> &values);
+
+/**
+ * @brief Distribution of one member of a sample array, scratch is reused to avoid allocations
+ */
+template <typename Sample>
+SGL_FrameTimeSummary sglSummarizeTimes(const Sample *samples, std::size_t count, double Sample::*member, std::vector<double> &scratch)
+{
+    scratch.clear();
+    for (std::size_t i = 0; i < count; ++i)
+        scratch.push_back(samples[i].*member);
+    return sglSummarizeTimes(scratch);
+}
+
+/**
+ * @brief Summary of every sampled frame
+ */
+struct SGL_FrameStatsReport
+{
+    std::size_t frames;                       ///< Samples in the ring
+    std::size_t overBudget;                   ///< Frames longer than budgetMs
+    double budgetMs;                          ///< Frame time budget
+    SGL_FrameTimeSummary frame, update, render, swap;
+};
+
+/**
+ * @brief Fixed size ring of frame samples, owned by SGL_Window
+ */
+class SGL_FrameStats
+{
+private:
+    std::vector<SGL_FrameSample> pSamples;    ///< Ring storage
+    std::size_t pNext;                        ///< Slot of the next sample
+    std::size_t pCount;                       ///< Valid samples, at most the capacity
+    double pBudgetMs;                         ///< Frames longer than this are counted as over budget
+    mutable std::vector<double> pScratch;     ///< Sorted copy of a phase, reused between reports
+
+    // Disable all copy and move constructors
+    SGL_FrameStats(const SGL_FrameStats&) = delete;
+    SGL_FrameStats *operator = (const SGL_FrameStats&) = delete;
+    SGL_FrameStats(SGL_FrameStats &&) = delete;
+    SGL_FrameStats &operator = (SGL_FrameStats &&) = delete;
+
+public:
+    // Constructor
+    explicit SGL_FrameStats(std::size_t capacity = 240, double budgetMs = 1.5 * 1000.0 / 60.0);
+
+    // Stores a frame, overwriting the oldest once the ring is full
+    void push(const SGL_FrameSample &sample) noexcept;
+    // Forget every sample
+    void clear() noexcept;
+
+    // Frame time budget, usually a tolerance above the display refresh period
+    void setBudget(double budgetMs) noexcept;
+    double getBudget() const noexcept;
+
+    std::size_t size() const noexcept;
+    std::size_t capacity() const noexcept;
+    // Most recent sample, zeros if there are none
+    SGL_FrameSample latest() const noexcept;
+    // Statistics of every sample in the ring
+    SGL_FrameStatsReport report() const;
+    // One line summary, used by show_fps
+    std::string summary() const;
+};
+
+#endif // SRC_SKELETONGL_UTILITY_FRAME_STATS_HPP
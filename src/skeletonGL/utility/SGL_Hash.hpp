@@ -0,0 +1,54 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_Hash.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief 64 bit FNV-1a hash
+ *
+ * @section DESCRIPTION
+ *
+ * Used by the OpenGL manager's frame hash and the program binary cache keys. Start
+ * with SGL_FNV1A_OFFSET and feed the previous result back to hash several buffers.
+ */
+
+#ifndef SRC_SKELETONGL_UTILITY_HASH_HPP
+#define SRC_SKELETONGL_UTILITY_HASH_HPP
+
+// C++
+#include <cstdint>
+#include <cstddef>
+
+const std::uint64_t SGL_FNV1A_OFFSET = 14695981039346656037ULL;
+const std::uint64_t SGL_FNV1A_PRIME = 1099511628211ULL;
+
+/**
+ * @brief Folds size bytes of data into hash
+ *
+ * @param hash SGL_FNV1A_OFFSET or the result of a previous call
+ * @param data Bytes to hash
+ * @param size Byte count
+ * @return std::uint64_t
+ */
+inline std::uint64_t sglFNV1a(std::uint64_t hash, const void *data, std::size_t size) noexcept
+{
+    const unsigned char *bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= SGL_FNV1A_PRIME;
+    }
+    return hash;
+}
+
+#endif // SRC_SKELETONGL_UTILITY_HASH_HPP
@@ -0,0 +1,208 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_LatencyTracker.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Rolling input to present latency statistics
+ *
+ * @section DESCRIPTION
+ *
+ * See SGL_LatencyTracker.hpp
+ */
+
+#include "SGL_LatencyTracker.hpp"
+
+// C++
+#include <cmath>
+#include <cstdio>
+
+// Frames waiting for their fence, only exceeded if fences stop being polled
+static const std::size_t SGL_LATENCY_MAX_PENDING = 16;
+
+/**
+ * @brief Constructor
+ *
+ * @param capacity Amount of samples kept, at least 1
+ * @param bucketMs Histogram bucket width in milliseconds
+ * @param buckets Amount of histogram buckets, at least 1
+ * @return nothing
+ */
+SGL_LatencyTracker::SGL_LatencyTracker(std::size_t capacity, double bucketMs, std::size_t buckets)
+    : pSamples(std::max<std::size_t>(1, capacity)), pNext(0), pCount(0), pHasInput(false), pEvents(0)
+{
+    pScratch.reserve(pSamples.size());
+    this->setHistogram(bucketMs, buckets);
+}
+
+/**
+ * @brief Stores a sample
+ *
+ * @param sample The frame's latencies
+ * @return nothing
+ */
+void SGL_LatencyTracker::push(const SGL_LatencySample &sample) noexcept
+{
+    pSamples[pNext] = sample;
+    pNext = (pNext + 1) % pSamples.size();
+    pCount = std::min(pCount + 1, pSamples.size());
+}
+
+/**
+ * @brief Records an input event
+ *
+ * @param time When the event happened
+ * @return nothing
+ */
+void SGL_LatencyTracker::input(clock::time_point time) noexcept
+{
+    if (!pHasInput || time < pOldestInput)
+        pOldestInput = time;
+    pHasInput = true;
+    pEvents++;
+}
+
+/**
+ * @brief A frame was presented, it's the first one that can show the pending input
+ *
+ * @param time When the buffer swap returned
+ * @param serial The frame's fence serial (SGL_OpenGLManager::framesFenced()), 0 if frames aren't fenced
+ * @return nothing
+ */
+void SGL_LatencyTracker::present(clock::time_point time, std::uint64_t serial) noexcept
+{
+    if (!pHasInput)
+        return;
+
+    if (serial == 0)
+    {
+        double latencyMs = std::chrono::duration<double, std::milli>(time - pOldestInput).count();
+        this->push({latencyMs, latencyMs, pEvents});
+    }
+    else
+    {
+        if (pPending.size() >= SGL_LATENCY_MAX_PENDING)
+            pPending.pop_front();
+        pPending.push_back({serial, pOldestInput, time, pEvents});
+    }
+    pHasInput = false;
+    pEvents = 0;
+}
+
+/**
+ * @brief Completes the samples of every frame the GPU finished
+ *
+ * @param serial Last retired fence serial (SGL_OpenGLManager::framesRetired())
+ * @param time When the fences were polled, an upper bound of when the GPU finished
+ * @return nothing
+ */
+void SGL_LatencyTracker::retired(std::uint64_t serial, clock::time_point time) noexcept
+{
+    typedef std::chrono::duration<double, std::milli> milliseconds;
+    while (!pPending.empty() && pPending.front().serial <= serial)
+    {
+        const PendingFrame &frame = pPending.front();
+        this->push({milliseconds(frame.present - frame.input).count(), milliseconds(time - frame.input).count(), frame.events});
+        pPending.pop_front();
+    }
+}
+
+/**
+ * @brief Forgets every sample, the pending input and the frames waiting for their fence
+ *
+ * @return nothing
+ */
+void SGL_LatencyTracker::clear() noexcept
+{
+    pNext = 0;
+    pCount = 0;
+    pHasInput = false;
+    pEvents = 0;
+    pPending.clear();
+}
+
+/**
+ * @brief Sets the histogram layout
+ *
+ * @param bucketMs Bucket width in milliseconds
+ * @param buckets Amount of buckets, latencies past the last one are counted in it
+ * @return nothing
+ */
+void SGL_LatencyTracker::setHistogram(double bucketMs, std::size_t buckets) noexcept
+{
+    pBucketMs = (bucketMs > 0.0) ? bucketMs : 1.0;
+    pBuckets = std::max<std::size_t>(1, buckets);
+}
+
+/**
+ * @brief Amount of samples stored
+ * @return std::size_t
+ */
+std::size_t SGL_LatencyTracker::size() const noexcept
+{
+    return pCount;
+}
+
+/**
+ * @brief Maximum amount of samples stored
+ * @return std::size_t
+ */
+std::size_t SGL_LatencyTracker::capacity() const noexcept
+{
+    return pSamples.size();
+}
+
+/**
+ * @brief Most recent sample
+ * @return SGL_LatencySample
+ */
+SGL_LatencySample SGL_LatencyTracker::latest() const noexcept
+{
+    if (pCount == 0)
+        return {0.0, 0.0, 0};
+    return pSamples[(pNext + pSamples.size() - 1) % pSamples.size()];
+}
+
+/**
+ * @brief Statistics and histogram of every sample in the ring
+ * @return SGL_LatencyReport
+ */
+SGL_LatencyReport SGL_LatencyTracker::report() const
+{
+    SGL_LatencyReport report;
+    report.samples = pCount;
+    report.present = sglSummarizeTimes(pSamples.data(), pCount, &SGL_LatencySample::presentMs, pScratch);
+    report.gpu = sglSummarizeTimes(pSamples.data(), pCount, &SGL_LatencySample::gpuMs, pScratch);
+    report.bucketMs = pBucketMs;
+    report.histogram.assign(pBuckets, 0);
+    for (std::size_t i = 0; i < pCount; ++i)
+    {
+        std::size_t bucket = static_cast<std::size_t>(std::max(0.0, pSamples[i].gpuMs) / pBucketMs);
+        report.histogram[std::min(bucket, pBuckets - 1)]++;
+    }
+    return report;
+}
+
+/**
+ * @brief Short human readable summary
+ * @return std::string
+ */
+std::string SGL_LatencyTracker::summary() const
+{
+    SGL_FrameTimeSummary present = sglSummarizeTimes(pSamples.data(), pCount, &SGL_LatencySample::presentMs, pScratch);
+    SGL_FrameTimeSummary gpu = sglSummarizeTimes(pSamples.data(), pCount, &SGL_LatencySample::gpuMs, pScratch);
+    char line[128];
+    std::snprintf(line, sizeof(line), "input %.1f ms p99 %.1f | gpu %.1f ms p99 %.1f",
+                  present.p50Ms, present.p99Ms, gpu.p50Ms, gpu.p99Ms);
+    return line;
+}
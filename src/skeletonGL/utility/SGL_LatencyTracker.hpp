@@ -0,0 +1,124 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_LatencyTracker.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Rolling input to present latency statistics
+ *
+ * @section DESCRIPTION
+ *
+ * Input events are timestamped as they're pumped, only the oldest one not yet consumed by a
+ * frame is kept. The next presented frame consumes it: the time until SDL_GL_SwapWindow()
+ * returned is the present latency. When frames are fenced the sample is held until the
+ * frame's fence is seen signaled, giving an estimate of when the GPU finished the frame.
+ * Scanout adds up to one more refresh period that can't be measured from here.
+ */
+
+#ifndef SRC_SKELETONGL_UTILITY_LATENCY_TRACKER_HPP
+#define SRC_SKELETONGL_UTILITY_LATENCY_TRACKER_HPP
+
+// C++
+#include <deque>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+// SkeletonGL
+#include "SGL_FrameStats.hpp"
+
+/**
+ * @brief Latency of a single presented frame that consumed input, in milliseconds
+ */
+struct SGL_LatencySample
+{
+    double presentMs;                         ///< Oldest input to the return of the buffer swap
+    double gpuMs;                             ///< Oldest input to the frame's fence signaling, presentMs without fences
+    std::uint32_t events;                     ///< Input events consumed by the frame
+};
+
+/**
+ * @brief Summary of every sampled frame
+ */
+struct SGL_LatencyReport
+{
+    std::size_t samples;                      ///< Samples in the ring
+    SGL_FrameTimeSummary present, gpu;        ///< Distribution of both latencies
+    double bucketMs;                          ///< Width of a histogram bucket
+    std::vector<std::size_t> histogram;       ///< Samples per gpuMs bucket, the last one also counts everything above
+};
+
+/**
+ * @brief Fixed size ring of input latency samples, owned by SGL_Window
+ */
+class SGL_LatencyTracker
+{
+private:
+    typedef std::chrono::steady_clock clock;
+    // A presented frame waiting for its fence
+    struct PendingFrame
+    {
+        std::uint64_t serial;
+        clock::time_point input, present;
+        std::uint32_t events;
+    };
+
+    std::vector<SGL_LatencySample> pSamples;  ///< Ring storage
+    std::size_t pNext;                        ///< Slot of the next sample
+    std::size_t pCount;                       ///< Valid samples, at most the capacity
+    bool pHasInput;                           ///< Is there input no frame consumed yet?
+    clock::time_point pOldestInput;           ///< Oldest unconsumed input
+    std::uint32_t pEvents;                    ///< Unconsumed input events
+    std::deque<PendingFrame> pPending;        ///< Presented frames whose fence hasn't signaled, oldest first
+    double pBucketMs;                         ///< Histogram bucket width
+    std::size_t pBuckets;                     ///< Histogram bucket count
+    mutable std::vector<double> pScratch;     ///< Sorted copy of a latency, reused between reports
+
+    // Stores a sample, overwriting the oldest once the ring is full
+    void push(const SGL_LatencySample &sample) noexcept;
+
+    // Disable all copy and move constructors
+    SGL_LatencyTracker(const SGL_LatencyTracker&) = delete;
+    SGL_LatencyTracker *operator = (const SGL_LatencyTracker&) = delete;
+    SGL_LatencyTracker(SGL_LatencyTracker &&) = delete;
+    SGL_LatencyTracker &operator = (SGL_LatencyTracker &&) = delete;
+
+public:
+    // Constructor
+    explicit SGL_LatencyTracker(std::size_t capacity = 240, double bucketMs = 2.0, std::size_t buckets = 50);
+
+    // An input event happened at time
+    void input(clock::time_point time) noexcept;
+    // A frame was presented at time, it consumes the pending input. serial is the frame's fence, 0 if unfenced
+    void present(clock::time_point time, std::uint64_t serial) noexcept;
+    // Every fenced frame up to serial was seen finished at time
+    void retired(std::uint64_t serial, clock::time_point time) noexcept;
+    // Forget every sample and the pending input
+    void clear() noexcept;
+
+    // Histogram layout used by report()
+    void setHistogram(double bucketMs, std::size_t buckets) noexcept;
+
+    std::size_t size() const noexcept;
+    std::size_t capacity() const noexcept;
+    // Most recent sample, zeros if there are none
+    SGL_LatencySample latest() const noexcept;
+    // Statistics and histogram of every sample in the ring
+    SGL_LatencyReport report() const;
+    // One line summary, used by show_fps
+    std::string summary() const;
+};
+
+#endif // SRC_SKELETONGL_UTILITY_LATENCY_TRACKER_HPP
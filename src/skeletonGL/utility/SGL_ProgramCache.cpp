@@ -0,0 +1,210 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_ProgramCache.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief On disk cache of linked shader program binaries
+ *
+ * @section DESCRIPTION
+ *
+ * See SGL_ProgramCache.hpp
+ */
+
+// C++
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#ifdef __WIN32__
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+// SkeletonGL
+#include "SGL_ProgramCache.hpp"
+#include "SGL_Hash.hpp"
+
+namespace
+{
+    const char ENTRY_MAGIC[4] = {'S', 'G', 'L', 'B'};
+    const std::uint32_t ENTRY_VERSION = 1;
+
+    /**
+     * @brief Header written in front of every binary
+     */
+    struct ProgramEntryHeader
+    {
+        char magic[4];               ///< Always SGLB
+        std::uint32_t version;       ///< Bumped whenever the layout changes
+        std::uint64_t key;           ///< Guards against hash truncation in the file name
+        std::uint32_t binaryFormat;  ///< Driver format returned by glGetProgramBinary
+        std::uint32_t length;        ///< Binary size in bytes
+    };
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param oglm The window's OpenGL manager
+ * @param directory Cache directory, created if it doesn't exist
+ * @param deviceInfo Host details, the driver strings invalidate the cache when they change
+ * @return nothing
+ */
+SGL_ProgramCache::SGL_ProgramCache(std::shared_ptr<SGL_OpenGLManager> oglm, const std::string &directory, const SGL_DeviceInfo &deviceInfo)
+    : WMOGLM(oglm), pDirectory(directory)
+{
+    if (!pDirectory.empty() && pDirectory.back() != '/')
+        pDirectory += '/';
+
+    auto glString = [](const unsigned char *str) {
+        return (str == nullptr) ? std::string() : std::string(reinterpret_cast<const char*>(str));
+    };
+    pDriver = glString(deviceInfo.glVendor) + "|" + glString(deviceInfo.glRenderer) + "|" + glString(deviceInfo.glVer);
+
+#ifdef __WIN32__
+    _mkdir(pDirectory.c_str());
+#else
+    mkdir(pDirectory.c_str(), 0755);
+#endif
+    SGL_Log("Program binary cache: " + pDirectory, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+}
+
+/**
+ * @brief Destructor
+ *
+ * @return nothing
+ */
+SGL_ProgramCache::~SGL_ProgramCache()
+{
+
+}
+
+/**
+ * @brief Full path of the entry for key
+ *
+ * @param key Value returned by key()
+ * @return std::string
+ */
+std::string SGL_ProgramCache::entryPath(std::uint64_t key) const
+{
+    std::stringstream path;
+    path << pDirectory << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return path.str();
+}
+
+/**
+ * @brief Hashes the sources of a program together with the driver strings
+ *
+ * @param sources Every source the program is built from, in stage order
+ * @return std::uint64_t
+ */
+std::uint64_t SGL_ProgramCache::key(const std::vector<std::string> &sources) const noexcept
+{
+    std::uint64_t hash = SGL_FNV1A_OFFSET;
+    hash = sglFNV1a(hash, pDriver.data(), pDriver.size());
+    for (const std::string &source : sources)
+    {
+        // Hashing the size keeps ("ab", "c") and ("a", "bc") apart
+        std::uint64_t size = source.size();
+        hash = sglFNV1a(hash, &size, sizeof(size));
+        hash = sglFNV1a(hash, source.data(), source.size());
+    }
+    return hash;
+}
+
+/**
+ * @brief Restores the program stored under key
+ *
+ * @param key Value returned by key()
+ * @param shaderType Shader category assigned to the restored program
+ * @param shader Receives the program
+ * @return bool False if there is no usable entry, the caller must compile from source
+ */
+bool SGL_ProgramCache::load(std::uint64_t key, SHADER_TYPE shaderType, SGL_Shader &shader) const
+{
+    const std::string path = entryPath(key);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return false;
+    const std::streamoff fileSize = file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    ProgramEntryHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    bool valid = file.good() && std::memcmp(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) == 0 &&
+        header.version == ENTRY_VERSION && header.key == key && header.length > 0;
+    // A corrupt length must not size the allocation, the binary has to fit in the file
+    valid = valid && fileSize >= 0 &&
+        static_cast<std::uint64_t>(header.length) <= static_cast<std::uint64_t>(fileSize) - sizeof(header);
+
+    std::vector<char> binary;
+    if (valid)
+    {
+        binary.resize(header.length);
+        file.read(binary.data(), header.length);
+        valid = file.gcount() == static_cast<std::streamsize>(header.length);
+    }
+    file.close();
+
+    // The driver has the final say, updates that keep the version string can still reject it
+    if (valid && shader.loadBinary(*WMOGLM, shaderType, header.binaryFormat, binary.data(), header.length))
+        return true;
+
+    SGL_Log("Discarding stale program binary: " + path, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_YELLOW);
+    std::remove(path.c_str());
+    return false;
+}
+
+/**
+ * @brief Saves the binary of a linked program under key, failures only cost the next startup a compile
+ *
+ * @param key Value returned by key()
+ * @param shader Linked monolithic or compute program
+ * @return nothing
+ */
+void SGL_ProgramCache::store(std::uint64_t key, const SGL_Shader &shader) const
+{
+    if (shader.ID == 0)
+        return;
+
+    GLint length = 0;
+    WMOGLM->getProgramiv(shader.ID, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    std::vector<char> binary(length);
+    GLenum binaryFormat = 0;
+    GLsizei written = 0;
+    WMOGLM->getProgramBinary(shader.ID, length, &written, &binaryFormat, binary.data());
+    if (written <= 0)
+        return;
+
+    ProgramEntryHeader header;
+    std::memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+    header.version = ENTRY_VERSION;
+    header.key = key;
+    header.binaryFormat = binaryFormat;
+    header.length = static_cast<std::uint32_t>(written);
+
+    const std::string path = entryPath(key);
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        SGL_Log("SGL_ProgramCache::store | Failed to write: " + path, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_YELLOW);
+        return;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), written);
+}
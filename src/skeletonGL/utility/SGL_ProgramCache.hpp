@@ -0,0 +1,74 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_ProgramCache.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief On disk cache of linked shader program binaries
+ *
+ * @section DESCRIPTION
+ *
+ * Linked programs are saved with glGetProgramBinary and reloaded with glProgramBinary,
+ * skipping the GLSL compiler entirely. Entries are keyed by a hash of the shader sources
+ * and the driver vendor, renderer and version strings so a driver update or an edited
+ * shader never reuses a stale binary. Drivers may still reject a binary, in which case
+ * the entry is deleted and the caller compiles from source.
+ */
+
+#ifndef SRC_SKELETONGL_UTILITY_PROGRAM_CACHE_HPP
+#define SRC_SKELETONGL_UTILITY_PROGRAM_CACHE_HPP
+
+// C++
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+// SkeletonGL
+#include "../renderer/SGL_OpenGLManager.hpp"
+#include "../renderer/SGL_Shader.hpp"
+#include "SGL_Utility.hpp"
+
+/**
+ * @brief Stores and restores program binaries, owned by the SGL_AssetManager
+ */
+class SGL_ProgramCache
+{
+private:
+    std::shared_ptr<SGL_OpenGLManager> WMOGLM;   ///< Window's OpenGL context
+    std::string pDirectory;                      ///< Where the binaries are written, ends with a slash
+    std::string pDriver;                         ///< Vendor, renderer and version, part of every key
+
+    // Full path of the entry for key
+    std::string entryPath(std::uint64_t key) const;
+
+    // Disable all copy and move constructors
+    SGL_ProgramCache(const SGL_ProgramCache&) = delete;
+    SGL_ProgramCache *operator = (const SGL_ProgramCache&) = delete;
+    SGL_ProgramCache(SGL_ProgramCache &&) = delete;
+    SGL_ProgramCache &operator = (SGL_ProgramCache &&) = delete;
+
+public:
+    // Constructor, creates the cache directory if needed
+    SGL_ProgramCache(std::shared_ptr<SGL_OpenGLManager> oglm, const std::string &directory, const SGL_DeviceInfo &deviceInfo);
+    // Destructor
+    ~SGL_ProgramCache();
+
+    // Hashes the sources of a program together with the driver strings
+    std::uint64_t key(const std::vector<std::string> &sources) const noexcept;
+    // Restores the program stored under key, returns false if missing, stale or rejected
+    bool load(std::uint64_t key, SHADER_TYPE shaderType, SGL_Shader &shader) const;
+    // Saves the binary of a linked program under key
+    void store(std::uint64_t key, const SGL_Shader &shader) const;
+};
+
+#endif // SRC_SKELETONGL_UTILITY_PROGRAM_CACHE_HPP
@@ -0,0 +1,355 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_Trace.cpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Scoped CPU timing zones exported as Chrome trace JSON
+ *
+ * @section DESCRIPTION
+ *
+ * See SGL_Trace.hpp
+ */
+
+#include "SGL_Trace.hpp"
+
+// C++
+#include <mutex>
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+
+std::atomic<bool> SGL_Tracer::pEnabled(false);
+std::atomic<std::uint64_t> SGL_Tracer::pClearedNs(0);
+const std::size_t SGL_Tracer::BUFFER_CAPACITY;
+
+/**
+ * @brief Every ring ever created, they outlive their threads
+ */
+struct SGL_TraceRegistry
+{
+    std::mutex lock;
+    std::vector<std::shared_ptr<SGL_TraceBuffer>> buffers;
+};
+
+static SGL_TraceRegistry &sglTraceRegistry()
+{
+    static SGL_TraceRegistry registry;
+    return registry;
+}
+
+/**
+ * @brief Writes a string as a JSON string literal
+ *
+ * @param out Stream
+ * @param text Text to escape
+ * @return nothing
+ */
+static void sglWriteJSONString(std::ostream &out, const char *text)
+{
+    out << '"';
+    for (const char *c = text; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+            out << '\\' << *c;
+        else if (static_cast<unsigned char>(*c) < 0x20)
+            out << ' ';
+        else
+            out << *c;
+    }
+    out << '"';
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param threadID Tracer assigned thread index
+ * @param capacity Zones kept, rounded up to a power of two
+ * @return nothing
+ */
+SGL_TraceBuffer::SGL_TraceBuffer(std::uint32_t threadID, std::size_t capacity)
+    : pClaimed(0), pWritten(0), pThreadID(threadID), pDepth(0)
+{
+    std::size_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+    pSlots.reset(new Slot[size]);
+    pMask = size - 1;
+    pThreadName = (threadID == 0) ? "main" : "thread " + std::to_string(threadID);
+}
+
+/**
+ * @brief Stores a finished zone, overwriting the oldest one once the ring is full
+ *
+ * @param name Zone name
+ * @param startNs Zone start
+ * @param durationNs Zone duration
+ * @param depth Nesting level
+ * @return nothing
+ */
+void SGL_TraceBuffer::push(const char *name, std::uint64_t startNs, std::uint64_t durationNs, std::uint32_t depth) noexcept
+{
+    const std::uint64_t index = pWritten.load(std::memory_order_relaxed);
+    pClaimed.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Slot &slot = pSlots[index & pMask];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.startNs.store(startNs, std::memory_order_relaxed);
+    slot.durationNs.store(durationNs, std::memory_order_relaxed);
+    slot.depth.store(depth, std::memory_order_relaxed);
+
+    pWritten.store(index + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Appends the zones that started at or after sinceNs, oldest first
+ *
+ * @param out Destination, existing contents are kept
+ * @param sinceNs Oldest start time to copy
+ * @return nothing
+ */
+void SGL_TraceBuffer::snapshot(std::vector<SGL_TraceEvent> &out, std::uint64_t sinceNs) const
+{
+    const std::uint64_t capacity = pMask + 1;
+    const std::uint64_t written = pWritten.load(std::memory_order_acquire);
+    const std::uint64_t first = (written > capacity) ? written - capacity : 0;
+
+    std::vector<std::pair<std::uint64_t, SGL_TraceEvent>> copied;
+    copied.reserve(written - first);
+    for (std::uint64_t i = first; i < written; ++i)
+    {
+        const Slot &slot = pSlots[i & pMask];
+        SGL_TraceEvent event;
+        event.name = slot.name.load(std::memory_order_relaxed);
+        event.startNs = slot.startNs.load(std::memory_order_relaxed);
+        event.durationNs = slot.durationNs.load(std::memory_order_relaxed);
+        event.depth = slot.depth.load(std::memory_order_relaxed);
+        event.threadID = pThreadID;
+        copied.push_back(std::make_pair(i, event));
+    }
+
+    // Anything the writer claimed while we were copying may be torn
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const std::uint64_t claimed = pClaimed.load(std::memory_order_relaxed);
+    const std::uint64_t valid = (claimed > capacity) ? claimed - capacity : 0;
+
+    for (const auto &entry : copied)
+        if (entry.first >= valid && entry.second.startNs >= sinceNs && entry.second.name != nullptr)
+            out.push_back(entry.second);
+}
+
+/**
+ * @brief Tracer assigned thread index
+ * @return std::uint32_t
+ */
+std::uint32_t SGL_TraceBuffer::threadID() const noexcept
+{
+    return pThreadID;
+}
+
+/**
+ * @brief Thread name shown by the trace viewers
+ * @return std::string
+ */
+const std::string &SGL_TraceBuffer::threadName() const noexcept
+{
+    return pThreadName;
+}
+
+/**
+ * @brief Zones kept before the oldest is overwritten
+ * @return std::size_t
+ */
+std::size_t SGL_TraceBuffer::capacity() const noexcept
+{
+    return pMask + 1;
+}
+
+/**
+ * @brief Ring of the calling thread, registered the first time the thread traces a zone
+ * @return SGL_TraceBuffer
+ */
+SGL_TraceBuffer &SGL_Tracer::threadBuffer()
+{
+    thread_local SGL_TraceBuffer *buffer = nullptr;
+    if (buffer == nullptr)
+    {
+        SGL_TraceRegistry &registry = sglTraceRegistry();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        registry.buffers.push_back(std::make_shared<SGL_TraceBuffer>(static_cast<std::uint32_t>(registry.buffers.size()), BUFFER_CAPACITY));
+        buffer = registry.buffers.back().get();
+    }
+    return *buffer;
+}
+
+/**
+ * @brief Starts or stops recording zones, zones already open when tracing stops are still recorded
+ * @param enable Record zones?
+ * @return nothing
+ */
+void SGL_Tracer::enable(bool enable) noexcept
+{
+    pEnabled.store(enable, std::memory_order_relaxed);
+}
+
+/**
+ * @brief steady_clock time in nanoseconds
+ * @return std::uint64_t
+ */
+std::uint64_t SGL_Tracer::now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Opens a zone on the calling thread
+ * @return std::uint64_t Zone start time
+ */
+std::uint64_t SGL_Tracer::beginZone() noexcept
+{
+    threadBuffer().pDepth++;
+    return now();
+}
+
+/**
+ * @brief Closes the innermost zone of the calling thread
+ *
+ * @param name Zone name
+ * @param startNs Value returned by beginZone()
+ * @return nothing
+ */
+void SGL_Tracer::endZone(const char *name, std::uint64_t startNs) noexcept
+{
+    const std::uint64_t end = now();
+    SGL_TraceBuffer &buffer = threadBuffer();
+    buffer.pDepth--;
+    buffer.push(name, startNs, end - startNs, buffer.pDepth);
+}
+
+/**
+ * @brief Names the calling thread in the exported trace
+ * @param name Thread name
+ * @return nothing
+ */
+void SGL_Tracer::setThreadName(const std::string &name)
+{
+    SGL_TraceBuffer &buffer = threadBuffer();
+    std::lock_guard<std::mutex> guard(sglTraceRegistry().lock);
+    buffer.pThreadName = name;
+}
+
+/**
+ * @brief Every recorded zone that started at or after sinceNs
+ * @param sinceNs Oldest start time, 0 for everything still in the rings
+ * @return std::vector<SGL_TraceEvent> Sorted by start time
+ */
+std::vector<SGL_TraceEvent> SGL_Tracer::collect(std::uint64_t sinceNs)
+{
+    std::vector<SGL_TraceEvent> events;
+    sinceNs = std::max(sinceNs, pClearedNs.load(std::memory_order_relaxed));
+    {
+        SGL_TraceRegistry &registry = sglTraceRegistry();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        for (const auto &buffer : registry.buffers)
+            buffer->snapshot(events, sinceNs);
+    }
+    std::sort(events.begin(), events.end(), [](const SGL_TraceEvent &a, const SGL_TraceEvent &b) {
+        return a.startNs < b.startNs;
+    });
+    return events;
+}
+
+/**
+ * @brief Ignores every zone recorded so far, the rings themselves are left to the writers
+ * @return nothing
+ */
+void SGL_Tracer::clear() noexcept
+{
+    pClearedNs.store(now(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Writes the recorded zones as Chrome Trace Event JSON
+ *
+ * @param out Stream
+ * @param sinceNs Oldest zone start to export
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * Zones are complete ("X") events, timestamps are microseconds relative to the oldest zone.
+ * Every traced thread gets a thread_name metadata event.
+ */
+void SGL_Tracer::writeChromeTrace(std::ostream &out, std::uint64_t sinceNs)
+{
+    const std::vector<SGL_TraceEvent> events = collect(sinceNs);
+    const std::uint64_t base = events.empty() ? 0 : events.front().startNs;
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    writeTraceEvents(out, events, base, first);
+    out << "\n]}\n";
+}
+
+/**
+ * @brief Writes every traced thread's name and the given zones as trace events
+ *
+ * @param out Stream, positioned inside a traceEvents array
+ * @param events Zones to write
+ * @param baseNs Time written as 0, the zones must not start before it
+ * @param first Is nothing written to the array yet? Updated as events are written
+ * @return nothing
+ */
+void SGL_Tracer::writeTraceEvents(std::ostream &out, const std::vector<SGL_TraceEvent> &events, std::uint64_t baseNs, bool &first)
+{
+    {
+        SGL_TraceRegistry &registry = sglTraceRegistry();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        for (const auto &buffer : registry.buffers)
+        {
+            out << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadID() << ",\"args\":{\"name\":";
+            sglWriteJSONString(out, buffer->threadName().c_str());
+            out << "}}";
+            first = false;
+        }
+    }
+
+    const std::streamsize precision = out.precision(3);
+    const std::ios_base::fmtflags flags = out.setf(std::ios_base::fixed, std::ios_base::floatfield);
+    for (const SGL_TraceEvent &event : events)
+    {
+        out << (first ? "\n" : ",\n") << "{\"name\":";
+        sglWriteJSONString(out, event.name);
+        out << ",\"cat\":\"SGL\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.threadID
+            << ",\"ts\":" << (static_cast<double>(event.startNs) - baseNs) / 1000.0 << ",\"dur\":" << event.durationNs / 1000.0 << "}";
+        first = false;
+    }
+    out.precision(precision);
+    out.flags(flags);
+}
+
+/**
+ * @brief Writes the recorded zones to a Chrome Trace Event JSON file
+ *
+ * @param path Output file, overwritten
+ * @param sinceNs Oldest zone start to export
+ * @return bool False if the file couldn't be written
+ */
+bool SGL_Tracer::dumpChromeTrace(const std::string &path, std::uint64_t sinceNs)
+{
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+        return false;
+    writeChromeTrace(file, sinceNs);
+    return file.good();
+}
@@ -0,0 +1,177 @@
+// ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+// ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+// ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+// ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+// ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+// ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+// Author:  AlexHG @ NEOHEX.XYZ
+// License: MIT License
+// Website: https://neohex.xyz
+
+/**
+ * @file    src/skeletonGL/utility/SGL_Trace.hpp
+ * @author  TSURA @ NEOHEX.XYZ
+ * @date    10/18/2026
+ * @version 1.0
+ *
+ * @brief Scoped CPU timing zones exported as Chrome trace JSON
+ *
+ * @section DESCRIPTION
+ *
+ * SGL_TRACE_ZONE("name") times the enclosing scope with std::chrono::steady_clock. Every
+ * thread writes its zones into its own fixed size ring, writing never locks nor allocates,
+ * the oldest zones are overwritten once a ring is full. dumpChromeTrace() writes every ring
+ * in the Chrome Trace Event format, open it with chrome://tracing or ui.perfetto.dev.
+ * Define SGL_DISABLE_TRACE to compile the zones out.
+ */
+
+#ifndef SRC_SKELETONGL_UTILITY_TRACE_HPP
+#define SRC_SKELETONGL_UTILITY_TRACE_HPP
+
+// C++
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <ostream>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief A finished zone
+ */
+struct SGL_TraceEvent
+{
+    const char *name;                         ///< Zone name, string literals only, the pointer is stored
+    std::uint64_t startNs;                    ///< steady_clock time the zone was entered
+    std::uint64_t durationNs;                 ///< Time spent inside the zone
+    std::uint32_t threadID;                   ///< Tracer assigned thread index, 0 is the first thread to trace
+    std::uint32_t depth;                      ///< Nesting level on its thread, 0 is outermost
+};
+
+/**
+ * @brief Ring of finished zones written by a single thread
+ * @section DESCRIPTION
+ *
+ * Only the owning thread writes, any thread may read. The writer claims a slot before touching
+ * it and publishes it afterwards, like a seqlock, a reader drops the slots that were claimed
+ * again while it was copying them, so reads never block the writer.
+ */
+class SGL_TraceBuffer
+{
+private:
+    struct Slot
+    {
+        std::atomic<const char *> name;
+        std::atomic<std::uint64_t> startNs;
+        std::atomic<std::uint64_t> durationNs;
+        std::atomic<std::uint32_t> depth;
+    };
+    std::unique_ptr<Slot[]> pSlots;           ///< Ring storage
+    std::size_t pMask;                        ///< Capacity - 1, the capacity is a power of two
+    std::atomic<std::uint64_t> pClaimed;      ///< Zones started being written, bumped before a slot is touched
+    std::atomic<std::uint64_t> pWritten;      ///< Zones completely written since the buffer was created
+    std::uint32_t pThreadID;                  ///< Tracer assigned thread index
+    std::string pThreadName;                  ///< Shown by the trace viewers
+    std::uint32_t pDepth;                     ///< Open zones, owner thread only
+
+    // Disable all copy and move constructors
+    SGL_TraceBuffer(const SGL_TraceBuffer&) = delete;
+    SGL_TraceBuffer *operator = (const SGL_TraceBuffer&) = delete;
+    SGL_TraceBuffer(SGL_TraceBuffer &&) = delete;
+    SGL_TraceBuffer &operator = (SGL_TraceBuffer &&) = delete;
+
+    friend class SGL_Tracer;
+
+public:
+    // Constructor, capacity is rounded up to a power of two
+    SGL_TraceBuffer(std::uint32_t threadID, std::size_t capacity);
+
+    // Stores a finished zone, owner thread only
+    void push(const char *name, std::uint64_t startNs, std::uint64_t durationNs, std::uint32_t depth) noexcept;
+    // Appends the zones that started at or after sinceNs, oldest first
+    void snapshot(std::vector<SGL_TraceEvent> &out, std::uint64_t sinceNs = 0) const;
+
+    std::uint32_t threadID() const noexcept;
+    const std::string &threadName() const noexcept;
+    std::size_t capacity() const noexcept;
+};
+
+/**
+ * @brief Process wide zone tracer
+ * @section DESCRIPTION
+ *
+ * Off by default, SGL_Window turns it on through cpu_trace in skeletongl.ini or toggleTrace().
+ * A thread's ring is created the first time it enters a zone while tracing is on and is kept
+ * after the thread exits so its zones can still be dumped.
+ */
+class SGL_Tracer
+{
+private:
+    static std::atomic<bool> pEnabled;        ///< Are zones being recorded?
+    static std::atomic<std::uint64_t> pClearedNs;///< Zones older than this are ignored
+
+    // Ring of the calling thread, created on first use
+    static SGL_TraceBuffer &threadBuffer();
+
+public:
+    // Zones per thread ring
+    static const std::size_t BUFFER_CAPACITY = 1 << 15;
+
+    // Start / stop recording zones
+    static void enable(bool enable) noexcept;
+    static bool enabled() noexcept { return pEnabled.load(std::memory_order_relaxed); }
+    // steady_clock time in nanoseconds, the zone time base
+    static std::uint64_t now() noexcept;
+
+    // Called by SGL_TraceZone
+    static std::uint64_t beginZone() noexcept;
+    static void endZone(const char *name, std::uint64_t startNs) noexcept;
+
+    // Name the calling thread in the exported trace
+    static void setThreadName(const std::string &name);
+    // Every recorded zone that started at or after sinceNs, sorted by start time
+    static std::vector<SGL_TraceEvent> collect(std::uint64_t sinceNs = 0);
+    // Ignore every zone recorded so far
+    static void clear() noexcept;
+
+    // Write the recorded zones as Chrome Trace Event JSON
+    static void writeChromeTrace(std::ostream &out, std::uint64_t sinceNs = 0);
+    // Write the thread names and events as members of a traceEvents array, first tracks the separator
+    static void writeTraceEvents(std::ostream &out, const std::vector<SGL_TraceEvent> &events, std::uint64_t baseNs, bool &first);
+    static bool dumpChromeTrace(const std::string &path, std::uint64_t sinceNs = 0);
+};
+
+/**
+ * @brief Records the lifetime of a scope as a zone, does nothing while tracing is off
+ */
+class SGL_TraceZone
+{
+private:
+    const char *pName;
+    std::uint64_t pStartNs;
+    bool pActive;
+
+    // Disable all copy and move constructors
+    SGL_TraceZone(const SGL_TraceZone&) = delete;
+    SGL_TraceZone *operator = (const SGL_TraceZone&) = delete;
+    SGL_TraceZone(SGL_TraceZone &&) = delete;
+    SGL_TraceZone &operator = (SGL_TraceZone &&) = delete;
+
+public:
+    explicit SGL_TraceZone(const char *name) noexcept
+        : pName(name), pStartNs(0), pActive(SGL_Tracer::enabled())
+        {
+            if (pActive)
+                pStartNs = SGL_Tracer::beginZone();
+        }
+    ~SGL_TraceZone() { if (pActive) SGL_Tracer::endZone(pName, pStartNs); }
+};
+
+#ifndef SGL_DISABLE_TRACE
+#define SGL_TRACE_ZONE(name) SGL_TraceZone sglTraceZone((name))
+#else
+#define SGL_TRACE_ZONE(name) ((void)0)
+#endif
+
+#endif // SRC_SKELETONGL_UTILITY_TRACE_HPP
@@ -26,6 +26,26 @@
 
 #include "SGL_Window.hpp"
 
+/**
+ * @brief Does the event come from a keyboard, mouse, joystick, gamepad or touch screen?
+ *
+ * @param type SDL event type
+ * @return bool False for window and system events
+ */
+static bool sglIsInputEvent(Uint32 type) noexcept
+{
+    switch (type)
+    {
+    case SDL_KEYDOWN: case SDL_KEYUP: case SDL_TEXTINPUT:
+    case SDL_MOUSEMOTION: case SDL_MOUSEBUTTONDOWN: case SDL_MOUSEBUTTONUP: case SDL_MOUSEWHEEL:
+    case SDL_JOYAXISMOTION: case SDL_JOYHATMOTION: case SDL_JOYBUTTONDOWN: case SDL_JOYBUTTONUP:
+    case SDL_CONTROLLERAXISMOTION: case SDL_CONTROLLERBUTTONDOWN: case SDL_CONTROLLERBUTTONUP:
+    case SDL_FINGERDOWN: case SDL_FINGERUP: case SDL_FINGERMOTION:
+        return true;
+    default:
+        return false;
+    }
+}
 
 /**
  * @brief Main and only constructor
@@ -39,6 +59,11 @@ SGL_Window::SGL_Window()
     // value after
     setLogLevel(LOG_LEVEL::SGL_DEBUG);
     pAlreadyInitialized = false;
+    pCameraMode = CAMERA_MODE::DEFAULT;
+    pInputThisFrame = false;
+    pFrameIdle = false;
+    pHasPresented = false;
+    pPPVariantKey = 0;
 }
 
 /**
@@ -70,6 +95,9 @@ void SGL_Window::destroyEverything()
     delete pIniParser;
     delete pCamera;
     delete pPostProcessorFBO;
+    // The asset manager outlives the OpenGL context, its programs are deleted while it still exists
+    if (assetManager)
+        assetManager->clearShaders();
 }
 
 /**
@@ -178,6 +206,78 @@ void SGL_Window::processIniFile(std::string path)
             pWindowCreationSpecs.showFPS = true;
     }
     SGL_Log("INI FILE show_fps = " + showFPSIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+    // Over budget threshold
+    std::string frameBudgetIni = pIniParser->getRawValue("[VIDEO]", "frame_budget_ms");
+    if (!frameBudgetIni.empty())
+        pWindowCreationSpecs.frameBudgetMs = std::stod(frameBudgetIni);
+    SGL_Log("INI FILE frame_budget_ms = " + frameBudgetIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+    // Idle frame skipping
+    std::string idleFrameSkipIni = pIniParser->getRawValue("[VIDEO]", "idle_frame_skip");
+    if (!idleFrameSkipIni.empty())
+    {
+        if (idleFrameSkipIni == "0")
+            pWindowCreationSpecs.idleFrameSkip = false;
+        else
+            pWindowCreationSpecs.idleFrameSkip = true;
+    }
+    SGL_Log("INI FILE idle_frame_skip = " + idleFrameSkipIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+    // Frames in flight
+    std::string framesInFlightIni = pIniParser->getRawValue("[VIDEO]", "frames_in_flight");
+    if (!framesInFlightIni.empty())
+        pWindowCreationSpecs.framesInFlight = std::max(1, pIniParser->getIntValue("[VIDEO]", "frames_in_flight"));
+    SGL_Log("INI FILE frames_in_flight = " + framesInFlightIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+    // [DEBUG]
+    // OpenGL debug output
+    std::string glDebugIni = pIniParser->getRawValue("[DEBUG]", "gl_debug");
+    if (!glDebugIni.empty())
+        pWindowCreationSpecs.glDebug = (glDebugIni != "0");
+    SGL_Log("INI FILE gl_debug = " + glDebugIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+    // Least severe message reported
+    std::string glDebugSeverityIni = pIniParser->getRawValue("[DEBUG]", "gl_debug_severity");
+    if (glDebugSeverityIni == "high")
+        pWindowCreationSpecs.glDebugSeverity = GL_DEBUG_SEVERITY_HIGH;
+    else if (glDebugSeverityIni == "medium")
+        pWindowCreationSpecs.glDebugSeverity = GL_DEBUG_SEVERITY_MEDIUM;
+    else if (glDebugSeverityIni == "low")
+        pWindowCreationSpecs.glDebugSeverity = GL_DEBUG_SEVERITY_LOW;
+    else if (glDebugSeverityIni == "notification")
+        pWindowCreationSpecs.glDebugSeverity = GL_DEBUG_SEVERITY_NOTIFICATION;
+    SGL_Log("INI FILE gl_debug_severity = " + glDebugSeverityIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+    // GPU timer queries
+    std::string gpuTimersIni = pIniParser->getRawValue("[DEBUG]", "gpu_timers");
+    if (!gpuTimersIni.empty())
+        pWindowCreationSpecs.gpuTimers = (gpuTimersIni != "0");
+    SGL_Log("INI FILE gpu_timers = " + gpuTimersIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+    // Frame counters overlay
+    std::string statsOverlayIni = pIniParser->getRawValue("[DEBUG]", "stats_overlay");
+    if (!statsOverlayIni.empty())
+        pWindowCreationSpecs.statsOverlay = (statsOverlayIni != "0");
+    SGL_Log("INI FILE stats_overlay = " + statsOverlayIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+    // CPU zone tracer
+    std::string cpuTraceIni = pIniParser->getRawValue("[DEBUG]", "cpu_trace");
+    if (!cpuTraceIni.empty())
+        pWindowCreationSpecs.cpuTrace = (cpuTraceIni != "0");
+    SGL_Log("INI FILE cpu_trace = " + cpuTraceIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+
+    std::string hitchThresholdIni = pIniParser->getRawValue("[DEBUG]", "hitch_threshold_ms");
+    if (!hitchThresholdIni.empty())
+        pWindowCreationSpecs.hitchThresholdMs = std::stod(hitchThresholdIni);
+    SGL_Log("INI FILE hitch_threshold_ms = " + hitchThresholdIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+
+    std::string hitchHistoryIni = pIniParser->getRawValue("[DEBUG]", "hitch_history_s");
+    if (!hitchHistoryIni.empty())
+        pWindowCreationSpecs.hitchHistory = std::stod(hitchHistoryIni);
+    SGL_Log("INI FILE hitch_history_s = " + hitchHistoryIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+
+    std::string hitchDirIni = pIniParser->getRawValue("[DEBUG]", "hitch_output_dir");
+    if (!hitchDirIni.empty())
+        pWindowCreationSpecs.hitchDir = hitchDirIni;
+    SGL_Log("INI FILE hitch_output_dir = " + hitchDirIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
+    // Overdraw heatmap
+    std::string overdrawIni = pIniParser->getRawValue("[DEBUG]", "overdraw");
+    if (!overdrawIni.empty())
+        pWindowCreationSpecs.overdraw = (overdrawIni != "0");
+    SGL_Log("INI FILE overdraw = " + overdrawIni, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_BLUE);
     // [INPUT]
     // Gamepad ID shouldn't be higher than 4
     int main_gamepad_id = pIniParser->getIntValue("[INPUT]", "main_gamepad_id");
@@ -326,6 +426,9 @@ void SGL_Window::start()
     // hardware accel: set to 1 to require hardware acceleration set
     // to 0 to force software rendering; defaults to allow either
     SDL_GL_SetAttribute(SDL_GL_ACCELERATED_VISUAL, 1);
+    // Drivers only report the full set of debug messages on debug contexts
+    if (pWindowCreationSpecs.glDebug)
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
     this->pGLContext = SDL_GL_CreateContext(pWindow);
     if(this->pGLContext == NULL)
     {
@@ -359,6 +462,18 @@ void SGL_Window::start()
     toggleVSYNC(pWindowCreationSpecs.enableVSYNC);
 
     pOGLM = std::make_shared<SGL_OpenGLManager>();
+    pOGLM->enableFrameHashing(pWindowCreationSpecs.idleFrameSkip);
+    pOGLM->setFramesInFlight(pWindowCreationSpecs.framesInFlight);
+    // Before any buffer is created so they're all labeled
+    if (pWindowCreationSpecs.glDebug)
+        pOGLM->enableDebugOutput(true, pWindowCreationSpecs.glDebugSeverity);
+    if (pWindowCreationSpecs.gpuTimers)
+        pOGLM->enableGPUTimers(true);
+    pFlightRecorder.setHistory(pWindowCreationSpecs.hitchHistory);
+    pFlightRecorder.setDirectory(pWindowCreationSpecs.hitchDir);
+    pFlightRecorder.setThreshold(pWindowCreationSpecs.hitchThresholdMs);
+    // The flight recorder dumps the zones too, keep recording them while it's armed
+    SGL_Tracer::enable(pWindowCreationSpecs.cpuTrace || pFlightRecorder.enabled());
 
     // Invalid enumerant error as there is yet details to configure, its normal
     pOGLM->checkForGLErrors();
@@ -436,6 +551,8 @@ void SGL_Window::start()
             {
                 pWindowCreationSpecs.fullscreenW = dMode.w;
                 pWindowCreationSpecs.fullscreenH = dMode.h;
+                if (dMode.refresh_rate > 0)
+                    pWindowCreationSpecs.refreshRate = dMode.refresh_rate;
             }
             SGL_Log("Display #" + std::to_string(i) +
                         " current display mode is " + std::to_string(dMode.w) +
@@ -444,6 +561,11 @@ void SGL_Window::start()
         }
     }
     SGL_Log("Using display #" + std::to_string(currentDisplay), LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    // Vsynced frames jitter around the refresh period, only count the ones that clearly missed it
+    if (pWindowCreationSpecs.frameBudgetMs > 0.0)
+        pFrameStats.setBudget(pWindowCreationSpecs.frameBudgetMs);
+    else
+        pFrameStats.setBudget(1.5 * 1000.0 / pWindowCreationSpecs.refreshRate);
     pWindowCreationSpecs.displayID = currentDisplay;
 
     // --- DEFAULT ASSET LOADING ---
@@ -470,6 +592,12 @@ void SGL_Window::start()
     // Configure renderer
     //this->pClearScreen = {1.0f, 1.0f, 1.0f, 1.0f};
     renderer = std::make_unique<SGL_Renderer>(pOGLM, assetManager->getTexture(SGL::DEFAULT_TEXTURE_NAME), assetManager->getShader("line"), assetManager->getShader("point"), assetManager->getShader("text"), assetManager->getShader("spriteUV"), assetManager->getShader("spriteBatchUV"), assetManager->getShader("pixelBatch"), assetManager->getShader("lineBatch"));
+    if (pOGLM->computeShaderSupported())
+        renderer->setCullingShader(assetManager->getShader("cullInstances"));
+    renderer->setBitmapTextBatchShader(assetManager->getShader("bitmapTextBatch"));
+    pOverlayShader = assetManager->getShader("bitmapTextBatch");
+    pOverlayFont = assetManager->getTexture("defaultBitmapFont");
+    renderer->setAssetManager(assetManager.get());
     SGL_Log("Renderer configured.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
     // Setup the post processor
     this->startFBO(pDefaultPPShader);
@@ -514,6 +642,8 @@ void SGL_Window::start()
     this->setWindowIcon(pixels);
 
     pDeltaTimeMS = 0.0f;
+    pLastFrameEnd = std::chrono::steady_clock::now();
+    pLastTitleUpdate = pLastFrameEnd;
 
     SGL_Log("<--- SkeletonGL rendering engine successfully loaded and configured --->", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_GREEN);
     pAlreadyInitialized = true;
@@ -526,6 +656,7 @@ void SGL_Window::start()
  */
 void SGL_Window::updateCamera(bool forceUpdate)
 {
+    SGL_TRACE_ZONE("SGL_Window::updateCamera");
     this->pCamera->updateCamera(forceUpdate);
 }
 
@@ -570,17 +701,25 @@ void SGL_Window::setLogLevel(LOG_LEVEL logLevel)
  */
 void SGL_Window::setCameraMode(CAMERA_MODE mode)
 {
+    SGL_TRACE_ZONE("SGL_Window::setCameraMode");
+    // Queued batches were recorded under the current projection
+    if (renderer)
+        renderer->flushIndirectBatches();
+
     /*  Camera is active, apply the offset to the projection matrix */
     // Attempt to iterate all the required shaders, the PP doesn't require any MVP transformations
     // since it simply blits the final FBO texture to the screen
     for (auto iter = assetManager->shaderTypes.begin(); iter != assetManager->shaderTypes.end(); ++iter)
     {
-        if (assetManager->getShader((*iter).first).shaderType != SHADER_TYPE::POST_PROCESSOR)
+        SGL_Shader shader = assetManager->getShader((*iter).first);
+        // Pipelines are covered by their stage programs, which are updated on their own
+        if (shader.shaderType != SHADER_TYPE::POST_PROCESSOR && shader.pipeline == 0)
         {
-            this->pCamera->cameraMode(assetManager->getShader((*iter).first), mode);
+            this->pCamera->cameraMode(shader, mode);
             //SGL_Log("Updating shader: " + (*iter).first);
         }
     }
+    this->pCameraMode = mode;
 }
 
 
@@ -640,6 +779,8 @@ void SGL_Window::setClearColor(const SGL_Color &color)
  */
 void SGL_Window::setWindowTitle(const std::string &newTitle)
 {
+    // Kept so show_fps can append to it
+    pWindowCreationSpecs.windowTitle = newTitle;
     SDL_SetWindowTitle(pWindow, newTitle.c_str());
 }
 
@@ -781,6 +922,7 @@ void SGL_Window::checkGamepads(int gamepadID)
  */
 SGL_InputFrame SGL_Window::getFrameInput()
 {
+    SGL_TRACE_ZONE("SGL_Window::getFrameInput");
     // Feel free to remove all the input your program won't need from the checklist
     SGL_InputFrame input;
 
@@ -795,8 +937,33 @@ SGL_InputFrame SGL_Window::getFrameInput()
     input.mouse.cursorXNormalized = std::floor(xPos * static_cast<float>(pWindowCreationSpecs.internalW));
     input.mouse.cursorYNormalized = std::floor(yPos * static_cast<float>(pWindowCreationSpecs.internalH));
 
+    // SDL stamps events in milliseconds when it queues them, map them onto the steady clock
+    std::chrono::steady_clock::time_point pumpTime = std::chrono::steady_clock::now();
+    Uint32 pumpTicks = SDL_GetTicks();
+
     while(SDL_PollEvent(&pEvent) != 0)
     {
+        // Any event at all (window, input or otherwise) invalidates idle frame detection
+        pInputThisFrame = true;
+
+        if (sglIsInputEvent(pEvent.type))
+        {
+            std::int32_t queuedMs = std::max<std::int32_t>(0, static_cast<std::int32_t>(pumpTicks - pEvent.common.timestamp));
+            pInputLatency.input(pumpTime - std::chrono::milliseconds(queuedMs));
+        }
+
+        if (pFlightRecorder.enabled())
+        {
+            std::int32_t code = 0;
+            if (pEvent.type == SDL_KEYDOWN || pEvent.type == SDL_KEYUP)
+                code = pEvent.key.keysym.sym;
+            else if (pEvent.type == SDL_MOUSEBUTTONDOWN || pEvent.type == SDL_MOUSEBUTTONUP)
+                code = pEvent.button.button;
+            else if (pEvent.type == SDL_WINDOWEVENT)
+                code = pEvent.window.event;
+            pFlightRecorder.recordInput(pEvent.type, code);
+        }
+
         // Note about SDL_QUIT:
         // This event can raise from a variety of different sources and is OS dependant, in UNIX systems
         // all signals (SIGINT, SIGTERM etc.) that aren't directly addressed will also throw an SDL_QUIT
@@ -1001,6 +1168,7 @@ void SGL_Window::startFBO(const SGL_Shader &shader)
     // Start the FBO
     this->pPostProcessorFBO = new SGL_PostProcessor(pOGLM, shader);
     this->pPostProcessorFBO->reload(pWindowCreationSpecs.currentW, pWindowCreationSpecs.currentH);
+    this->pPostProcessorFBO->enableOverdraw(pWindowCreationSpecs.overdraw);
     this->checkForErrors();
     SGL_Log("Done", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
 }
@@ -1016,6 +1184,9 @@ void SGL_Window::startFrame()
     // pChrono0 = std::chrono::high_resolution_clock::now();
     pChrono0 = std::chrono::steady_clock::now();
 
+    // Shaders finishing in the background receive the uniforms (projection included) set while pending
+    if (assetManager->shadersPending())
+        assetManager->pollPendingShaders();
 
     // Begin FBO operations
     this->pPostProcessorFBO->beginRender();
@@ -1028,6 +1199,41 @@ void SGL_Window::startFrame()
  */
 void SGL_Window::endFrame()
 {
+    SGL_TRACE_ZONE("SGL_Window::endFrame");
+    // Submit any queued multi-draw batches before the frame is hashed and composited
+    renderer->flushIndirectBatches();
+
+    // A frame is idle when it issued the exact same OpenGL commands as the last one, there was
+    // no input and no time based post processor effect is running. The hash restarts here instead
+    // of in startFrame(), state the application sets between frames (camera projection, uniforms,
+    // uploads) belongs to the next frame's hash
+    const bool repeated = pOGLM->closeFrameHash();
+    pFrameIdle = pWindowCreationSpecs.idleFrameSkip && pHasPresented && !pInputThisFrame && repeated &&
+        !pPostProcessorFBO->confuse && !pPostProcessorFBO->chaos && !pPostProcessorFBO->shake;
+    pInputThisFrame = false;
+
+    if (pFrameIdle)
+    {
+        // The resolved texture and the front buffer already hold this frame, skip the
+        // resolve, the post processor pass and the swap
+        pOGLM->unbindFBO();
+        pChrono1 = std::chrono::steady_clock::now();
+        pDeltaTimeMS = std::chrono::duration_cast<std::chrono::nanoseconds>(pChrono1 - pChrono0).count() / 1000000000.0;
+
+        // Without a swap there's no vsync to block on, wait out the refresh period instead of spinning
+        std::chrono::microseconds framePeriod(1000000 / pWindowCreationSpecs.refreshRate);
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(pChrono1 - pChrono0);
+        if (elapsed < framePeriod)
+            std::this_thread::sleep_for(framePeriod - elapsed);
+        // Still retire finished frames so deferred deletions don't pile up
+        pOGLM->fenceFrame();
+        pInputLatency.retired(pOGLM->framesRetired(), std::chrono::steady_clock::now());
+        this->recordFrame(pChrono1);
+        // The unbind above is the window's own, keep it out of the next hash
+        pOGLM->resetFrameHash();
+        return;
+    }
+
     // End all rendering operations
     this->pPostProcessorFBO->endRender();
 
@@ -1043,10 +1249,90 @@ void SGL_Window::endFrame()
     pDefaultPPShader.renderDetails.mousePosX = pDeltaInput.mouse.cursorXNormalized;
     pDefaultPPShader.renderDetails.mousePosY = pDeltaInput.mouse.cursorYNormalized;
 
-    // Render final FBO texture
-    this->pPostProcessorFBO->render(pDefaultPPShader);
+    // Render final FBO texture, the built-in effects are permutations of the default post
+    // processor compiled on first use, custom post processor shaders are used as they are
+    // except for the overdraw view, which only the built-in one can decode
+    std::uint32_t effects = this->pPostProcessorFBO->variantKey();
+    if (effects != 0 && (pDefaultPPShader.name == "postProcessor" || (effects & SGL_PP_VARIANT::OVERDRAW)))
+    {
+        // Only resolved again when the effects change, every other frame just patches renderDetails
+        if (effects != pPPVariantKey)
+        {
+            pPPVariant = assetManager->getShaderVariant("postProcessor", effects);
+            pPPVariantKey = effects;
+        }
+        pPPVariant.renderDetails = pDefaultPPShader.renderDetails;
+        this->pPostProcessorFBO->render(pPPVariant);
+    }
+    else
+        this->pPostProcessorFBO->render(pDefaultPPShader);
+    // Drawn straight to the default framebuffer after the post processor, so the effects and the
+    // overdraw view don't touch it and the idle frame hash never sees its ever changing text
+    if (pWindowCreationSpecs.statsOverlay)
+        this->renderStatsOverlay();
     // Finally, swap the buffers
-    SDL_GL_SwapWindow(this->pWindow);
+    std::chrono::steady_clock::time_point swapStart = std::chrono::steady_clock::now();
+    {
+        SGL_TRACE_ZONE("SDL_GL_SwapWindow");
+        SDL_GL_SwapWindow(this->pWindow);
+    }
+    std::chrono::steady_clock::time_point swapEnd = std::chrono::steady_clock::now();
+    pHasPresented = true;
+    // The post processor pass and the overlay are the window's own, keep them out of the next hash
+    pOGLM->resetFrameHash();
+    // Keep the CPU at most framesInFlight frames ahead of the GPU
+    {
+        SGL_TRACE_ZONE("SGL_OpenGLManager::fenceFrame");
+        pOGLM->fenceFrame();
+    }
+    // This frame is the first to show the pending input, its fence tells when the GPU finished it
+    pInputLatency.present(swapEnd, pOGLM->fenceSyncSupported() ? pOGLM->framesFenced() : 0);
+    pInputLatency.retired(pOGLM->framesRetired(), std::chrono::steady_clock::now());
+    this->recordFrame(swapStart);
+}
+
+/**
+ * @brief Stores the timings of the frame that just ended
+ * @param swapStart When the buffer swap, or the idle frame wait, began
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * The update phase runs from the end of the previous frame to startFrame(), it covers input
+ * polling and the game logic. The swap phase includes vsync and the frames in flight wait.
+ */
+void SGL_Window::recordFrame(std::chrono::steady_clock::time_point swapStart)
+{
+    typedef std::chrono::duration<double, std::milli> milliseconds;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    pOGLM->endFrameCounters();
+
+    SGL_FrameSample sample;
+    sample.frameMs = milliseconds(now - pLastFrameEnd).count();
+    sample.updateMs = milliseconds(pChrono0 - pLastFrameEnd).count();
+    sample.renderMs = milliseconds(swapStart - pChrono0).count();
+    sample.swapMs = milliseconds(now - swapStart).count();
+    pFrameStats.push(sample);
+    pLastFrameEnd = now;
+
+    if (pFlightRecorder.recordFrame(sample, pOGLM->getFrameCounters()))
+        SGL_Log("Hitch of " + std::to_string(sample.frameMs) + " ms, flight recorder written to " + pFlightRecorder.lastDump(),
+                LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_YELLOW);
+
+    if (pWindowCreationSpecs.showFPS && now - pLastTitleUpdate >= std::chrono::seconds(1))
+    {
+        std::string title = pWindowCreationSpecs.windowTitle + " | " + pFrameStats.summary();
+        if (pInputLatency.size() > 0)
+            title += " | " + pInputLatency.summary();
+        if (pPostProcessorFBO->overdrawEnabled())
+        {
+            const SGL_OverdrawStats &overdraw = pPostProcessorFBO->getOverdrawStats();
+            char buffer[64];
+            std::snprintf(buffer, sizeof(buffer), " | overdraw avg %.2f max %u", overdraw.average, overdraw.max);
+            title += buffer;
+        }
+        SDL_SetWindowTitle(pWindow, title.c_str());
+        pLastTitleUpdate = now;
+    }
 }
 
 
@@ -1060,6 +1346,41 @@ double SGL_Window::getRenderDeltaTime() const
     //return pChronoDeltaTime;
 }
 
+/**
+ * @brief Timings of the last frames
+ * @return SGL_FrameStats
+ * @section DESCRIPTION
+ *
+ * Unlike getRenderDeltaTime() the samples cover the whole frame, split into update, CPU
+ * render and swap, see SGL_FrameStats::report() for percentiles and over budget frames.
+ */
+const SGL_FrameStats &SGL_Window::getFrameStats() const
+{
+    return pFrameStats;
+}
+
+/**
+ * @brief Sets the frame time budget used to count slow frames
+ * @param budgetMs Milliseconds, defaults to 1.5 display refresh periods
+ * @return nothing
+ */
+void SGL_Window::setFrameBudget(double budgetMs)
+{
+    pFrameStats.setBudget(budgetMs);
+}
+
+/**
+ * @brief Shows or hides the frame statistics in the window title
+ * @param enable Append the statistics to the title once per second?
+ * @return nothing
+ */
+void SGL_Window::toggleShowFPS(bool enable)
+{
+    pWindowCreationSpecs.showFPS = enable;
+    if (!enable)
+        SDL_SetWindowTitle(pWindow, pWindowCreationSpecs.windowTitle.c_str());
+}
+
 /**
  * @brief Toggle the screen shake post processor effect
  * @param shakeit Bool to enable / disable
@@ -1116,6 +1437,8 @@ void SGL_Window::pLoadDefaultAssets()
 {
     SGL_Log("<--- Default assets --->", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_GREEN);
     assetManager = std::make_unique<SGL_AssetManager>(pOGLM);
+    // Every program loaded from here on is restored from its binary when the sources and driver haven't changed
+    assetManager->enableProgramCache(FOLDER_STRUCTURE::shaderCacheDir, *hostData);
 
     std::string blankSquare = FOLDER_STRUCTURE::imagesDir + "blank_square.png";
     std::string bmpFont = FOLDER_STRUCTURE::imagesDir + "default_bitmap_font.png";
@@ -1147,18 +1470,47 @@ void SGL_Window::pLoadDefaultAssets()
     std::string pixelBatchF = FOLDER_STRUCTURE::shadersDir + "pixelBatchF.c";
     std::string lineBatchV = FOLDER_STRUCTURE::shadersDir + "lineBatchV.c";
     std::string lineBatchF = FOLDER_STRUCTURE::shadersDir + "lineBatchF.c";
+    std::string bitmapTextBatchV = FOLDER_STRUCTURE::shadersDir + "bitmapTextBatchV.c";
+    std::string bitmapTextBatchF = FOLDER_STRUCTURE::shadersDir + "bitmapTextBatchF.c";
 
-    assetManager->loadShaders(spriteUVV.c_str(), spriteUVF.c_str(), nullptr, "spriteUV", SHADER_TYPE::SPRITE);
-    assetManager->loadShaders(spriteBatchUVV.c_str(), spriteBatchUVF.c_str(), nullptr, "spriteBatchUV", SHADER_TYPE::SPRITE);
-    assetManager->loadShaders(textV.c_str(), textF.c_str(), nullptr, "text", SHADER_TYPE::TEXT);
-    assetManager->loadShaders(lineV.c_str(), lineF.c_str(), nullptr, "line", SHADER_TYPE::LINE);
-    assetManager->loadShaders(pointV.c_str(), pointF.c_str(), nullptr, "point", SHADER_TYPE::PIXEL);
-    assetManager->loadShaders(FBOshaderV.c_str(), FBOshaderF.c_str(), nullptr, "postProcessor", SHADER_TYPE::POST_PROCESSOR);
-    assetManager->loadShaders(pixelBatchV.c_str(), pixelBatchF.c_str(), nullptr, "pixelBatch", SHADER_TYPE::PIXEL);
-    assetManager->loadShaders(lineBatchV.c_str(), lineBatchF.c_str(), nullptr, "lineBatch", SHADER_TYPE::LINE);
+    // Both sprite renderers share one fragment stage when separable programs are available,
+    // custom sprite effects can then pair their own fragment stage with "spriteStageV"
+    if (pOGLM->separableProgramsSupported())
+    {
+        std::string spriteStageV = FOLDER_STRUCTURE::shadersDir + "spriteStageV.c";
+        std::string spriteBatchStageV = FOLDER_STRUCTURE::shadersDir + "spriteBatchStageV.c";
+        std::string spriteStageF = FOLDER_STRUCTURE::shadersDir + "spriteStageF.c";
+        assetManager->loadShaderStage(spriteStageV.c_str(), GL_VERTEX_SHADER, "spriteStageV");
+        assetManager->loadShaderStage(spriteBatchStageV.c_str(), GL_VERTEX_SHADER, "spriteBatchStageV");
+        assetManager->loadShaderStage(spriteStageF.c_str(), GL_FRAGMENT_SHADER, "spriteStageF");
+        assetManager->loadShaderPipeline("spriteStageV", "spriteStageF", "spriteUV", SHADER_TYPE::SPRITE);
+        assetManager->loadShaderPipeline("spriteBatchStageV", "spriteStageF", "spriteBatchUV", SHADER_TYPE::SPRITE);
+    }
+    else
+    {
+        assetManager->queueShaders(spriteUVV.c_str(), spriteUVF.c_str(), nullptr, "spriteUV", SHADER_TYPE::SPRITE);
+        assetManager->queueShaders(spriteBatchUVV.c_str(), spriteBatchUVF.c_str(), nullptr, "spriteBatchUV", SHADER_TYPE::SPRITE);
+    }
+    assetManager->queueShaders(textV.c_str(), textF.c_str(), nullptr, "text", SHADER_TYPE::TEXT);
+    assetManager->queueShaders(lineV.c_str(), lineF.c_str(), nullptr, "line", SHADER_TYPE::LINE);
+    assetManager->queueShaders(pointV.c_str(), pointF.c_str(), nullptr, "point", SHADER_TYPE::PIXEL);
+    assetManager->queueShaders(FBOshaderV.c_str(), FBOshaderF.c_str(), nullptr, "postProcessor", SHADER_TYPE::POST_PROCESSOR, SGL_PP_VARIANT::DEFINES);
+    assetManager->queueShaders(pixelBatchV.c_str(), pixelBatchF.c_str(), nullptr, "pixelBatch", SHADER_TYPE::PIXEL);
+    assetManager->queueShaders(lineBatchV.c_str(), lineBatchF.c_str(), nullptr, "lineBatch", SHADER_TYPE::LINE);
+    assetManager->queueShaders(bitmapTextBatchV.c_str(), bitmapTextBatchF.c_str(), nullptr, "bitmapTextBatch", SHADER_TYPE::SPRITE);
+    // Programs the driver hasn't finished yet are swapped for a placeholder until startFrame() sees them ready
+    assetManager->compileQueuedShaders();
+
+    // GPU culling for sprite layers, also receives the camera projection like any other shader
+    if (pOGLM->computeShaderSupported())
+    {
+        std::string cullInstancesC = FOLDER_STRUCTURE::shadersDir + "cullInstancesC.c";
+        assetManager->loadComputeShader(cullInstancesC.c_str(), "cullInstances");
+    }
 
     pDefaultPPShader = assetManager->getShader("postProcessor");
-    SGL_Log("Default shaders compiled and linked.", LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    SGL_Log(assetManager->shadersPending() ? "Default shaders submitted, finishing in the background." : "Default shaders compiled and linked.",
+            LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
     pOGLM->checkForGLErrors();
 }
 
@@ -1235,3 +1587,329 @@ void SGL_Window::toggleLineAA(bool toggle)
     else
         pOGLM->disable(GL_LINE_SMOOTH);
 }
+
+
+/**
+ * @brief Creates a cached render layer with the same resolution as the post processor
+ * @param name Layer identifier
+ * @param refreshRate Forced redraws per second, 0 to only redraw when marked dirty
+ * @return std::unique_ptr<SGL_RenderLayer>
+ */
+std::unique_ptr<SGL_RenderLayer> SGL_Window::createRenderLayer(const std::string &name, float refreshRate)
+{
+    return std::unique_ptr<SGL_RenderLayer>(new SGL_RenderLayer(pOGLM, name, pWindowCreationSpecs.currentW,
+                                                                pWindowCreationSpecs.currentH, refreshRate));
+}
+
+/**
+ * @brief Redirects all rendering into the layer if it needs to be redrawn
+ * @param layer The layer to render into
+ * @return bool True if the layer must be redrawn, false if the cached copy is still valid
+ * @section DESCRIPTION
+ *
+ * Must be called between startFrame() and endFrame(), skip the layer's render calls
+ * when it returns false:
+ *     if (window->beginRenderLayer(*bg)) { ...renders...; window->endRenderLayer(*bg); }
+ *     window->renderLayer(*bg);
+ */
+bool SGL_Window::beginRenderLayer(SGL_RenderLayer &layer)
+{
+    if (!layer.needsRefresh(std::chrono::steady_clock::now()))
+        return false;
+
+    renderer->flushIndirectBatches();
+    layer.begin();
+    return true;
+}
+
+/**
+ * @brief Marks the layer as up to date and resumes rendering into the post processor
+ * @param layer The layer that was being rendered
+ * @return nothing
+ */
+void SGL_Window::endRenderLayer(SGL_RenderLayer &layer)
+{
+    renderer->flushIndirectBatches();
+    layer.end();
+    this->pPostProcessorFBO->resumeRender();
+    // The layer cleared with its own color, restore the frame's
+    pOGLM->setClearColor(pClearScreen);
+}
+
+/**
+ * @brief Composites the cached layer over the current frame as a single quad
+ * @param layer The layer to draw
+ * @return nothing
+ */
+void SGL_Window::renderLayer(const SGL_RenderLayer &layer)
+{
+    SGL_Sprite composite;
+    composite.position = glm::vec2(0.0f);
+    composite.size = glm::vec2(pWindowCreationSpecs.internalW, pWindowCreationSpecs.internalH);
+    composite.color = {1.0f, 1.0f, 1.0f, 1.0f};
+    composite.texture = layer.getTexture();
+    composite.shader = assetManager->getShader("spriteUV");
+    composite.blending = BLENDING_TYPE::DEFAULT_RENDERING;
+    // FBO textures share the y-axis convention of stb flipped textures, the regular UVs apply
+    composite.resetUVCoords();
+
+    // The layer already contains the camera transform, draw it in screen space
+    if (pCameraMode != CAMERA_MODE::OVERLAY)
+        this->pCamera->cameraMode(composite.shader, CAMERA_MODE::OVERLAY);
+    renderer->renderSprite(composite);
+    if (pCameraMode != CAMERA_MODE::OVERLAY)
+        this->pCamera->cameraMode(composite.shader, pCameraMode);
+}
+
+/**
+ * @brief Enables idle frame skipping
+ * @param enable Skip frames identical to the previous one?
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * When enabled the OpenGL manager hashes every command issued during the frame, if endFrame()
+ * finds the same hash as the previous frame and getFrameInput() polled no events, the frame
+ * isn't resolved, post processed nor swapped. Apps that never call getFrameInput() count as idle.
+ */
+void SGL_Window::toggleIdleFrameSkip(bool enable)
+{
+    pWindowCreationSpecs.idleFrameSkip = enable;
+    pOGLM->enableFrameHashing(enable);
+    pHasPresented = false;
+}
+
+/**
+ * @brief Was the last frame skipped because nothing changed?
+ * @return bool
+ */
+bool SGL_Window::isFrameIdle() const
+{
+    return pFrameIdle;
+}
+
+/**
+ * @brief Turns the OpenGL debug output on and off
+ * @param enable Report KHR_debug messages?
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * While enabled driver messages are logged as they happen together with the SGL function that
+ * issued the offending call, and checkForErrors() no longer polls glGetError. Objects created
+ * while it's disabled aren't labeled.
+ */
+void SGL_Window::toggleGLDebug(bool enable)
+{
+    pWindowCreationSpecs.glDebug = enable;
+    pOGLM->enableDebugOutput(enable, pWindowCreationSpecs.glDebugSeverity);
+}
+
+/**
+ * @brief Turns GPU timing of the renderer and post processor on and off
+ * @param enable Time render passes?
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * Every renderer call and post processor pass issues a timer query while enabled, the
+ * results are read a few frames later so they never stall the pipeline, see getGPUTimers().
+ */
+void SGL_Window::toggleGPUTimers(bool enable)
+{
+    pOGLM->enableGPUTimers(enable);
+    pWindowCreationSpecs.gpuTimers = pOGLM->gpuTimersEnabled();
+}
+
+/**
+ * @brief GPU time spent per render pass
+ * @return std::vector<SGL_GPUTimerStats>
+ */
+const std::vector<SGL_GPUTimerStats> &SGL_Window::getGPUTimers() const
+{
+    return pOGLM->getGPUTimers();
+}
+
+/**
+ * @brief Draw calls, state changes and uploads issued during the last complete frame
+ * @return SGL_FrameCounters
+ * @section DESCRIPTION
+ *
+ * Counted by the OpenGL manager, so they cover the renderer, the post processor and any
+ * direct use of the manager. Cleared after every buffer swap.
+ */
+const SGL_FrameCounters &SGL_Window::getFrameCounters() const
+{
+    return pOGLM->getFrameCounters();
+}
+
+/**
+ * @brief Shows or hides the frame counters overlay
+ * @param enable Draw the overlay?
+ * @return nothing
+ */
+void SGL_Window::toggleStatsOverlay(bool enable)
+{
+    pWindowCreationSpecs.statsOverlay = enable;
+}
+
+/**
+ * @brief Draws the last frame's counters and the frame times in the top left corner
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * The whole overlay is a single renderBitmapTextBatch() call, so it adds one draw call and a
+ * handful of state changes to the counters it shows. It always uses the overlay projection.
+ * It's drawn on the default framebuffer after the post processor pass, idle frames keep the
+ * last one on screen.
+ */
+void SGL_Window::renderStatsOverlay()
+{
+    const SGL_FrameCounters &counters = pOGLM->getFrameCounters();
+    const SGL_FrameStatsReport report = pFrameStats.report();
+
+    char buffer[512];
+    std::snprintf(buffer, sizeof(buffer),
+                  "DRAWS %u INST %u/%llu IND %u CS %u\n"
+                  "PROG %u TEX %u FBO %u BUF %u VAO %u\n"
+                  "BLEND %u CAPS %u UNI %u VP %u\n"
+                  "UPLOAD %.1f KB\n"
+                  "FRAME %.2f P99 %.2f MS OVER %llu",
+                  counters.drawCalls, counters.instancedDraws, static_cast<unsigned long long>(counters.instances),
+                  counters.indirectDraws, counters.dispatches,
+                  counters.programSwitches, counters.textureBinds, counters.fboBinds, counters.bufferBinds, counters.vaoBinds,
+                  counters.blendChanges, counters.capabilityChanges, counters.uniformUpdates, counters.viewportChanges,
+                  counters.bytesUploaded / 1024.0,
+                  report.frame.meanMs, report.frame.p99Ms, static_cast<unsigned long long>(report.overBudget));
+
+    SGL_Bitmap_Text overlay;
+    overlay.position = glm::vec2(4.0f, 4.0f);
+    overlay.text = buffer;
+    overlay.texture = pOverlayFont;
+    overlay.color = SGL_Color(1.0f, 1.0f, 0.0f, 1.0f);
+    overlay.scale = 10;
+
+    // Screen fixed regardless of the camera, only the overlay shader's projection is touched
+    this->pCamera->cameraMode(pOverlayShader, CAMERA_MODE::OVERLAY);
+    renderer->renderBitmapTextBatch(overlay);
+    this->pCamera->cameraMode(pOverlayShader, this->pCameraMode);
+}
+
+/**
+ * @brief Starts or stops recording CPU zones
+ * @param enable Record SGL_TRACE_ZONE scopes?
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * Zones are kept in a fixed ring per thread, the last few seconds are always available
+ * to dumpTrace(). The tracer is process wide, zones added by the application are included.
+ * It stays on while the hitch flight recorder is armed.
+ */
+void SGL_Window::toggleTrace(bool enable)
+{
+    pWindowCreationSpecs.cpuTrace = enable;
+    // An armed flight recorder still needs the zones
+    SGL_Tracer::enable(enable || pFlightRecorder.enabled());
+}
+
+/**
+ * @brief Writes the recorded CPU zones as Chrome Trace Event JSON
+ * @param path Output file, open it with chrome://tracing or ui.perfetto.dev
+ * @return bool False if the file couldn't be written
+ */
+bool SGL_Window::dumpTrace(const std::string &path) const
+{
+    if (!SGL_Tracer::dumpChromeTrace(path))
+    {
+        SGL_Log("SGL_Window::dumpTrace | Unable to write " + path, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_RED);
+        return false;
+    }
+    SGL_Log("CPU trace written to " + path, LOG_LEVEL::SGL_DEBUG, LOG_COLOR::TERM_DEFAULT);
+    return true;
+}
+
+/**
+ * @brief Sets the frame time that triggers a flight recorder dump
+ * @param thresholdMs Threshold in milliseconds, 0 disables the recorder
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * The recorder keeps the frame times, frame counters and input of the last seconds. The CPU
+ * zones in the dump come from the tracer, which keeps recording while the recorder is armed.
+ */
+void SGL_Window::setHitchThreshold(double thresholdMs)
+{
+    pWindowCreationSpecs.hitchThresholdMs = thresholdMs;
+    pFlightRecorder.setThreshold(thresholdMs);
+    SGL_Tracer::enable(pWindowCreationSpecs.cpuTrace || pFlightRecorder.enabled());
+}
+
+/**
+ * @brief Sets where the flight recorder writes its dumps
+ * @param directory Output directory, created on the first dump
+ * @return nothing
+ */
+void SGL_Window::setHitchDirectory(const std::string &directory)
+{
+    pWindowCreationSpecs.hitchDir = directory;
+    pFlightRecorder.setDirectory(directory);
+}
+
+/**
+ * @brief Returns the hitch flight recorder
+ * @return SGL_FlightRecorder
+ */
+const SGL_FlightRecorder &SGL_Window::getFlightRecorder() const
+{
+    return pFlightRecorder;
+}
+
+/**
+ * @brief Input latency of the last frames that consumed input
+ * @return SGL_LatencyTracker
+ * @section DESCRIPTION
+ *
+ * Measured from the oldest event pumped by getFrameInput() to the swap of the next presented
+ * frame, and to the first fence poll that found that frame finished on the GPU. The display
+ * scanout comes on top, up to one refresh period. Use report() for percentiles and the histogram.
+ */
+const SGL_LatencyTracker &SGL_Window::getInputLatency() const
+{
+    return pInputLatency;
+}
+
+/**
+ * @brief Replaces the scene with a heatmap of how many fragments each pixel received
+ * @param enable Render the overdraw view?
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * Black is untouched, then blue, cyan, green, yellow, orange and red for 1 to 6 layers, white
+ * is 7 or more. Blending is overridden while it's on, so the scene itself isn't shown.
+ */
+void SGL_Window::toggleOverdraw(bool enable)
+{
+    pWindowCreationSpecs.overdraw = enable;
+    this->pPostProcessorFBO->enableOverdraw(enable);
+}
+
+/**
+ * @brief Average and maximum fragments per pixel of the overdraw view
+ * @return SGL_OverdrawStats Empty while the view is off, a few frames behind while it's on
+ */
+const SGL_OverdrawStats &SGL_Window::getOverdrawStats() const
+{
+    return this->pPostProcessorFBO->getOverdrawStats();
+}
+
+/**
+ * @brief Sets how many frames the CPU may submit before waiting for the GPU
+ * @param frames Frame count, at least 1
+ * @return nothing
+ * @section DESCRIPTION
+ *
+ * endFrame() fences every frame, once more than this many frames are unfinished it blocks
+ * on the oldest one. Lower values reduce input latency, higher ones absorb GPU spikes.
+ */
+void SGL_Window::setFramesInFlight(int frames)
+{
+    pWindowCreationSpecs.framesInFlight = std::max(1, frames);
+    pOGLM->setFramesInFlight(pWindowCreationSpecs.framesInFlight);
+}
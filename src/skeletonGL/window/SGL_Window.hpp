@@ -38,6 +38,7 @@
 #include <stdio.h>
 #include <thread>
 #include <chrono>
+#include <algorithm>
 
 // GLEW
 #define GLEW_STATIC
@@ -58,11 +59,16 @@
 #include "../utility/SGL_AssetManager.hpp"
 #include "../utility/SGL_DataStructures.hpp"
 #include "../utility/SGL_Utility.hpp"
+#include "../utility/SGL_FrameStats.hpp"
+#include "../utility/SGL_Trace.hpp"
+#include "../utility/SGL_FlightRecorder.hpp"
+#include "../utility/SGL_LatencyTracker.hpp"
 //SGL - RENDERER
 #include "../renderer/SGL_OpenGLManager.hpp"
 #include "../renderer/SGL_Camera.hpp"
 #include "../renderer/SGL_Renderer.hpp"
 #include "../renderer/SGL_PostProcessor.hpp"
+#include "../renderer/SGL_RenderLayer.hpp"
 
 
 /**
@@ -90,6 +96,15 @@ private:
     // TIME PROFILING
     std::chrono::steady_clock::time_point pChrono0, pChrono1; ///< C++11 chrono based counter
     double pDeltaTimeMS;                                      ///< Time the past frame took to finish
+    std::chrono::steady_clock::time_point pLastFrameEnd;      ///< End of the previous endFrame(), start of the update phase
+    std::chrono::steady_clock::time_point pLastTitleUpdate;   ///< Last time show_fps refreshed the window title
+    SGL_FrameStats pFrameStats;                               ///< Rolling frame time statistics
+    SGL_FlightRecorder pFlightRecorder;                       ///< Last seconds of frames, dumped on hitches
+    SGL_LatencyTracker pInputLatency;                         ///< Oldest pumped input to the frame that presented it
+    // IDLE FRAMES
+    bool pInputThisFrame;                                     ///< Was any SDL event polled since the last endFrame()
+    bool pFrameIdle;                                          ///< Was the last frame identical to the one before it
+    bool pHasPresented;                                       ///< At least one frame has reached the screen
     // float pT0, pT1;                                           ///< Used to calculate the frame's processing time
     // std::uint32_t pTick0, pTick1, pEpochTick;                 ///< Tick based
     // double pChronoDeltaTime;                                  ///< C++11 chrono based counter
@@ -104,9 +119,15 @@ private:
 
     // CAMERA AND POST-PROCESSOR
     SGL_Camera *pCamera;                                      ///< 2D camera module (contains the orthographic projection data)
+    CAMERA_MODE pCameraMode;                                  ///< Last camera mode applied to the shaders
     //FBO and shader to reload the FBO if necessary
     SGL_PostProcessor *pPostProcessorFBO;                     ///< Main framebuffer
     SGL_Shader pDefaultPPShader;                              ///< Main post-processor shader
+    SGL_Shader pPPVariant;                                    ///< Built-in effects permutation used last frame
+    std::uint32_t pPPVariantKey;                              ///< Effects key pPPVariant was resolved for, 0 if none
+    // STATS OVERLAY
+    SGL_Shader pOverlayShader;                                ///< Bitmap text batch shader, resolved once at startup
+    SGL_Texture pOverlayFont;                                 ///< Bitmap font, resolved once at startup
 
     // TESTING
     SDL_Joystick *pGamepad_1;
@@ -121,6 +142,10 @@ private:
     void resizeGL(int width, int heigth);
     // Processes the .ini file (must be located in the same folder as the executable)
     void processIniFile(std::string path);
+    // Stores the finished frame's timings, swapStart is when the swap (or idle wait) began
+    void recordFrame(std::chrono::steady_clock::time_point swapStart);
+    // Draws the frame counters and times with the bitmap font in a single instanced draw
+    void renderStatsOverlay();
 
     // Disable both move and copy constructors
     SGL_Window(const SGL_Window &) = delete;
@@ -216,6 +241,17 @@ public:
     void setConfuseEffect(bool confuse);
     void toggleLineAA(bool toggle);
 
+    // -- RENDER LAYERS --
+    // Cached offscreen targets for content that rarely changes, see SGL_RenderLayer.hpp
+    // Creates a layer matching the post processor's resolution
+    std::unique_ptr<SGL_RenderLayer> createRenderLayer(const std::string &name, float refreshRate = 0.0f);
+    // Redirects rendering into the layer, returns false (and does nothing) if the cached copy is still valid
+    bool beginRenderLayer(SGL_RenderLayer &layer);
+    // Returns rendering to the post processor
+    void endRenderLayer(SGL_RenderLayer &layer);
+    // Draws the cached layer as a single screen sized quad
+    void renderLayer(const SGL_RenderLayer &layer);
+
     // FPS
     // Begin counting frame time
     void startFrame();
@@ -225,6 +261,45 @@ public:
 
     // Get the delta time as a double
     double getRenderDeltaTime() const;
+    // Rolling frame, update, render and swap times
+    const SGL_FrameStats &getFrameStats() const;
+    // Frames longer than this are counted as over budget, defaults to 1.5 refresh periods
+    void setFrameBudget(double budgetMs);
+    // Show the frame statistics in the window title
+    void toggleShowFPS(bool enable);
+
+    // Skip presenting frames that issue the same commands as the previous one when there's no input
+    void toggleIdleFrameSkip(bool enable);
+    // Was the last frame skipped as idle?
+    bool isFrameIdle() const;
+    // Maximum frames the CPU may queue ahead of the GPU
+    void setFramesInFlight(int frames);
+    // Report OpenGL debug messages as they happen
+    void toggleGLDebug(bool enable);
+    // Time render passes on the GPU
+    void toggleGPUTimers(bool enable);
+    // Average GPU time of every timed render pass
+    const std::vector<SGL_GPUTimerStats> &getGPUTimers() const;
+    // Draw calls, state changes and uploads of the last complete frame
+    const SGL_FrameCounters &getFrameCounters() const;
+    // Draw the frame counters over the scene
+    void toggleStatsOverlay(bool enable);
+    // Record SGL_TRACE_ZONE scopes
+    void toggleTrace(bool enable);
+    // Write the recorded zones as Chrome Trace Event JSON
+    bool dumpTrace(const std::string &path) const;
+    // Dump the last seconds of frames, input and zones when a frame takes longer than thresholdMs, 0 disables
+    void setHitchThreshold(double thresholdMs);
+    // Where the hitch dumps are written
+    void setHitchDirectory(const std::string &directory);
+    // The hitch flight recorder
+    const SGL_FlightRecorder &getFlightRecorder() const;
+    // Render a heatmap of fragments per pixel instead of the scene
+    void toggleOverdraw(bool enable);
+    // Average and maximum fragments per pixel, only measured while the overdraw view is on
+    const SGL_OverdrawStats &getOverdrawStats() const;
+    // Input to present and input to GPU completion latency of the last frames that consumed input
+    const SGL_LatencyTracker &getInputLatency() const;
 
     // Manually check for OpenGL errors
     void checkForErrors() const;
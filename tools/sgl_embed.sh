@@ -0,0 +1,60 @@
+# ███╗   ██╗███████╗ ██████╗ ██╗  ██╗███████╗██╗  ██╗   ██╗  ██╗██╗   ██╗███████╗
+# ████╗  ██║██╔════╝██╔═══██╗██║  ██║██╔════╝╚██╗██╔╝   ╚██╗██╔╝╚██╗ ██╔╝╚══███╔╝
+# ██╔██╗ ██║█████╗  ██║   ██║███████║█████╗   ╚███╔╝     ╚███╔╝  ╚████╔╝   ███╔╝
+# ██║╚██╗██║██╔══╝  ██║   ██║██╔══██║██╔══╝   ██╔██╗     ██╔██╗   ╚██╔╝   ███╔╝
+# ██║ ╚████║███████╗╚██████╔╝██║  ██║███████╗██╔╝ ██╗██╗██╔╝ ██╗   ██║   ███████╗
+# ╚═╝  ╚═══╝╚══════╝ ╚═════╝ ╚═╝  ╚═╝╚══════╝╚═╝  ╚═╝╚═╝╚═╝  ╚═╝   ╚═╝   ╚══════╝
+# Author:  AlexHG @ NEOHEX.XYZ
+# License: MIT License
+# Website: https://neohex.xyz
+
+# Embeds files into a C++ source as constant byte arrays
+# Usage: sh tools/sgl_embed.sh <output.cpp> <files...>
+#
+# Paths are stored as given (relative to the project root) and looked up with
+# sglEmbeddedAsset(), see src/skeletonGL/utility/SGL_EmbeddedAssets.hpp. Every
+# array is NUL terminated so text assets can be used as C strings, the
+# terminator isn't counted in the asset size.
+
+set -e
+
+if [ "$#" -lt 2 ]; then
+    echo "Usage: $0 <output.cpp> <files...>" >&2
+    exit 1
+fi
+
+OUTPUT="$1"
+shift
+TMP="$OUTPUT.tmp"
+
+{
+    echo "// Generated by tools/sgl_embed.sh, do not edit"
+    echo ""
+    echo "#include \"SGL_EmbeddedAssets.hpp\""
+    echo ""
+    echo "namespace"
+    echo "{"
+    INDEX=0
+    for FILE in "$@"; do
+        echo "    // $FILE"
+        echo "    const unsigned char ASSET_$INDEX[] = {"
+        od -An -v -tx1 "$FILE" | sed -e 's/^ *//' -e '/^$/d' -e 's/ *$//' -e 's/\([0-9a-f][0-9a-f]\)/0x\1,/g' -e 's/^/        /'
+        echo "        0x00"
+        echo "    };"
+        INDEX=$((INDEX + 1))
+    done
+    echo "}"
+    echo ""
+    echo "const SGL_EmbeddedAsset SGL_EMBEDDED_ASSETS[] ="
+    echo "{"
+    INDEX=0
+    for FILE in "$@"; do
+        echo "    {\"$FILE\", ASSET_$INDEX, sizeof(ASSET_$INDEX) - 1},"
+        INDEX=$((INDEX + 1))
+    done
+    echo "};"
+    echo ""
+    echo "const std::size_t SGL_EMBEDDED_ASSET_COUNT = sizeof(SGL_EMBEDDED_ASSETS) / sizeof(SGL_EMBEDDED_ASSETS[0]);"
+} > "$TMP"
+
+mv "$TMP" "$OUTPUT"